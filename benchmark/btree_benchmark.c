@@ -0,0 +1,202 @@
+/**
+ * \file    btree_benchmark.c
+ * \author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * \brief   Benchmark of the B+ tree against the sorted vector based container.
+ *
+ * Measures the time (ns per operation) of the insertion, the lookup, the erasure and the walk through
+ * the range of 100 keys for `uint64_t` keys in the B+ tree and in the sorted vector based container,
+ * where the position is found by `uc_lower_bound` and the elements are moved by `container_insert`
+ * and `container_erase`.
+ *
+ * Build and run from the root of the repository:
+ *
+ * ```code
+ * gcc -O2 -Isrc benchmark/btree_benchmark.c $(find src -name '*.c') -o btree_benchmark && ./btree_benchmark
+ * ```
+ *
+ * \date    2023-10-16
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "algorithms/search/uc_search.h"
+#include "algorithms/sort/uc_sort.h"
+#include "core/btree/btree.h"
+#include "core/container.h"
+//_____ C O N F I G S  ________________________________________________________
+#define BENCHMARK_MAX_SIZE 1000000u
+#define BENCHMARK_UPDATES  2000u
+#define BENCHMARK_RANGE    100u
+//_____ D E F I N I T I O N S _________________________________________________
+typedef struct
+{
+  double insert;
+  double find;
+  double erase;
+  double range;
+} result_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+static volatile size_t sink = 0;
+static uint64_t keys[BENCHMARK_MAX_SIZE];
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+static double now(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static cmp_t compare(const void *data1, const void *data2, size_t esize)
+{
+  (void)esize;
+
+  uint64_t value1 = *(const uint64_t *)data1;
+  uint64_t value2 = *(const uint64_t *)data2;
+
+  return (value1 > value2) ? GT : ((value1 < value2) ? LE : EQ);
+}
+
+/* The arguments are built explicitly, so no default of the `uc_sort` and `uc_lower_bound` macros is overridden */
+static void sort_keys(container_t *container)
+{
+  uc_sort_base((AlgSortArg_t){
+    .container = container, .sort = UC_TIM_SORT, .order = SORT_ASCENDING, .cmp = compare, .key = UC_KEY_NONE, .indirect = false});
+}
+
+static size_t lower_bound(const container_t *container, const uint64_t *key)
+{
+  return uc_lower_bound_base(
+    (AlgSearchArg_t){.container = container, .value = key, .order = SORT_ASCENDING, .cmp = compare, .key = UC_KEY_NONE});
+}
+
+static void make_keys(size_t size)
+{
+  uint64_t seed = 88172645463325252ull;
+  for (size_t i = 0; i < size; i++)
+  {
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+    keys[i] = seed;
+  }
+}
+
+static result_t run_tree(size_t size)
+{
+  result_t result;
+  uint64_t value = 0;
+  btree_t *tree = btree_create(sizeof(uint64_t), sizeof(uint64_t), compare);
+
+  double start = now();
+  for (size_t i = 0; i < size; i++)
+  {
+    btree_insert(tree, &keys[i], &value);
+  }
+  result.insert = (now() - start) * 1e9 / (double)size;
+
+  start = now();
+  for (size_t i = 0; i < BENCHMARK_UPDATES; i++)
+  {
+    sink += (size_t)btree_find(tree, &keys[(i * 7919u) % size]);
+  }
+  result.find = (now() - start) * 1e9 / BENCHMARK_UPDATES;
+
+  start = now();
+  for (size_t i = 0; i < BENCHMARK_UPDATES; i++)
+  {
+    btree_cursor_t cursor = btree_lower_bound(tree, &keys[(i * 7919u) % size]);
+    for (size_t n = 0; n < BENCHMARK_RANGE && btree_cursor_valid(&cursor); n++, btree_cursor_next(&cursor))
+    {
+      sink += *(const uint64_t *)btree_cursor_key(&cursor);
+    }
+  }
+  result.range = (now() - start) * 1e9 / BENCHMARK_UPDATES;
+
+  size_t erases = (BENCHMARK_UPDATES < size) ? BENCHMARK_UPDATES : size;
+  start = now();
+  for (size_t i = 0; i < erases; i++)
+  {
+    sink += btree_erase(tree, &keys[i]);
+  }
+  result.erase = (now() - start) * 1e9 / (double)erases;
+
+  btree_delete(&tree);
+  return result;
+}
+
+/* The vector is filled by the sorted keys at once, only the last keys are inserted one by one */
+static result_t run_sorted(size_t size)
+{
+  result_t result;
+  size_t updates = (BENCHMARK_UPDATES < size) ? BENCHMARK_UPDATES : size;
+  container_t *container = container_create(sizeof(uint64_t), CONTAINER_VECTOR_BASED);
+
+  for (size_t i = 0; i < size - updates; i++)
+  {
+    container_push_back(container, &keys[i]);
+  }
+  sort_keys(container);
+
+  double start = now();
+  for (size_t i = size - updates; i < size; i++)
+  {
+    size_t index = lower_bound(container, &keys[i]);
+    container_insert(container, &keys[i], index);
+  }
+  result.insert = (now() - start) * 1e9 / (double)updates;
+
+  start = now();
+  for (size_t i = 0; i < BENCHMARK_UPDATES; i++)
+  {
+    sink += lower_bound(container, &keys[(i * 7919u) % size]);
+  }
+  result.find = (now() - start) * 1e9 / BENCHMARK_UPDATES;
+
+  start = now();
+  for (size_t i = 0; i < BENCHMARK_UPDATES; i++)
+  {
+    size_t index = lower_bound(container, &keys[(i * 7919u) % size]);
+    const uint64_t *data = (const uint64_t *)container_data(container);
+    for (size_t n = 0; n < BENCHMARK_RANGE && index + n < size; n++)
+    {
+      sink += data[index + n];
+    }
+  }
+  result.range = (now() - start) * 1e9 / BENCHMARK_UPDATES;
+
+  start = now();
+  for (size_t i = 0; i < updates; i++)
+  {
+    size_t index = lower_bound(container, &keys[i]);
+    sink += container_erase(container, index);
+  }
+  result.erase = (now() - start) * 1e9 / (double)updates;
+
+  container_delete(&container);
+  return result;
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+int main(void)
+{
+  const size_t sizes[] = {100, 10000, BENCHMARK_MAX_SIZE};
+
+  make_keys(BENCHMARK_MAX_SIZE);
+  printf("%-9s %-8s %12s %12s %12s %12s\n", "size", "method", "insert ns", "find ns", "erase ns", "range ns");
+
+  for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+  {
+    result_t tree = run_tree(sizes[s]);
+    result_t sorted = run_sorted(sizes[s]);
+
+    printf("%-9zu %-8s %12.1f %12.1f %12.1f %12.1f\n", sizes[s], "btree", tree.insert, tree.find, tree.erase, tree.range);
+    printf("%-9zu %-8s %12.1f %12.1f %12.1f %12.1f\n", sizes[s], "sorted", sorted.insert, sorted.find, sorted.erase, sorted.range);
+  }
+
+  return 0;
+}
@@ -0,0 +1,120 @@
+/**
+ * \file    cpp_facade_benchmark.cpp
+ * \author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * \brief   Benchmark of the C++ facade against `std::vector` and `std::list`.
+ *
+ * Measures fill, range-for traversal, sort with a user comparator and move of the whole container.
+ *
+ * Build and run from the root of the repository:
+ *
+ * ```code
+ * gcc -O2 -c -Isrc $(find src -name '*.c') && \
+ * g++ -O2 -std=c++17 -Isrc benchmark/cpp_facade_benchmark.cpp *.o -o cpp_facade_benchmark && \
+ * ./cpp_facade_benchmark
+ * ```
+ *
+ * \date    2023-10-08
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <list>
+#include <vector>
+
+#include "uc/container.hpp"
+//_____ C O N F I G S  ________________________________________________________
+#define BENCHMARK_SIZE   200000u
+#define BENCHMARK_ROUNDS 10u
+//_____ D E F I N I T I O N S _________________________________________________
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+static volatile uint64_t sink = 0;
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+static uint32_t pseudo_random(uint32_t i)
+{
+  return (i * 2654435761u) ^ (i >> 7);
+}
+
+template <typename Fn> static double measure(Fn &&fn)
+{
+  auto start = std::chrono::steady_clock::now();
+  for (uint32_t round = 0; round < BENCHMARK_ROUNDS; round++)
+  {
+    fn();
+  }
+  std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+  return elapsed.count() / BENCHMARK_ROUNDS;
+}
+
+template <typename Container> static void fill(Container &container)
+{
+  for (uint32_t i = 0; i < BENCHMARK_SIZE; i++)
+  {
+    container.push_back(pseudo_random(i));
+  }
+}
+
+template <typename Container> static uint64_t traverse(const Container &container)
+{
+  uint64_t sum = 0;
+  for (uint32_t value : container)
+  {
+    sum += value;
+  }
+  return sum;
+}
+
+template <typename Container> static void run(const char *name)
+{
+  double fill_ms = measure([] {
+    Container container;
+    fill(container);
+    sink += container.size();
+  });
+
+  Container container;
+  fill(container);
+
+  double traverse_ms = measure([&] { sink += traverse(container); });
+
+  double sort_ms = measure([&] {
+    Container copy = container;
+    copy.sort([](uint32_t a, uint32_t b) { return a > b; });
+    sink += copy.front();
+  });
+
+  double move_ms = measure([&] {
+    Container moved = std::move(container);
+    container = std::move(moved);
+  });
+
+  std::printf("%-22s fill %9.3f ms  traverse %9.3f ms  sort %9.3f ms  move %9.6f ms\n", name, fill_ms, traverse_ms, sort_ms,
+              move_ms);
+}
+
+/**
+ * \brief `std::vector` with the same `sort` method as the facade has.
+ */
+struct std_vector : std::vector<uint32_t>
+{
+  template <typename Compare> void sort(Compare comp)
+  {
+    std::sort(begin(), end(), comp);
+  }
+};
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+int main(void)
+{
+  std::printf("%u elements, average of %u rounds\n", BENCHMARK_SIZE, BENCHMARK_ROUNDS);
+
+  run<uc::vector<uint32_t>>("uc::vector<uint32_t>");
+  run<std_vector>("std::vector<uint32_t>");
+  run<uc::list<uint32_t>>("uc::list<uint32_t>");
+  run<std::list<uint32_t>>("std::list<uint32_t>");
+  run<uc::deque<uint32_t>>("uc::deque<uint32_t>");
+
+  return (0 == sink) ? 1 : 0;
+}
@@ -0,0 +1,114 @@
+/**
+ * \file    find_benchmark.c
+ * \author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * \brief   Benchmark of the linear search functions.
+ *
+ * Measures the scan speed (GB/s) of `uc_find` and `uc_count` over the vector based container
+ * for 1, 2, 4 and 8 bytes elements against the loop of `container_at` plus comparison.
+ * The searched value is absent, so the whole container is scanned.
+ *
+ * Build and run from the root of the repository (add `-mavx2` to use AVX2 instead of SSE2):
+ *
+ * ```code
+ * gcc -O2 -Isrc benchmark/find_benchmark.c $(find src -name '*.c') -o find_benchmark && ./find_benchmark
+ * ```
+ *
+ * \date    2023-10-13
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "algorithms/find/uc_find.h"
+#include "core/container.h"
+//_____ C O N F I G S  ________________________________________________________
+#define BENCHMARK_BYTES  (16u * 1024u * 1024u)
+#define BENCHMARK_ROUNDS 20u
+//_____ D E F I N I T I O N S _________________________________________________
+typedef size_t (*scan_fn_t)(const container_t *container, const void *value);
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+static volatile size_t sink = 0;
+static uint8_t pattern[BENCHMARK_BYTES];
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+static double now(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static size_t scan_at(const container_t *container, const void *value)
+{
+  uint8_t element[8];
+  size_t esize = container_esize(container);
+  size_t size = container_size(container);
+
+  for (size_t i = 0; i < size; i++)
+  {
+    container_at(container, element, i);
+    if (0 == memcmp(element, value, esize))
+    {
+      return i;
+    }
+  }
+
+  return size;
+}
+
+static size_t scan_find(const container_t *container, const void *value)
+{
+  return uc_find_base((AlgFindArg_t){.container = container, .value = value, .match = NULL});
+}
+
+static size_t scan_count(const container_t *container, const void *value)
+{
+  return uc_count_base((AlgFindArg_t){.container = container, .value = value, .match = NULL});
+}
+
+static double measure(scan_fn_t scan, const container_t *container, const void *value)
+{
+  double start = now();
+  for (uint32_t round = 0; round < BENCHMARK_ROUNDS; round++)
+  {
+    sink += scan(container, value);
+  }
+  double elapsed = now() - start;
+
+  return (double)BENCHMARK_BYTES * BENCHMARK_ROUNDS / elapsed / 1e9;
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+int main(void)
+{
+  const size_t esizes[] = {1, 2, 4, 8};
+  const uint64_t value = 0xFFFFFFFFFFFFFFFFull;
+
+  memset(pattern, 0x5A, sizeof(pattern));
+  printf("%-6s %14s %14s %14s\n", "esize", "at loop GB/s", "find GB/s", "count GB/s");
+
+  for (size_t e = 0; e < sizeof(esizes) / sizeof(esizes[0]); e++)
+  {
+    size_t esize = esizes[e];
+    size_t size = BENCHMARK_BYTES / esize;
+
+    container_t *container = container_create(esize, CONTAINER_VECTOR_BASED);
+    if (NULL == container || !container_insert_range(container, pattern, 0, size))
+    {
+      printf("Allocation failed\n");
+      return 1;
+    }
+
+    double at = measure(scan_at, container, &value);
+    double find = measure(scan_find, container, &value);
+    double count = measure(scan_count, container, &value);
+    printf("%-6zu %14.2f %14.2f %14.2f\n", esize, at, find, count);
+
+    container_delete(&container);
+  }
+
+  return 0;
+}
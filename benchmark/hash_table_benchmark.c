@@ -0,0 +1,172 @@
+/**
+ * \file    hash_table_benchmark.c
+ * \author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * \brief   Benchmark of the hash table against the linear search in the vector based container.
+ *
+ * Measures the time (ns per operation) of the insertion, the lookup of the present and absent keys
+ * and the erasure of `uint64_t` keys for the hash table and for the vector based container,
+ * where the key is found by `uc_find` (SIMD scan) and inserted by `container_push_back`.
+ *
+ * Build and run from the root of the repository:
+ *
+ * ```code
+ * gcc -O2 -Isrc benchmark/hash_table_benchmark.c $(find src -name '*.c') -o hash_table_benchmark && ./hash_table_benchmark
+ * ```
+ *
+ * \date    2023-10-14
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "algorithms/find/uc_find.h"
+#include "core/container.h"
+#include "core/hash/hash_table.h"
+//_____ C O N F I G S  ________________________________________________________
+#define BENCHMARK_MAX_SIZE 1000000u
+#define BENCHMARK_LOOKUPS  2000u
+//_____ D E F I N I T I O N S _________________________________________________
+typedef struct
+{
+  double insert;
+  double hit;
+  double miss;
+  double erase;
+} result_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+static volatile size_t sink = 0;
+static uint64_t keys[BENCHMARK_MAX_SIZE];
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+static double now(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/* The absent keys are odd, the present keys are even */
+static void make_keys(size_t size)
+{
+  uint64_t seed = 88172645463325252ull;
+  for (size_t i = 0; i < size; i++)
+  {
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+    keys[i] = seed & ~1ull;
+  }
+}
+
+static result_t run_table(size_t size)
+{
+  result_t result;
+  uint64_t value = 0;
+  hash_table_t *table = hash_table_create(sizeof(uint64_t), sizeof(uint64_t), NULL, NULL);
+
+  double start = now();
+  for (size_t i = 0; i < size; i++)
+  {
+    hash_table_insert(table, &keys[i], &value);
+  }
+  result.insert = (now() - start) * 1e9 / (double)size;
+
+  start = now();
+  for (size_t i = 0; i < BENCHMARK_LOOKUPS; i++)
+  {
+    sink += (size_t)hash_table_find(table, &keys[(i * 7919u) % size]);
+  }
+  result.hit = (now() - start) * 1e9 / BENCHMARK_LOOKUPS;
+
+  start = now();
+  for (size_t i = 0; i < BENCHMARK_LOOKUPS; i++)
+  {
+    uint64_t key = keys[(i * 7919u) % size] | 1u;
+    sink += (size_t)hash_table_find(table, &key);
+  }
+  result.miss = (now() - start) * 1e9 / BENCHMARK_LOOKUPS;
+
+  start = now();
+  for (size_t i = 0; i < BENCHMARK_LOOKUPS && i < size; i++)
+  {
+    sink += hash_table_erase(table, &keys[i]);
+  }
+  result.erase = (now() - start) * 1e9 / (double)((BENCHMARK_LOOKUPS < size) ? BENCHMARK_LOOKUPS : size);
+
+  hash_table_delete(&table);
+  return result;
+}
+
+/* The argument is built explicitly, so no default of the `uc_find` macro is overridden */
+static size_t linear_find(const container_t *container, const uint64_t *key)
+{
+  return uc_find_base((AlgFindArg_t){.container = container, .value = key, .match = NULL});
+}
+
+/* The insertion checks that the key is absent like the insertion into the table does */
+static result_t run_linear(size_t size)
+{
+  result_t result;
+  size_t inserts = (BENCHMARK_LOOKUPS < size) ? BENCHMARK_LOOKUPS : size;
+  container_t *container = container_create(sizeof(uint64_t), CONTAINER_VECTOR_BASED);
+
+  container_insert_range(container, keys, 0, size - inserts);
+  double start = now();
+  for (size_t i = size - inserts; i < size; i++)
+  {
+    if (linear_find(container, &keys[i]) == container_size(container))
+    {
+      container_push_back(container, &keys[i]);
+    }
+  }
+  result.insert = (now() - start) * 1e9 / (double)inserts;
+
+  start = now();
+  for (size_t i = 0; i < BENCHMARK_LOOKUPS; i++)
+  {
+    sink += linear_find(container, &keys[(i * 7919u) % size]);
+  }
+  result.hit = (now() - start) * 1e9 / BENCHMARK_LOOKUPS;
+
+  start = now();
+  for (size_t i = 0; i < BENCHMARK_LOOKUPS; i++)
+  {
+    uint64_t key = keys[(i * 7919u) % size] | 1u;
+    sink += linear_find(container, &key);
+  }
+  result.miss = (now() - start) * 1e9 / BENCHMARK_LOOKUPS;
+
+  start = now();
+  for (size_t i = 0; i < inserts; i++)
+  {
+    size_t index = linear_find(container, &keys[i]);
+    sink += container_erase_unordered(container, index);
+  }
+  result.erase = (now() - start) * 1e9 / (double)inserts;
+
+  container_delete(&container);
+  return result;
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+int main(void)
+{
+  const size_t sizes[] = {100, 10000, BENCHMARK_MAX_SIZE};
+
+  make_keys(BENCHMARK_MAX_SIZE);
+  printf("%-9s %-8s %12s %12s %12s %12s\n", "size", "method", "insert ns", "hit ns", "miss ns", "erase ns");
+
+  for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+  {
+    result_t table = run_table(sizes[s]);
+    result_t linear = run_linear(sizes[s]);
+
+    printf("%-9zu %-8s %12.1f %12.1f %12.1f %12.1f\n", sizes[s], "hash", table.insert, table.hit, table.miss, table.erase);
+    printf("%-9zu %-8s %12.1f %12.1f %12.1f %12.1f\n", sizes[s], "linear", linear.insert, linear.hit, linear.miss, linear.erase);
+  }
+
+  return 0;
+}
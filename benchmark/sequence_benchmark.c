@@ -0,0 +1,115 @@
+/**
+ * \file    sequence_benchmark.c
+ * \author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * \brief   Benchmark of the container cores used as a sequence.
+ *
+ * Measures the time (ns per element or per operation) of the push to the back, the walk by the cursor,
+ * the access by the index and the insertion and the erasure in the middle for `uint32_t` elements
+ * in the linked list, the vector, the unrolled list and the tiered vector based containers.
+ *
+ * Build and run from the root of the repository:
+ *
+ * ```code
+ * gcc -O2 -Isrc benchmark/sequence_benchmark.c $(find src -name '*.c') -o sequence_benchmark && ./sequence_benchmark
+ * ```
+ *
+ * \date    2023-10-17
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "core/container.h"
+//_____ C O N F I G S  ________________________________________________________
+#define BENCHMARK_UPDATES 1000u
+#define BENCHMARK_LOOKUPS 1000u
+//_____ D E F I N I T I O N S _________________________________________________
+typedef struct
+{
+  double push;
+  double walk;
+  double at;
+  double insert;
+  double erase;
+} result_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+static volatile size_t sink = 0;
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+static double now(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static result_t run(container_type_e type, size_t size)
+{
+  result_t result;
+  container_t *container = container_create(sizeof(uint32_t), type);
+
+  double start = now();
+  for (uint32_t i = 0; i < size; i++)
+  {
+    container_push_back(container, &i);
+  }
+  result.push = (now() - start) * 1e9 / (double)size;
+
+  start = now();
+  container_cursor_t cursor = container_cursor(container, 0);
+  for (; container_cursor_valid(&cursor); container_cursor_next(&cursor))
+  {
+    sink += *(const uint32_t *)container_cursor_data(&cursor);
+  }
+  result.walk = (now() - start) * 1e9 / (double)size;
+
+  uint32_t value = 0;
+  start = now();
+  for (size_t i = 0; i < BENCHMARK_LOOKUPS; i++)
+  {
+    container_at(container, &value, (i * 7919u) % size);
+    sink += value;
+  }
+  result.at = (now() - start) * 1e9 / BENCHMARK_LOOKUPS;
+
+  start = now();
+  for (uint32_t i = 0; i < BENCHMARK_UPDATES; i++)
+  {
+    container_insert(container, &i, (i * 7919u) % container_size(container));
+  }
+  result.insert = (now() - start) * 1e9 / BENCHMARK_UPDATES;
+
+  start = now();
+  for (size_t i = 0; i < BENCHMARK_UPDATES; i++)
+  {
+    container_erase(container, (i * 7919u) % container_size(container));
+  }
+  result.erase = (now() - start) * 1e9 / BENCHMARK_UPDATES;
+
+  container_delete(&container);
+  return result;
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+int main(void)
+{
+  const size_t sizes[] = {1000, 100000, 1000000};
+  const container_type_e types[] = {
+    CONTAINER_LINKED_LIST_BASED, CONTAINER_VECTOR_BASED, CONTAINER_UNROLLED_LIST_BASED, CONTAINER_TIERED_VECTOR_BASED};
+  const char *names[] = {"list", "vector", "unrolled", "tiered"};
+
+  printf("%-9s %-9s %10s %10s %10s %12s %12s\n", "size", "core", "push ns", "walk ns", "at ns", "insert ns", "erase ns");
+
+  for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+  {
+    for (size_t t = 0; t < sizeof(types) / sizeof(types[0]); t++)
+    {
+      result_t r = run(types[t], sizes[s]);
+      printf("%-9zu %-9s %10.1f %10.1f %10.1f %12.1f %12.1f\n", sizes[s], names[t], r.push, r.walk, r.at, r.insert, r.erase);
+    }
+  }
+
+  return 0;
+}
@@ -8,9 +8,13 @@
 #pragma once
 
 //_____ I N C L U D E S _______________________________________________________
-#include "algorithms/equal/equal.h"
+#include "algorithms/equal/uc_equal.h"
+#include "algorithms/find/uc_find.h"
+#include "algorithms/search/uc_search.h"
+#include "algorithms/select/uc_select.h"
 #include "algorithms/sort/uc_sort.h"
 #include "algorithms/transformation/uc_transformation.h"
+#include "algorithms/unique/uc_unique.h"
 //_____ C O N F I G S  ________________________________________________________
 //_____ D E F I N I T I O N S _________________________________________________
 //_____ M A C R O S ___________________________________________________________
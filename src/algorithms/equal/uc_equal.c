@@ -14,29 +14,82 @@
 #include "common/uc_assert.h"
 
 #include "core/container.h"
-#include "interface/allocator_if.h"
 
-#include "algorithms/transformation/uc_transformation.h"
+#include "algorithms/key/uc_key.h"
 //_____ C O N F I G S  ________________________________________________________
 //_____ D E F I N I T I O N S _________________________________________________
+/**
+ * \brief Comparison of two arrays specialized for the key type.
+ */
+typedef bool (*key_equal_fn_t)(const void *arr1, const void *arr2, size_t size, size_t esize, size_t offset);
+
+/**
+ * \brief Comparison context: the key kernel, the user callback or NULL for both if the elements are compared by `memcmp`.
+ */
+typedef struct
+{
+  key_equal_fn_t kernel;
+  equal_fn_t cmp;
+  size_t esize;
+  size_t offset;
+} equal_t;
 //_____ M A C R O S ___________________________________________________________
 //_____ V A R I A B L E S _____________________________________________________
 //_____ P R I V A T E  F U N C T I O N S_______________________________________
-static bool default_compare(const void *value1, const void *value2, size_t esize)
+#define KEY_EQUALS(NAME, TYPE) \
+  static bool equal_##NAME(const void *arr1, const void *arr2, size_t size, size_t esize, size_t offset) \
+  { \
+    for (size_t i = 0; i < size; i = i + esize) \
+    { \
+      if (!uc_key_eq_##NAME((const uint8_t *)arr1 + i, (const uint8_t *)arr2 + i, offset)) \
+      { \
+        return false; \
+      } \
+    } \
+    return true; \
+  }
+
+UC_KEY_TYPES(KEY_EQUALS)
+#undef KEY_EQUALS
+
+#define KEY_EQUAL(NAME, TYPE) [UC_KEY_TYPE_##NAME] = equal_##NAME,
+static const key_equal_fn_t key_equals_callbacks[UC_KEY_TYPE_LAST] = {UC_KEY_TYPES(KEY_EQUAL)};
+#undef KEY_EQUAL
+
+/*
+ * Compares two blocks of `size` bytes. Without the key and the user callback the whole block is compared
+ * by the single `memcmp`, otherwise the elements are compared one by one until the first mismatch.
+ */
+static bool equal_block(const equal_t *e, const uint8_t *block1, const uint8_t *block2, size_t size)
 {
-  return 0 == memcmp(value1, value2, esize);
+  if (NULL != e->kernel)
+  {
+    return e->kernel(block1, block2, size, e->esize, e->offset);
+  }
+
+  if (NULL == e->cmp)
+  {
+    return 0 == memcmp(block1, block2, size);
+  }
+
+  for (size_t i = 0; i < size; i = i + e->esize)
+  {
+    if (!e->cmp(block1 + i, block2 + i, e->esize))
+    {
+      return false;
+    }
+  }
+
+  return true;
 }
 //_____ P U B L I C  F U N C T I O N S_________________________________________
 /**
  * Checks two containers for equality.
  *
- * Detailed description see in equal.h
+ * Detailed description see in uc_equal.h
  */
 bool uc_equal_base(AlgEqualArg_t arg)
 {
-  bool status = true;
-  equal_fn_t compare = (arg.cmp == NULL) ? default_compare : arg.cmp;
-
   UC_ASSERT(arg.container1 && "Invalid argument: container1");
   UC_ASSERT(arg.container2 && "Invalid argument: container2");
 
@@ -56,41 +109,45 @@ bool uc_equal_base(AlgEqualArg_t arg)
     return true;
   }
 
-  allocate_fn_t mem_allocate = get_allocator();
-
-  void *arr1 = (void *)mem_allocate(esize1 * size1);
-  void *arr2 = (void *)mem_allocate(esize2 * size2);
-  if (NULL == arr1 || NULL == arr2)
+  equal_t context = {.kernel = NULL, .cmp = arg.cmp, .esize = esize1, .offset = 0};
+  if (UC_KEY_IS_VALID(arg.key))
   {
-    return false;
+    UC_ASSERT(arg.key.offset + uc_key_size(arg.key.type) <= esize1 && "Invalid argument: key");
+    context.kernel = key_equals_callbacks[arg.key.type];
+    context.offset = arg.key.offset;
   }
-
-  free_fn_t mem_free = get_free();
-
-  size_t arr_size = esize1 * size1;
-  bool status1 = uc_to_array(arg.container1, arr1, arr_size);
-  bool status2 = uc_to_array(arg.container2, arr2, arr_size);
-
-  if (!(status1 && status2))
+  else if (NULL == arg.cmp)
   {
-    status = false;
-    goto exit;
+    /* The bytewise equal containers have equal hashes, so different tracked hashes reject without the scan */
+    uint64_t hash1 = 0;
+    uint64_t hash2 = 0;
+    if (container_hash_cached(arg.container1, &hash1) && container_hash_cached(arg.container2, &hash2) && hash1 != hash2)
+    {
+      return false;
+    }
   }
 
-  for (size_t i = 0; i < arr_size; i = i + esize1)
+  /* Both elements storages are contiguous, so they are compared directly */
+  const uint8_t *data1 = (const uint8_t *)container_cdata(arg.container1);
+  const uint8_t *data2 = (const uint8_t *)container_cdata(arg.container2);
+  if (NULL != data1 && NULL != data2)
   {
-    void *ndata1 = ((uint8_t *)arr1 + i);
-    void *ndata2 = ((uint8_t *)arr2 + i);
+    return equal_block(&context, data1, data2, size1 * esize1);
+  }
 
-    if (!compare(ndata1, ndata2, esize1))
+  /* Otherwise the containers are walked in lockstep */
+  container_cursor_t cursor1 = container_cursor(arg.container1, 0);
+  container_cursor_t cursor2 = container_cursor(arg.container2, 0);
+  for (size_t i = 0; i < size1; i++)
+  {
+    if (!equal_block(&context, container_cursor_cdata(&cursor1), container_cursor_cdata(&cursor2), esize1))
     {
-      status = false;
-      goto exit;
+      return false;
     }
+
+    container_cursor_next(&cursor1);
+    container_cursor_next(&cursor2);
   }
 
-exit:
-  mem_free(arr1);
-  mem_free(arr2);
-  return status;
+  return true;
 }
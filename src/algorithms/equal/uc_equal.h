@@ -10,6 +10,10 @@
  * using a custom comparison function if provided. Otherwise, a default comparison
  * method is employed.
  *
+ * The containers are compared without copying: the storages of two vector based containers
+ * are compared directly (by a single `memcmp` if no comparison function is given), otherwise
+ * both containers are walked in lockstep. The comparison stops on the first mismatch.
+ *
  * The file also introduces a type for the comparison function and a convenient macro
  * that simplifies the use of the `uc_equal_base` function by applying default
  * arguments.
@@ -21,6 +25,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "algorithms/key/uc_key.h"
 #include "core/container.h"
 //_____ C O N F I G S  ________________________________________________________
 //_____ D E F I N I T I O N S _________________________________________________
@@ -40,6 +45,7 @@ typedef struct
   const container_t *container1;
   const container_t *container2;
   equal_fn_t cmp;
+  uc_key_t key;
 } AlgEqualArg_t;
 //_____ M A C R O S ___________________________________________________________
 //_____ V A R I A B L E S _____________________________________________________
@@ -56,8 +62,14 @@ extern "C"
    * \param[in] container2.Second container (mandatory argument).
    * \param[in] cmp callback fuction which will be used for comparing. This argument isn`t mandatory. In case if user do not give
    *   this argument the default comparision function will be used.
+   * \param[in] key key descriptor see @uc_key_t. This argument isn`t mandatory. If it is given then only the keys
+   *   of the elements are compared by the typed inline kernel instead of `cmp` callback.
    * \return true if container are equal
    * \return false if container aren`t equal
+   *
+   * \note No additional memory is allocated and the comparison stops on the first mismatch.
+   *   If both containers track their hashes (see `container_hash_track`) and no `cmp` or `key` is given,
+   *   the different hashes reject the containers without reading the elements.
    */
   bool uc_equal_base(AlgEqualArg_t arg);
 
@@ -72,7 +84,8 @@ extern "C"
    * bool res = uc_equal(.container1 = container1, .container2 = container2);
    * ```
    */
-#define uc_equal(...) (uc_equal_base((AlgEqualArg_t){.container1 = NULL, .container2 = NULL, .cmp = NULL, __VA_ARGS__}))
+#define uc_equal(...) \
+  (uc_equal_base((AlgEqualArg_t){.container1 = NULL, .container2 = NULL, .cmp = NULL, .key = UC_KEY_NONE, __VA_ARGS__}))
 /* C++ detection */
 #ifdef __cplusplus
 }
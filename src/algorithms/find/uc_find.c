@@ -0,0 +1,294 @@
+/**
+ * @file    uc_find.c
+ * @author  Aliaksander Kavalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Linear search of the elements: find, find_if, count and contains.
+ * @date    2023-10-13
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "uc_find.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "common/uc_assert.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+//_____ C O N F I G S  ________________________________________________________
+//_____ D E F I N I T I O N S _________________________________________________
+#if defined(__AVX2__)
+/**
+ * \brief Number of bytes compared by one SIMD instruction.
+ */
+#define FIND_SIMD_WIDTH 32
+
+typedef __m256i find_vector_t;
+#elif defined(__SSE2__)
+#define FIND_SIMD_WIDTH 16
+
+typedef __m128i find_vector_t;
+#endif
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+#if defined(FIND_SIMD_WIDTH)
+/*
+ * Fills all lanes of the vector by the value. `esize` is 1, 2, 4 or 8 and is a compile time constant
+ * in every caller, so the switch is folded.
+ */
+static inline __attribute__((always_inline)) find_vector_t find_broadcast(const void *value, size_t esize)
+{
+  uint64_t pattern = 0;
+  memcpy(&pattern, value, esize);
+
+  switch (esize)
+  {
+#if defined(__AVX2__)
+    case 1: return _mm256_set1_epi8((char)pattern);
+    case 2: return _mm256_set1_epi16((short)pattern);
+    case 4: return _mm256_set1_epi32((int)pattern);
+    default: return _mm256_set1_epi64x((long long)pattern);
+#else
+    case 1: return _mm_set1_epi8((char)pattern);
+    case 2: return _mm_set1_epi16((short)pattern);
+    case 4: return _mm_set1_epi32((int)pattern);
+    default: return _mm_set1_epi64x((long long)pattern);
+#endif
+  }
+}
+
+/*
+ * Compares the block of FIND_SIMD_WIDTH bytes with the pattern lane by lane and returns the mask
+ * with one bit per byte: all `esize` bits of the equal element are set.
+ */
+static inline __attribute__((always_inline)) uint32_t find_match(const uint8_t *data, find_vector_t pattern, size_t esize)
+{
+#if defined(__AVX2__)
+  __m256i block = _mm256_loadu_si256((const __m256i *)data);
+  __m256i equal;
+
+  switch (esize)
+  {
+    case 1: equal = _mm256_cmpeq_epi8(block, pattern); break;
+    case 2: equal = _mm256_cmpeq_epi16(block, pattern); break;
+    case 4: equal = _mm256_cmpeq_epi32(block, pattern); break;
+    default: equal = _mm256_cmpeq_epi64(block, pattern); break;
+  }
+
+  return (uint32_t)_mm256_movemask_epi8(equal);
+#else
+  __m128i block = _mm_loadu_si128((const __m128i *)data);
+  __m128i equal;
+
+  switch (esize)
+  {
+    case 1: equal = _mm_cmpeq_epi8(block, pattern); break;
+    case 2: equal = _mm_cmpeq_epi16(block, pattern); break;
+    case 4: equal = _mm_cmpeq_epi32(block, pattern); break;
+    default:
+      /* SSE2 has no 64-bit comparison: both 32-bit halves of the lane must be equal */
+      equal = _mm_cmpeq_epi32(block, pattern);
+      equal = _mm_and_si128(equal, _mm_shuffle_epi32(equal, _MM_SHUFFLE(2, 3, 0, 1)));
+      break;
+  }
+
+  return (uint32_t)_mm_movemask_epi8(equal);
+#endif
+}
+#endif
+
+/*
+ * Returns the index of the first element equal to the value or `size`. If `vectorize` is true `esize` is
+ * 1, 2, 4 or 8 and the array is scanned by blocks of FIND_SIMD_WIDTH bytes, the tail is compared by memcmp,
+ * which the compiler replaces by the integer comparison for the constant `esize`.
+ */
+static inline __attribute__((always_inline)) size_t find_engine(const uint8_t *arr,
+                                                                size_t size,
+                                                                const void *value,
+                                                                size_t esize,
+                                                                bool vectorize)
+{
+  size_t i = 0;
+
+#if defined(FIND_SIMD_WIDTH)
+  if (vectorize)
+  {
+    const size_t lanes = FIND_SIMD_WIDTH / esize;
+    find_vector_t pattern = find_broadcast(value, esize);
+
+    for (; i + lanes <= size; i += lanes)
+    {
+      uint32_t mask = find_match(&arr[i * esize], pattern, esize);
+      if (0 != mask)
+      {
+        return i + (size_t)__builtin_ctz(mask) / esize;
+      }
+    }
+  }
+#endif
+
+  for (; i < size; i++)
+  {
+    if (0 == memcmp(&arr[i * esize], value, esize))
+    {
+      return i;
+    }
+  }
+
+  return size;
+}
+
+/*
+ * Returns the number of the elements equal to the value. Works like `find_engine`.
+ */
+static inline __attribute__((always_inline)) size_t count_engine(const uint8_t *arr,
+                                                                 size_t size,
+                                                                 const void *value,
+                                                                 size_t esize,
+                                                                 bool vectorize)
+{
+  size_t i = 0;
+  size_t count = 0;
+
+#if defined(FIND_SIMD_WIDTH)
+  if (vectorize)
+  {
+    const size_t lanes = FIND_SIMD_WIDTH / esize;
+    find_vector_t pattern = find_broadcast(value, esize);
+
+    for (; i + lanes <= size; i += lanes)
+    {
+      count += (size_t)__builtin_popcount(find_match(&arr[i * esize], pattern, esize));
+    }
+    count /= esize;
+  }
+#endif
+
+  for (; i < size; i++)
+  {
+    count += (0 == memcmp(&arr[i * esize], value, esize));
+  }
+
+  return count;
+}
+
+static size_t find_in_array(const uint8_t *arr, size_t size, const void *value, size_t esize)
+{
+  switch (esize)
+  {
+    case 1: return find_engine(arr, size, value, 1, true);
+    case 2: return find_engine(arr, size, value, 2, true);
+    case 4: return find_engine(arr, size, value, 4, true);
+    case 8: return find_engine(arr, size, value, 8, true);
+    default: return find_engine(arr, size, value, esize, false);
+  }
+}
+
+static size_t count_in_array(const uint8_t *arr, size_t size, const void *value, size_t esize)
+{
+  switch (esize)
+  {
+    case 1: return count_engine(arr, size, value, 1, true);
+    case 2: return count_engine(arr, size, value, 2, true);
+    case 4: return count_engine(arr, size, value, 4, true);
+    case 8: return count_engine(arr, size, value, 8, true);
+    default: return count_engine(arr, size, value, esize, false);
+  }
+}
+
+/*
+ * Walks the container and returns the index of the first element for which the predicate returns true
+ * (or the number of such elements if `count_all` is true). Without the predicate the elements
+ * are compared with the value.
+ */
+static size_t walk(const AlgFindArg_t *arg, bool count_all)
+{
+  size_t esize = container_esize(arg->container);
+  size_t index = 0;
+  size_t count = 0;
+
+  container_cursor_t cursor = container_cursor(arg->container, 0);
+  for (; container_cursor_valid(&cursor); container_cursor_next(&cursor), index++)
+  {
+    const void *element = container_cursor_cdata(&cursor);
+    bool matched = (NULL != arg->match) ? arg->match(element, esize) : (0 == memcmp(element, arg->value, esize));
+
+    if (matched && !count_all)
+    {
+      return index;
+    }
+
+    count += matched;
+  }
+
+  return (count_all) ? count : index;
+}
+
+/*
+ * Finds or counts the elements in the storage of the vector based container or walks the linked list.
+ */
+static size_t scan(const AlgFindArg_t *arg, bool count_all)
+{
+  UC_ASSERT(arg->container && "Invalid argument: container");
+  UC_ASSERT((arg->value || arg->match) && "Invalid argument: value");
+
+  const uint8_t *arr = (const uint8_t *)container_cdata(arg->container);
+  if (NULL == arr || NULL != arg->match)
+  {
+    return walk(arg, count_all);
+  }
+
+  size_t size = container_size(arg->container);
+  size_t esize = container_esize(arg->container);
+
+  return (count_all) ? count_in_array(arr, size, arg->value, esize) : find_in_array(arr, size, arg->value, esize);
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * Returns the index of the first element equal to the value.
+ *
+ * Detailed description see in uc_find.h
+ */
+size_t uc_find_base(AlgFindArg_t arg)
+{
+  UC_ASSERT(arg.value && "Invalid argument: value");
+
+  arg.match = NULL;
+  return scan(&arg, false);
+}
+
+/**
+ * Returns the index of the first element selected by the predicate.
+ *
+ * Detailed description see in uc_find.h
+ */
+size_t uc_find_if_base(AlgFindArg_t arg)
+{
+  UC_ASSERT(arg.match && "Invalid argument: match");
+
+  return scan(&arg, false);
+}
+
+/**
+ * Returns the number of the elements equal to the value or selected by the predicate.
+ *
+ * Detailed description see in uc_find.h
+ */
+size_t uc_count_base(AlgFindArg_t arg)
+{
+  return scan(&arg, true);
+}
+
+/**
+ * Checks if the container holds an element equal to the value.
+ *
+ * Detailed description see in uc_find.h
+ */
+bool uc_contains_base(AlgFindArg_t arg)
+{
+  return uc_find_base(arg) < container_size(arg.container);
+}
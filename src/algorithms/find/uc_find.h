@@ -0,0 +1,105 @@
+/**
+ * @file    uc_find.h
+ * @author  Aliaksander Kavalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Linear search of the elements: find, find_if, count and contains.
+ * @date    2023-10-13
+ *
+ * This header file provides the functions which scan the whole container:
+ * - `uc_find` returns the index of the first element equal to the value.
+ * - `uc_find_if` returns the index of the first element selected by the predicate.
+ * - `uc_count` returns the number of the elements equal to the value or selected by the predicate.
+ * - `uc_contains` checks if the container holds an element equal to the value.
+ *
+ * The elements are equal if they are equal byte by byte. The storage of the vector based containers
+ * with 1, 2, 4 or 8 bytes elements is scanned by SIMD instructions (AVX2 or SSE2, depending on
+ * the target of the compiler) with the scalar fallback for other targets. The linked list based containers
+ * are walked by the cursor.
+ */
+
+#pragma once
+
+//_____ I N C L U D E S _______________________________________________________
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "core/container.h"
+//_____ C O N F I G S  ________________________________________________________
+//_____ D E F I N I T I O N S _________________________________________________
+/**
+ * \brief The linear search functions argument structure
+ */
+typedef struct
+{
+  const container_t *container;
+  const void *value;
+  predicate_fn_t match;
+} AlgFindArg_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/* C++ detection */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+  /**
+   * \brief Returns the index of the first element of the container equal to the value.
+   *
+   * \param[in] container container (mandatory argument).
+   * \param[in] value pointer to the searched element (mandatory argument).
+   * \return index of the element or size of the container if the element isn`t found
+   */
+  size_t uc_find_base(AlgFindArg_t arg);
+
+  /**
+   * \brief Returns the index of the first element of the container selected by the predicate.
+   *
+   * \param[in] container container (mandatory argument).
+   * \param[in] match predicate which selects the element (mandatory argument).
+   * \return index of the element or size of the container if the element isn`t found
+   */
+  size_t uc_find_if_base(AlgFindArg_t arg);
+
+  /**
+   * \brief Returns the number of the elements of the container equal to the value or selected by the predicate.
+   *
+   * \param[in] container container (mandatory argument).
+   * \param[in] value pointer to the counted element. This argument is used if `match` isn`t given.
+   * \param[in] match predicate which selects the counted elements. This argument isn`t mandatory.
+   * \return number of the elements
+   */
+  size_t uc_count_base(AlgFindArg_t arg);
+
+  /**
+   * \brief Checks if the container holds an element equal to the value.
+   *
+   * \param[in] container container (mandatory argument).
+   * \param[in] value pointer to the searched element (mandatory argument).
+   * \return true if the element is found
+   * \return false otherwise
+   */
+  bool uc_contains_base(AlgFindArg_t arg);
+
+  /**
+   * \brief Special macros that allow you to apply default arguments and a variable list of arguments.
+   *
+   * \example
+   *
+   * ```code
+   * size_t index = uc_find(.container = container, .value = &value);
+   * size_t index = uc_find_if(.container = container, .match = is_odd);
+   * size_t number = uc_count(.container = container, .value = &value);
+   * bool found = uc_contains(.container = container, .value = &value);
+   * ```
+   */
+#define uc_find(...)     (uc_find_base((AlgFindArg_t){.container = NULL, .value = NULL, .match = NULL, __VA_ARGS__}))
+
+#define uc_find_if(...)  (uc_find_if_base((AlgFindArg_t){.container = NULL, .value = NULL, .match = NULL, __VA_ARGS__}))
+
+#define uc_count(...)    (uc_count_base((AlgFindArg_t){.container = NULL, .value = NULL, .match = NULL, __VA_ARGS__}))
+
+#define uc_contains(...) (uc_contains_base((AlgFindArg_t){.container = NULL, .value = NULL, .match = NULL, __VA_ARGS__}))
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,180 @@
+/**
+ * @file    uc_key.h
+ * @author  Aliaksander Kavalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Key descriptors and typed comparison kernels for the algorithms.
+ * @date    2023-10-02
+ *
+ * The key descriptor tells an algorithm which part of the element must be compared and what
+ * type it has. Knowing the type the algorithm uses the specialized inline kernel defined in this file
+ * instead of the user callback, so there is no indirect call per comparison and the numbers are compared
+ * by value and not by bytes (`memcmp` gives wrong order for little-endian and signed numbers).
+ *
+ * \example
+ *
+ * ```code
+ * typedef struct { uint32_t id; double weight; } record_t;
+ *
+ * uc_sort(.container = numbers, .key = UC_KEY_I32);
+ * uc_sort(.container = records, .key = UC_KEY_FIELD(record_t, weight, F64));
+ * ```
+ */
+
+#pragma once
+
+//_____ I N C L U D E S _______________________________________________________
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "common/contants.h"
+//_____ C O N F I G S  ________________________________________________________
+//_____ D E F I N I T I O N S _________________________________________________
+/**
+ * \brief List of all supported key types as X-macro: X(NAME, C type).
+ *
+ * The algorithms use this list to generate own specialized routine for every key type.
+ */
+#define UC_KEY_TYPES(X) \
+  X(U8, uint8_t) \
+  X(U16, uint16_t) \
+  X(U32, uint32_t) \
+  X(U64, uint64_t) \
+  X(I8, int8_t) \
+  X(I16, int16_t) \
+  X(I32, int32_t) \
+  X(I64, int64_t) \
+  X(F32, float) \
+  X(F64, double)
+
+/**
+ *  \brief List of supported key types
+ */
+typedef enum
+{
+  UC_KEY_TYPE_NONE = 0, /**< Key isn`t used, the element is compared by callback. */
+#define UC_KEY_TYPE_ENUM(NAME, TYPE) UC_KEY_TYPE_##NAME,
+  UC_KEY_TYPES(UC_KEY_TYPE_ENUM)
+#undef UC_KEY_TYPE_ENUM
+  /* Put new value here */
+  UC_KEY_TYPE_LAST
+} uc_key_type_e;
+
+/**
+ * \brief Key descriptor: type of the key and its offset inside the element (in bytes).
+ */
+typedef struct
+{
+  uc_key_type_e type;
+  size_t offset;
+} uc_key_t;
+
+/**
+ * \brief Typed comparison kernel: has the same prototype as the user callbacks, but the third argument is the key offset.
+ */
+typedef cmp_t (*uc_key_cmp_fn_t)(const void *data1, const void *data2, size_t offset);
+//_____ M A C R O S ___________________________________________________________
+/**
+ * \brief Descriptors for elements which are numbers themselves.
+ */
+#define UC_KEY_NONE ((uc_key_t){.type = UC_KEY_TYPE_NONE, .offset = 0})
+#define UC_KEY_U8   ((uc_key_t){.type = UC_KEY_TYPE_U8, .offset = 0})
+#define UC_KEY_U16  ((uc_key_t){.type = UC_KEY_TYPE_U16, .offset = 0})
+#define UC_KEY_U32  ((uc_key_t){.type = UC_KEY_TYPE_U32, .offset = 0})
+#define UC_KEY_U64  ((uc_key_t){.type = UC_KEY_TYPE_U64, .offset = 0})
+#define UC_KEY_I8   ((uc_key_t){.type = UC_KEY_TYPE_I8, .offset = 0})
+#define UC_KEY_I16  ((uc_key_t){.type = UC_KEY_TYPE_I16, .offset = 0})
+#define UC_KEY_I32  ((uc_key_t){.type = UC_KEY_TYPE_I32, .offset = 0})
+#define UC_KEY_I64  ((uc_key_t){.type = UC_KEY_TYPE_I64, .offset = 0})
+#define UC_KEY_F32  ((uc_key_t){.type = UC_KEY_TYPE_F32, .offset = 0})
+#define UC_KEY_F64  ((uc_key_t){.type = UC_KEY_TYPE_F64, .offset = 0})
+
+/**
+ * \brief Descriptor for the structure field used as key.
+ *
+ * \param STRUCT type of the element.
+ * \param FIELD name of the field.
+ * \param NAME type of the field from the `UC_KEY_TYPES` list: U8, U16, U32, U64, I8, I16, I32, I64, F32, F64.
+ */
+#define UC_KEY_FIELD(STRUCT, FIELD, NAME) ((uc_key_t){.type = UC_KEY_TYPE_##NAME, .offset = offsetof(STRUCT, FIELD)})
+
+/**
+ * \brief Checks that the key descriptor is given.
+ */
+#define UC_KEY_IS_VALID(key) ((key).type > UC_KEY_TYPE_NONE && (key).type < UC_KEY_TYPE_LAST)
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/* C++ detection */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * \brief Typed kernels `uc_key_cmp_<NAME>` and `uc_key_eq_<NAME>` for every key type.
+ *
+ * The kernels have the same argument order as the user callbacks, but the third argument
+ * is the key offset instead of the element size. The key is loaded by `memcpy`, so elements
+ * don`t need to be aligned. NaN values of the floating point keys aren`t ordered.
+ */
+#define UC_KEY_KERNELS(NAME, TYPE) \
+  static inline TYPE uc_key_load_##NAME(const void *data, size_t offset) \
+  { \
+    TYPE value; \
+    memcpy(&value, (const uint8_t *)data + offset, sizeof value); \
+    return value; \
+  } \
+ \
+  static inline cmp_t uc_key_cmp_##NAME(const void *data1, const void *data2, size_t offset) \
+  { \
+    TYPE value1 = uc_key_load_##NAME(data1, offset); \
+    TYPE value2 = uc_key_load_##NAME(data2, offset); \
+    return (cmp_t)((value1 > value2) - (value1 < value2)); \
+  } \
+ \
+  static inline bool uc_key_eq_##NAME(const void *data1, const void *data2, size_t offset) \
+  { \
+    return uc_key_load_##NAME(data1, offset) == uc_key_load_##NAME(data2, offset); \
+  }
+
+  UC_KEY_TYPES(UC_KEY_KERNELS)
+
+#undef UC_KEY_KERNELS
+
+  /**
+   * \brief Returns size of the key (in bytes) or 0 if the key type is unknown.
+   */
+  static inline size_t uc_key_size(uc_key_type_e type)
+  {
+    switch (type)
+    {
+#define UC_KEY_SIZE_CASE(NAME, TYPE) \
+  case UC_KEY_TYPE_##NAME: return sizeof(TYPE);
+      UC_KEY_TYPES(UC_KEY_SIZE_CASE)
+#undef UC_KEY_SIZE_CASE
+      default: return 0;
+    }
+  }
+
+  /**
+   * \brief Returns the comparison kernel of the key type or NULL if the key type is unknown.
+   *
+   * Use it when the kernel is called by pointer; the algorithms which need the inlined comparison
+   * generate own routine for every key type by `UC_KEY_TYPES`.
+   */
+  static inline uc_key_cmp_fn_t uc_key_compare_kernel(uc_key_type_e type)
+  {
+    switch (type)
+    {
+#define UC_KEY_KERNEL_CASE(NAME, TYPE) \
+  case UC_KEY_TYPE_##NAME: return uc_key_cmp_##NAME;
+      UC_KEY_TYPES(UC_KEY_KERNEL_CASE)
+#undef UC_KEY_KERNEL_CASE
+      default: return NULL;
+    }
+  }
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
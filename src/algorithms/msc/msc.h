@@ -31,7 +31,4 @@
 
 void to_string(const container_t *container, char *string);
 
-bool unique(container_t *container);
-bool fill(container_t *container, size_t start, size_t end, void *value);
-container_t *reverse(container_t *container);
 #endif
@@ -0,0 +1,273 @@
+/**
+ * @file    uc_search.c
+ * @author  Aliaksander Kavalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Binary search family for sorted containers.
+ * @date    2023-10-12
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "uc_search.h"
+
+#include <string.h>
+
+#include "common/uc_assert.h"
+//_____ C O N F I G S  ________________________________________________________
+//_____ D E F I N I T I O N S _________________________________________________
+/**
+ * \brief Search context: user callback (param is element size) or key kernel (param is key offset).
+ */
+typedef struct
+{
+  size_t esize;
+  compare_fn_t cmp;
+  size_t param;
+  cmp_t before;
+  const void *value;
+} search_t;
+
+/**
+ * \brief Bound routine over the sorted array: returns the number of the elements placed before the bound.
+ */
+typedef size_t (*bound_fn_t)(const search_t *s, const uint8_t *arr, size_t size);
+//_____ M A C R O S ___________________________________________________________
+/**
+ * \brief True if the element `x` must be placed strictly before the element `y`.
+ */
+#define SEARCH_LESS(x, y) (s->cmp((x), (y), s->param) == s->before)
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+static cmp_t default_compare(const void *value1, const void *value2, size_t esize)
+{
+  int result = memcmp(value1, value2, esize);
+  return (result > 0) ? GT : ((result < 0) ? LE : EQ);
+}
+
+static search_t make_context(const AlgSearchArg_t *arg, size_t esize)
+{
+  search_t context = {
+    .esize = esize,
+    .cmp = (NULL == arg->cmp) ? default_compare : arg->cmp,
+    .param = esize,
+    .before = (arg->order == SORT_ASCENDING) ? LE : GT,
+    .value = arg->value,
+  };
+
+  if (UC_KEY_IS_VALID(arg->key))
+  {
+    UC_ASSERT(arg->key.offset + uc_key_size(arg->key.type) <= esize && "Invalid argument: key");
+    context.cmp = uc_key_compare_kernel(arg->key.type);
+    context.param = arg->key.offset;
+  }
+
+  return context;
+}
+
+/*
+ * Branchless binary search: the range is halved on every step and its base moves forward by the result
+ * of the comparison, so the loop has no data dependent branches and the compiler emits a conditional move.
+ * `upper` is a compile time constant in every instantiation.
+ */
+static inline __attribute__((always_inline)) size_t bound_engine(const search_t *s, const uint8_t *arr, size_t size, bool upper)
+{
+  if (0 == size)
+  {
+    return 0;
+  }
+
+  const uint8_t *base = arr;
+  size_t count = size;
+  while (count > 1)
+  {
+    size_t half = count / 2;
+    const uint8_t *middle = base + half * s->esize;
+    bool right = (upper) ? !SEARCH_LESS(s->value, middle) : SEARCH_LESS(middle, s->value);
+
+    base = (right) ? middle : base;
+    count -= half;
+  }
+
+  bool right = (upper) ? !SEARCH_LESS(s->value, base) : SEARCH_LESS(base, s->value);
+  return (size_t)(base - arr) / s->esize + (size_t)right;
+}
+
+static size_t lower_bound(const search_t *s, const uint8_t *arr, size_t size)
+{
+  return bound_engine(s, arr, size, false);
+}
+
+static size_t upper_bound(const search_t *s, const uint8_t *arr, size_t size)
+{
+  return bound_engine(s, arr, size, true);
+}
+
+/*
+ * Bound routines with the inlined typed comparison: `RIGHT(x, key)` is true if the element with the key `x`
+ * lies before the bound. They are generated for every key type, order and bound.
+ */
+#define SEARCH_KEY_BOUND(NAME, TYPE, BOUND, RIGHT) \
+  static size_t BOUND##_##NAME(const search_t *s, const uint8_t *arr, size_t size) \
+  { \
+    if (0 == size) \
+    { \
+      return 0; \
+    } \
+ \
+    const TYPE key = uc_key_load_##NAME(s->value, s->param); \
+    const uint8_t *base = arr; \
+    size_t count = size; \
+    while (count > 1) \
+    { \
+      size_t half = count / 2; \
+      const uint8_t *middle = base + half * s->esize; \
+      const TYPE x = uc_key_load_##NAME(middle, s->param); \
+      base = (RIGHT) ? middle : base; \
+      count -= half; \
+    } \
+ \
+    const TYPE x = uc_key_load_##NAME(base, s->param); \
+    return (size_t)(base - arr) / s->esize + (size_t)(RIGHT); \
+  }
+
+#define SEARCH_KEY_BOUNDS(NAME, TYPE) \
+  SEARCH_KEY_BOUND(NAME, TYPE, lower_ascending, (x < key)) \
+  SEARCH_KEY_BOUND(NAME, TYPE, upper_ascending, !(key < x)) \
+  SEARCH_KEY_BOUND(NAME, TYPE, lower_descending, (key < x)) \
+  SEARCH_KEY_BOUND(NAME, TYPE, upper_descending, !(x < key))
+
+UC_KEY_TYPES(SEARCH_KEY_BOUNDS)
+
+#undef SEARCH_KEY_BOUNDS
+#undef SEARCH_KEY_BOUND
+
+#define KEY_LOWER_ASCENDING(NAME, TYPE)  [UC_KEY_TYPE_##NAME] = lower_ascending_##NAME,
+#define KEY_UPPER_ASCENDING(NAME, TYPE)  [UC_KEY_TYPE_##NAME] = upper_ascending_##NAME,
+#define KEY_LOWER_DESCENDING(NAME, TYPE) [UC_KEY_TYPE_##NAME] = lower_descending_##NAME,
+#define KEY_UPPER_DESCENDING(NAME, TYPE) [UC_KEY_TYPE_##NAME] = upper_descending_##NAME,
+/* Indexed by the order, then by the bound (false - lower, true - upper) and by the key type */
+static const bound_fn_t key_bounds_callbacks[2][2][UC_KEY_TYPE_LAST] = {
+  [SORT_ASCENDING] = {{UC_KEY_TYPES(KEY_LOWER_ASCENDING)}, {UC_KEY_TYPES(KEY_UPPER_ASCENDING)}},
+  [SORT_DESCENDING] = {{UC_KEY_TYPES(KEY_LOWER_DESCENDING)}, {UC_KEY_TYPES(KEY_UPPER_DESCENDING)}},
+};
+#undef KEY_LOWER_ASCENDING
+#undef KEY_UPPER_ASCENDING
+#undef KEY_LOWER_DESCENDING
+#undef KEY_UPPER_DESCENDING
+
+/*
+ * Binary search over the container with O(1) access by the index but without the contiguous storage
+ * (tiered vector based), the elements are accessed by `container_cpeek`.
+ */
+static size_t peek_bound(const search_t *s, const container_t *container, size_t size, bool upper)
+{
+  size_t first = 0;
+  size_t count = size;
+  while (count > 0)
+  {
+    size_t half = count / 2;
+    const void *middle = container_cpeek(container, first + half);
+    bool right = (upper) ? !SEARCH_LESS(s->value, middle) : SEARCH_LESS(middle, s->value);
+
+    first = (right) ? first + half + 1 : first;
+    count = (right) ? count - half - 1 : half;
+  }
+
+  return first;
+}
+
+/*
+ * Finds the bound in the storage of the vector based container, by the indexed access to the tiered vector
+ * based container or walks the list based containers until the first element which doesn`t lie before the bound.
+ */
+static size_t find_bound(const AlgSearchArg_t *arg, bool upper)
+{
+  UC_ASSERT(arg->container && "Invalid argument: container");
+  UC_ASSERT(arg->value && "Invalid argument: value");
+
+  size_t size = container_size(arg->container);
+  size_t esize = container_esize(arg->container);
+  search_t context = make_context(arg, esize);
+  const search_t *s = &context;
+
+  const uint8_t *arr = (const uint8_t *)container_cdata(arg->container);
+  if (NULL != arr)
+  {
+    if (UC_KEY_IS_VALID(arg->key))
+    {
+      return key_bounds_callbacks[arg->order][upper][arg->key.type](s, arr, size);
+    }
+
+    return (upper) ? upper_bound(s, arr, size) : lower_bound(s, arr, size);
+  }
+
+  if (container_random_access(arg->container))
+  {
+    return peek_bound(s, arg->container, size, upper);
+  }
+
+  size_t index = 0;
+  container_cursor_t cursor = container_cursor(arg->container, 0);
+  for (; container_cursor_valid(&cursor); container_cursor_next(&cursor), index++)
+  {
+    const void *element = container_cursor_cdata(&cursor);
+    if ((upper) ? SEARCH_LESS(s->value, element) : !SEARCH_LESS(element, s->value))
+    {
+      break;
+    }
+  }
+
+  return index;
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * Returns the index of the first element which isn`t placed before the value.
+ *
+ * Detailed description see in uc_search.h
+ */
+size_t uc_lower_bound_base(AlgSearchArg_t arg)
+{
+  return find_bound(&arg, false);
+}
+
+/**
+ * Returns the index of the first element which is placed after the value.
+ *
+ * Detailed description see in uc_search.h
+ */
+size_t uc_upper_bound_base(AlgSearchArg_t arg)
+{
+  return find_bound(&arg, true);
+}
+
+/**
+ * Returns the range of the elements which are equal to the value.
+ *
+ * Detailed description see in uc_search.h
+ */
+uc_range_t uc_equal_range_base(AlgSearchArg_t arg)
+{
+  uc_range_t range = {
+    .first = find_bound(&arg, false),
+    .last = find_bound(&arg, true),
+  };
+
+  return range;
+}
+
+/**
+ * Checks if the container holds an element equal to the value.
+ *
+ * Detailed description see in uc_search.h
+ */
+bool uc_binary_search_base(AlgSearchArg_t arg)
+{
+  size_t index = find_bound(&arg, false);
+  if (index >= container_size(arg.container))
+  {
+    return false;
+  }
+
+  search_t context = make_context(&arg, container_esize(arg.container));
+  const search_t *s = &context;
+
+  return !SEARCH_LESS(s->value, container_cpeek(arg.container, index));
+}
@@ -0,0 +1,146 @@
+/**
+ * @file    uc_search.h
+ * @author  Aliaksander Kavalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Binary search family for sorted containers.
+ * @date    2023-10-12
+ *
+ * This header file provides the functions which find a value in the container sorted by `uc_sort`
+ * with the same `order`, `cmp` and `key` arguments:
+ * - `uc_lower_bound` returns the index of the first element which isn`t placed before the value.
+ * - `uc_upper_bound` returns the index of the first element which is placed after the value.
+ * - `uc_equal_range` returns both bounds, i.e. the range of the elements equal to the value.
+ * - `uc_binary_search` checks if the container holds an element equal to the value.
+ *
+ * The vector based containers are searched in O(log N) comparisons by the branchless binary search
+ * over their storage; with a `key` the comparison is inlined. The tiered vector based containers are searched
+ * in O(log N) comparisons by the indexed access. The list based containers have no random access,
+ * so they are walked in O(N).
+ */
+
+#pragma once
+
+//_____ I N C L U D E S _______________________________________________________
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "algorithms/key/uc_key.h"
+#include "algorithms/sort/uc_sort.h"
+#include "core/container.h"
+//_____ C O N F I G S  ________________________________________________________
+//_____ D E F I N I T I O N S _________________________________________________
+/**
+ * \brief Range of the indexes [first, last) of the container.
+ */
+typedef struct
+{
+  size_t first;
+  size_t last;
+} uc_range_t;
+
+/**
+ * \brief The search functions argument structure
+ */
+typedef struct
+{
+  const container_t *container;
+  const void *value;
+  ContainerSortOrder_e order;
+  compare_fn_t cmp;
+  uc_key_t key;
+} AlgSearchArg_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/* C++ detection */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+  /**
+   * \brief Returns the index of the first element of the sorted container which isn`t placed before the value.
+   *
+   * \param[in] container container sorted by the same `order`, `cmp` and `key` (mandatory argument).
+   * \param[in] value pointer to the searched element (mandatory argument). With the `key` argument only
+   *   the key field of the element is used.
+   * \param[in] order order of the container see @ContainerSortOrder_e. This argument isn`t mandatory.
+   * \param[in] cmp callback fuction which will be used for comparing. This argument isn`t mandatory. In case if user do not give
+   *   this argument the default comparision function will be used.
+   * \param[in] key key descriptor see @uc_key_t. This argument isn`t mandatory.
+   * \return index of the element or size of the container if all elements are placed before the value
+   */
+  size_t uc_lower_bound_base(AlgSearchArg_t arg);
+
+  /**
+   * \brief Returns the index of the first element of the sorted container which is placed after the value.
+   *
+   * Arguments are the same as for `uc_lower_bound`.
+   *
+   * \return index of the element or size of the container if no element is placed after the value
+   */
+  size_t uc_upper_bound_base(AlgSearchArg_t arg);
+
+  /**
+   * \brief Returns the range of the elements of the sorted container which are equal to the value.
+   *
+   * Arguments are the same as for `uc_lower_bound`.
+   *
+   * \return range [lower bound, upper bound); the range is empty if the value isn`t found
+   */
+  uc_range_t uc_equal_range_base(AlgSearchArg_t arg);
+
+  /**
+   * \brief Checks if the sorted container holds an element equal to the value.
+   *
+   * Arguments are the same as for `uc_lower_bound`.
+   *
+   * \return true if the element is found
+   * \return false otherwise
+   */
+  bool uc_binary_search_base(AlgSearchArg_t arg);
+
+  /**
+   * \brief Special macros that allow you to apply default arguments and a variable list of arguments.
+   *
+   * \example
+   *
+   * ```code
+   * size_t index = uc_lower_bound(.container = container, .value = &value, .key = UC_KEY_U32);
+   * uc_range_t range = uc_equal_range(.container = records, .value = &record, .key = UC_KEY_FIELD(record_t, weight, F64));
+   * bool found = uc_binary_search(.container = container, .value = &value, .order = SORT_DESCENDING, .cmp = compare);
+   * ```
+   */
+#define uc_lower_bound(...) \
+  (uc_lower_bound_base((AlgSearchArg_t){.container = NULL, \
+                                        .value = NULL, \
+                                        .order = SORT_ASCENDING, \
+                                        .cmp = NULL, \
+                                        .key = UC_KEY_NONE, \
+                                        __VA_ARGS__}))
+
+#define uc_upper_bound(...) \
+  (uc_upper_bound_base((AlgSearchArg_t){.container = NULL, \
+                                        .value = NULL, \
+                                        .order = SORT_ASCENDING, \
+                                        .cmp = NULL, \
+                                        .key = UC_KEY_NONE, \
+                                        __VA_ARGS__}))
+
+#define uc_equal_range(...) \
+  (uc_equal_range_base((AlgSearchArg_t){.container = NULL, \
+                                        .value = NULL, \
+                                        .order = SORT_ASCENDING, \
+                                        .cmp = NULL, \
+                                        .key = UC_KEY_NONE, \
+                                        __VA_ARGS__}))
+
+#define uc_binary_search(...) \
+  (uc_binary_search_base((AlgSearchArg_t){.container = NULL, \
+                                          .value = NULL, \
+                                          .order = SORT_ASCENDING, \
+                                          .cmp = NULL, \
+                                          .key = UC_KEY_NONE, \
+                                          __VA_ARGS__}))
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
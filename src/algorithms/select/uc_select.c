@@ -0,0 +1,376 @@
+/**
+ * @file    uc_select.c
+ * @author  Aliaksander Kavalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Selection algorithms: n-th element, partial sort and top-k.
+ * @date    2023-10-11
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "uc_select.h"
+
+#include <string.h>
+
+#include "common/uc_assert.h"
+#include "interface/allocator_if.h"
+//_____ C O N F I G S  ________________________________________________________
+/**
+ * \brief Ranges shorter than this are finished by insertion sort.
+ */
+#define SELECT_INSERTION_THRESHOLD 8
+//_____ D E F I N I T I O N S _________________________________________________
+/**
+ * \brief Comparison context: user callback (param is element size) or key kernel (param is key offset).
+ */
+typedef struct
+{
+  size_t esize;
+  compare_fn_t cmp;
+  size_t param;
+  cmp_t before;
+} select_t;
+
+/**
+ * \brief Selection routine over the array: `param` is the index of n-th element or the number of elements to sort.
+ */
+typedef void (*select_fn_t)(const select_t *s, uint8_t *arr, size_t size, size_t param);
+//_____ M A C R O S ___________________________________________________________
+/**
+ * \brief Pointer to the element with the index `i` of the array `base`.
+ */
+#define SELECT_AT(base, i) ((base) + (i) * s->esize)
+
+/**
+ * \brief True if the element `x` must be placed strictly before the element `y`.
+ */
+#define SELECT_LESS(x, y) (s->cmp((x), (y), s->param) == s->before)
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+static cmp_t default_compare(const void *value1, const void *value2, size_t esize)
+{
+  int result = memcmp(value1, value2, esize);
+  return (result > 0) ? GT : ((result < 0) ? LE : EQ);
+}
+
+static select_t make_context(const AlgSelectArg_t *arg, size_t esize)
+{
+  select_t context = {
+    .esize = esize,
+    .cmp = (NULL == arg->cmp) ? default_compare : arg->cmp,
+    .param = esize,
+    .before = (arg->order == SORT_ASCENDING) ? LE : GT,
+  };
+
+  if (UC_KEY_IS_VALID(arg->key))
+  {
+    UC_ASSERT(arg->key.offset + uc_key_size(arg->key.type) <= esize && "Invalid argument: key");
+    context.cmp = uc_key_compare_kernel(arg->key.type);
+    context.param = arg->key.offset;
+  }
+
+  return context;
+}
+
+static inline void swap_elements(uint8_t *data1, uint8_t *data2, size_t esize)
+{
+  for (size_t i = 0; i < esize; i++)
+  {
+    uint8_t tmp = data1[i];
+    data1[i] = data2[i];
+    data2[i] = tmp;
+  }
+}
+
+/*
+ * The heap keeps on the top the element which is placed last in the sorted order among the heap elements.
+ */
+static void sift_down(const select_t *s, uint8_t *heap, size_t root, size_t size)
+{
+  for (;;)
+  {
+    size_t child = 2 * root + 1;
+    if (child >= size)
+    {
+      break;
+    }
+
+    if (child + 1 < size && SELECT_LESS(SELECT_AT(heap, child), SELECT_AT(heap, child + 1)))
+    {
+      child++;
+    }
+
+    if (!SELECT_LESS(SELECT_AT(heap, root), SELECT_AT(heap, child)))
+    {
+      break;
+    }
+
+    swap_elements(SELECT_AT(heap, root), SELECT_AT(heap, child), s->esize);
+    root = child;
+  }
+}
+
+static void make_heap(const select_t *s, uint8_t *heap, size_t size)
+{
+  for (size_t i = size / 2; i-- > 0;)
+  {
+    sift_down(s, heap, i, size);
+  }
+}
+
+static void sort_heap(const select_t *s, uint8_t *heap, size_t size)
+{
+  for (size_t last = size; last-- > 1;)
+  {
+    swap_elements(SELECT_AT(heap, 0), SELECT_AT(heap, last), s->esize);
+    sift_down(s, heap, 0, last);
+  }
+}
+
+/*
+ * Heap selection: the first `count` elements form a heap, every next element which must be placed before
+ * the top of the heap replaces it. At the end the heap is sorted. O(N*log(count)).
+ */
+static void partial_sort(const select_t *s, uint8_t *arr, size_t size, size_t count)
+{
+  count = (count > size) ? size : count;
+  if (count == 0)
+  {
+    return;
+  }
+
+  make_heap(s, arr, count);
+
+  for (size_t i = count; i < size; i++)
+  {
+    if (SELECT_LESS(SELECT_AT(arr, i), SELECT_AT(arr, 0)))
+    {
+      swap_elements(SELECT_AT(arr, i), SELECT_AT(arr, 0), s->esize);
+      sift_down(s, arr, 0, count);
+    }
+  }
+
+  sort_heap(s, arr, count);
+}
+
+static void insertion_sort(const select_t *s, uint8_t *arr, size_t lo, size_t hi)
+{
+  for (size_t i = lo + 1; i < hi; i++)
+  {
+    for (size_t j = i; j > lo && SELECT_LESS(SELECT_AT(arr, j), SELECT_AT(arr, j - 1)); j--)
+    {
+      swap_elements(SELECT_AT(arr, j), SELECT_AT(arr, j - 1), s->esize);
+    }
+  }
+}
+
+/*
+ * Introselect: quickselect with median of three pivot. The partition stops on the elements equal to the pivot
+ * from both sides, so the ranges with many equal elements are split evenly. If the range doesn`t shrink
+ * fast enough the heap selection is used, which bounds the worst case by O(N*log(N)).
+ */
+static void nth_element(const select_t *s, uint8_t *arr, size_t size, size_t nth)
+{
+  size_t lo = 0;
+  size_t hi = size;
+  size_t depth = 0;
+
+  for (size_t n = size; n > 1; n >>= 1)
+  {
+    depth += 2;
+  }
+
+  while (hi - lo > SELECT_INSERTION_THRESHOLD)
+  {
+    if (0 == depth--)
+    {
+      partial_sort(s, SELECT_AT(arr, lo), hi - lo, nth - lo + 1);
+      return;
+    }
+
+    /* Median of three is moved to the `lo` position */
+    size_t mid = lo + (hi - lo) / 2;
+    if (SELECT_LESS(SELECT_AT(arr, mid), SELECT_AT(arr, lo)))
+    {
+      swap_elements(SELECT_AT(arr, mid), SELECT_AT(arr, lo), s->esize);
+    }
+    if (SELECT_LESS(SELECT_AT(arr, hi - 1), SELECT_AT(arr, mid)))
+    {
+      swap_elements(SELECT_AT(arr, hi - 1), SELECT_AT(arr, mid), s->esize);
+      if (SELECT_LESS(SELECT_AT(arr, mid), SELECT_AT(arr, lo)))
+      {
+        swap_elements(SELECT_AT(arr, mid), SELECT_AT(arr, lo), s->esize);
+      }
+    }
+    swap_elements(SELECT_AT(arr, lo), SELECT_AT(arr, mid), s->esize);
+
+    uint8_t *pivot = SELECT_AT(arr, lo);
+    size_t i = lo;
+    size_t j = hi;
+    for (;;)
+    {
+      do
+      {
+        i++;
+      } while (i < hi && SELECT_LESS(SELECT_AT(arr, i), pivot));
+
+      do
+      {
+        j--;
+      } while (SELECT_LESS(pivot, SELECT_AT(arr, j)));
+
+      if (i >= j)
+      {
+        break;
+      }
+
+      swap_elements(SELECT_AT(arr, i), SELECT_AT(arr, j), s->esize);
+    }
+    swap_elements(pivot, SELECT_AT(arr, j), s->esize);
+
+    if (nth == j)
+    {
+      return;
+    }
+
+    if (nth < j)
+    {
+      hi = j;
+    }
+    else
+    {
+      lo = j + 1;
+    }
+  }
+
+  insertion_sort(s, arr, lo, hi);
+}
+
+/*
+ * Runs the algorithm over the storage of the vector based container or over the temporary copy
+ * of the linked list based container, which is gathered and written back by the cursors.
+ */
+static bool run_select(const AlgSelectArg_t *arg, select_fn_t algorithm, size_t param)
+{
+  size_t size = container_size(arg->container);
+  size_t esize = container_esize(arg->container);
+  select_t context = make_context(arg, esize);
+
+  uint8_t *arr = (uint8_t *)container_data(arg->container);
+  if (NULL != arr)
+  {
+    algorithm(&context, arr, size, param);
+    return true;
+  }
+
+  /* The elements of the read-only view can`t be written back */
+  container_cursor_t cursor = container_cursor(arg->container, 0);
+  if (NULL == container_cursor_data(&cursor))
+  {
+    return false;
+  }
+
+  allocate_fn_t mem_allocate = get_allocator();
+  free_fn_t mem_free = get_free();
+
+  arr = (uint8_t *)mem_allocate(size * esize);
+  if (NULL == arr)
+  {
+    return false;
+  }
+
+  for (size_t i = 0; container_cursor_valid(&cursor); container_cursor_next(&cursor), i++)
+  {
+    memcpy(&arr[i * esize], container_cursor_cdata(&cursor), esize);
+  }
+
+  algorithm(&context, arr, size, param);
+
+  cursor = container_cursor(arg->container, 0);
+  for (size_t i = 0; container_cursor_valid(&cursor); container_cursor_next(&cursor), i++)
+  {
+    memcpy(container_cursor_data(&cursor), &arr[i * esize], esize);
+  }
+
+  mem_free(arr);
+  return true;
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * Places the n-th element to its sorted position.
+ *
+ * Detailed description see in uc_select.h
+ */
+bool uc_nth_element_base(AlgSelectArg_t arg)
+{
+  UC_ASSERT(arg.container && "Invalid argument: container");
+
+  if (arg.nth >= container_size(arg.container))
+  {
+    return false;
+  }
+
+  return run_select(&arg, nth_element, arg.nth);
+}
+
+/**
+ * Sorts the first elements of the container.
+ *
+ * Detailed description see in uc_select.h
+ */
+bool uc_partial_sort_base(AlgSelectArg_t arg)
+{
+  UC_ASSERT(arg.container && "Invalid argument: container");
+
+  if (0 == arg.count || container_size(arg.container) < 2)
+  {
+    return true;
+  }
+
+  return run_select(&arg, partial_sort, arg.count);
+}
+
+/**
+ * Copies the first elements of the sorted order into the buffer.
+ *
+ * Detailed description see in uc_select.h
+ */
+bool uc_top_k_base(AlgSelectArg_t arg)
+{
+  UC_ASSERT(arg.container && "Invalid argument: container");
+  UC_ASSERT(arg.output && "Invalid argument: output");
+
+  size_t esize = container_esize(arg.container);
+  if (arg.count > container_size(arg.container))
+  {
+    return false;
+  }
+
+  if (0 == arg.count)
+  {
+    return true;
+  }
+
+  select_t context = make_context(&arg, esize);
+  const select_t *s = &context;
+  uint8_t *heap = (uint8_t *)arg.output;
+
+  container_cursor_t cursor = container_cursor(arg.container, 0);
+  for (size_t i = 0; i < arg.count; container_cursor_next(&cursor), i++)
+  {
+    memcpy(SELECT_AT(heap, i), container_cursor_cdata(&cursor), esize);
+  }
+
+  make_heap(s, heap, arg.count);
+
+  for (; container_cursor_valid(&cursor); container_cursor_next(&cursor))
+  {
+    const uint8_t *data = (const uint8_t *)container_cursor_cdata(&cursor);
+    if (SELECT_LESS(data, SELECT_AT(heap, 0)))
+    {
+      memcpy(SELECT_AT(heap, 0), data, esize);
+      sift_down(s, heap, 0, arg.count);
+    }
+  }
+
+  sort_heap(s, heap, arg.count);
+  return true;
+}
@@ -0,0 +1,142 @@
+/**
+ * @file    uc_select.h
+ * @author  Aliaksander Kavalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Selection algorithms: n-th element, partial sort and top-k.
+ * @date    2023-10-11
+ *
+ * This header file provides the functions which find only a part of the sorted order
+ * and therefore are cheaper than the full sort:
+ * - `uc_nth_element` places the n-th element to its sorted position in O(N) on average (introselect).
+ * - `uc_partial_sort` sorts the first `count` elements in O(N*log(count)) (heap selection).
+ * - `uc_top_k` copies the first `count` elements of the sorted order into a buffer without changing the container.
+ *
+ * The vector based containers are processed directly in their storage. The elements of the linked list based
+ * containers are gathered into a temporary array and written back (`uc_top_k` only walks the list).
+ * The algorithms aren`t stable: the relative order of the equal elements isn`t preserved.
+ */
+
+#pragma once
+
+//_____ I N C L U D E S _______________________________________________________
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "algorithms/key/uc_key.h"
+#include "algorithms/sort/uc_sort.h"
+#include "core/container.h"
+//_____ C O N F I G S  ________________________________________________________
+//_____ D E F I N I T I O N S _________________________________________________
+/**
+ * \brief The selection functions argument structure
+ */
+typedef struct
+{
+  container_t *container;
+  size_t nth;
+  size_t count;
+  void *output;
+  ContainerSortOrder_e order;
+  compare_fn_t cmp;
+  uc_key_t key;
+} AlgSelectArg_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/* C++ detection */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+  /**
+   * \brief Rearranges the container so that the element at the index `nth` is the one which would be there
+   * in the sorted container, all elements before it aren`t placed after it in the sorted order and all elements
+   * after it aren`t placed before it.
+   *
+   * \param[in] container container (mandatory argument).
+   * \param[in] nth index of the element (mandatory argument).
+   * \param[in] order selected order type see @ContainerSortOrder_e. This argument isn`t mandatory.
+   * \param[in] cmp callback fuction which will be used for comparing. This argument isn`t mandatory. In case if user do not give
+   *   this argument the default comparision function will be used.
+   * \param[in] key key descriptor see @uc_key_t. This argument isn`t mandatory.
+   * \return true if the element is placed
+   * \return false if `nth` is out of the container or fault occur
+   */
+  bool uc_nth_element_base(AlgSelectArg_t arg);
+
+  /**
+   * \brief Rearranges the container so that the first `count` elements are the sorted first elements of the whole
+   * sorted container. The order of the rest elements is unspecified.
+   *
+   * \param[in] container container (mandatory argument).
+   * \param[in] count number of the elements to sort (mandatory argument). If it exceeds the size of the container
+   *   the whole container is sorted.
+   * \param[in] order selected order type see @ContainerSortOrder_e. This argument isn`t mandatory.
+   * \param[in] cmp callback fuction which will be used for comparing. This argument isn`t mandatory.
+   * \param[in] key key descriptor see @uc_key_t. This argument isn`t mandatory.
+   * \return true if the elements are sorted
+   * \return false if fault occur
+   */
+  bool uc_partial_sort_base(AlgSelectArg_t arg);
+
+  /**
+   * \brief Copies the first `count` elements of the sorted order into the buffer. The container isn`t changed.
+   *
+   * The elements in the buffer are sorted. The buffer is used as a heap while the container is walked,
+   * so no additional memory is needed.
+   *
+   * \param[in] container container (mandatory argument).
+   * \param[out] output buffer for `count` elements (mandatory argument).
+   * \param[in] count number of the elements to select (mandatory argument).
+   * \param[in] order selected order type see @ContainerSortOrder_e. This argument isn`t mandatory.
+   *   With the ascending order the smallest elements are selected.
+   * \param[in] cmp callback fuction which will be used for comparing. This argument isn`t mandatory.
+   * \param[in] key key descriptor see @uc_key_t. This argument isn`t mandatory.
+   * \return true if the elements are selected
+   * \return false if `count` exceeds the size of the container
+   */
+  bool uc_top_k_base(AlgSelectArg_t arg);
+
+  /**
+   * \brief Special macros that allow you to apply default arguments and a variable list of arguments.
+   *
+   * \example
+   *
+   * ```code
+   * bool res = uc_nth_element(.container = container, .nth = container_size(container) / 2);
+   * bool res = uc_partial_sort(.container = container, .count = 10, .cmp = compare);
+   * bool res = uc_top_k(.container = container, .output = best, .count = 100, .order = SORT_DESCENDING, .key = UC_KEY_U32);
+   * ```
+   */
+#define uc_nth_element(...) \
+  (uc_nth_element_base((AlgSelectArg_t){.container = NULL, \
+                                        .nth = 0, \
+                                        .count = 0, \
+                                        .output = NULL, \
+                                        .order = SORT_ASCENDING, \
+                                        .cmp = NULL, \
+                                        .key = UC_KEY_NONE, \
+                                        __VA_ARGS__}))
+
+#define uc_partial_sort(...) \
+  (uc_partial_sort_base((AlgSelectArg_t){.container = NULL, \
+                                         .nth = 0, \
+                                         .count = 0, \
+                                         .output = NULL, \
+                                         .order = SORT_ASCENDING, \
+                                         .cmp = NULL, \
+                                         .key = UC_KEY_NONE, \
+                                         __VA_ARGS__}))
+
+#define uc_top_k(...) \
+  (uc_top_k_base((AlgSelectArg_t){.container = NULL, \
+                                  .nth = 0, \
+                                  .count = 0, \
+                                  .output = NULL, \
+                                  .order = SORT_ASCENDING, \
+                                  .cmp = NULL, \
+                                  .key = UC_KEY_NONE, \
+                                  __VA_ARGS__}))
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
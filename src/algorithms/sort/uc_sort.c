@@ -3,20 +3,89 @@
 
 #include "common/uc_assert.h"
 #include "interface/allocator_if.h"
+
+#include "algorithms/key/uc_key.h"
+#include "algorithms/transformation/uc_transformation.h"
 //_____ C O N F I G S  ________________________________________________________
 static void bubble_sort(void *arr, size_t size, size_t esize, compare_fn_t cmp, ContainerSortOrder_e order);
 static void selection_sort(void *arr, size_t size, size_t esize, compare_fn_t cmp, ContainerSortOrder_e order);
+static void tim_sort(void *arr, size_t size, size_t esize, compare_fn_t cmp, ContainerSortOrder_e order);
+
+/**
+ * \brief Minimal length of the run for TimSort. Shorter runs are extended by binary insertion sort.
+ */
+#define TIM_SORT_MIN_MERGE 32
+
+/**
+ * \brief Initial number of consecutive wins of one run after which the merge switches to galloping mode.
+ */
+#define TIM_SORT_MIN_GALLOP 7
+
+/**
+ * \brief Maximal number of pending runs. The lengths of the pending runs grow at least as Fibonacci numbers,
+ * so this value is enough for any array which can be addressed by `size_t`.
+ */
+#define TIM_SORT_MAX_RUNS 85
 //_____ D E F I N I T I O N S _________________________________________________
+/**
+ * \brief Sort routine with the comparison kernel fixed at compile time: `param` is passed to the kernel (key offset or context).
+ */
+typedef void (*key_sort_fn_t)(void *arr, size_t size, size_t esize, size_t offset, ContainerSortOrder_e order);
+
+/**
+ * \brief Comparison used by the sort engines: user callback (param is element size) or key kernel (param is key offset).
+ */
+typedef cmp_t (*kernel_fn_t)(const void *data1, const void *data2, size_t param);
+
+/**
+ * \brief Context of the indirect sort: the elements are compared by the indices in the array `base`.
+ */
+typedef struct
+{
+  const uint8_t *base;
+  size_t esize;
+  kernel_fn_t cmp;
+  size_t param;
+} indirect_t;
+
+/**
+ * \brief State of the TimSort: the array, temporary buffer for the merges and stack of the pending runs.
+ */
+typedef struct
+{
+  uint8_t *arr;
+  size_t esize;
+  cmp_t before;
+  uint8_t *buffer;
+  size_t min_gallop;
+  size_t runs;
+  size_t run_base[TIM_SORT_MAX_RUNS];
+  size_t run_len[TIM_SORT_MAX_RUNS];
+} tim_sort_t;
 //_____ M A C R O S ___________________________________________________________
+/**
+ * \brief Pointer to the element with the index `i` of the array `base`.
+ */
+#define TIM_AT(base, i) ((base) + (ptrdiff_t)(i) * (ptrdiff_t)ts->esize)
+
+/**
+ * \brief True if the element `x` must be placed strictly before the element `y` in the sorted array.
+ */
+#define TIM_LESS(x, y) (cmp((x), (y), param) == ts->before)
 //_____ V A R I A B L E S _____________________________________________________
-static sort_fn_t sorts_callbacks[UC_LAST_TYPE_SORT] = {bubble_sort, selection_sort};
 //_____ P R I V A T E  F U N C T I O N S_______________________________________
 static cmp_t default_compare(const void *value1, const void *value2, size_t esize)
 {
-  return (cmp_t)memcmp(value1, value2, esize);
+  int result = memcmp(value1, value2, esize);
+  return (result > 0) ? GT : ((result < 0) ? LE : EQ);
 }
 
-static void bubble_sort(void *arr, size_t size, size_t esize, compare_fn_t cmp, ContainerSortOrder_e order)
+/*
+ * The engines are always inlined into their callers, so for the key sorts the kernel
+ * is known at compile time and the comparison is inlined as well.
+ */
+static inline __attribute__((always_inline)) void bubble_sort_engine(
+  void *arr, size_t size, size_t esize, kernel_fn_t cmp, size_t param, ContainerSortOrder_e order)
 {
   cmp_t _order = (order == SORT_ASCENDING) ? GT : LE;
   allocate_fn_t mem_allocate = get_allocator();
@@ -31,7 +100,7 @@ static void bubble_sort(void *arr, size_t size, size_t esize, compare_fn_t cmp,
       void *ndata1 = ((uint8_t *)arr + j);
       void *ndata2 = ((uint8_t *)arr + j + esize);
 
-      if (cmp(ndata1, ndata2, esize) == _order)
+      if (cmp(ndata1, ndata2, param) == _order)
       {
         memcpy(tmp, ndata1, esize);
         memcpy(ndata1, ndata2, esize);
@@ -43,7 +112,8 @@ static void bubble_sort(void *arr, size_t size, size_t esize, compare_fn_t cmp,
   mem_free(tmp);
 }
 
-static void selection_sort(void *arr, size_t size, size_t esize, compare_fn_t cmp, ContainerSortOrder_e order)
+static inline __attribute__((always_inline)) void selection_sort_engine(
+  void *arr, size_t size, size_t esize, kernel_fn_t cmp, size_t param, ContainerSortOrder_e order)
 {
   cmp_t _order = (order == SORT_ASCENDING) ? LE : GT;
 
@@ -58,19 +128,17 @@ static void selection_sort(void *arr, size_t size, size_t esize, compare_fn_t cm
     void *data_j = NULL;
     void *data_idx = NULL;
 
-    int j = 0;
-    for (j = i + esize; j < size; j = j + esize)
+    for (size_t j = i + esize; j < size; j = j + esize)
     {
       data_j = ((uint8_t *)arr + j);
       data_idx = ((uint8_t *)arr + min_idx);
 
-      if (cmp(data_j, data_idx, esize) == _order)
+      if (cmp(data_j, data_idx, param) == _order)
       {
         min_idx = j;
       }
     }
 
-    data_j = ((uint8_t *)arr + j);
     data_idx = ((uint8_t *)arr + min_idx);
 
     void *data_i = ((uint8_t *)arr + i);
@@ -79,12 +147,778 @@ static void selection_sort(void *arr, size_t size, size_t esize, compare_fn_t cm
     memcpy(data_i, tmp, esize);
   }
 
-  for (size_t i = 0; i < size - esize; i = i + esize)
+  mem_free(tmp);
+}
+
+static inline void swap_elements(uint8_t *data1, uint8_t *data2, size_t esize)
+{
+  for (size_t i = 0; i < esize; i++)
   {
-    void *data = ((uint8_t *)arr + i);
+    uint8_t tmp = data1[i];
+    data1[i] = data2[i];
+    data2[i] = tmp;
   }
+}
 
-  mem_free(tmp);
+static inline size_t tim_min_run(size_t count)
+{
+  size_t r = 0;
+  while (count >= TIM_SORT_MIN_MERGE)
+  {
+    r |= count & 1;
+    count >>= 1;
+  }
+  return count + r;
+}
+
+/*
+ * Returns the leftmost position in the sorted range `base[0..len)` where `key` can be inserted,
+ * i.e. `base[k - 1] < key <= base[k]`. The search starts at `hint` and gallops by 1, 3, 7, 15... elements.
+ */
+static inline __attribute__((always_inline)) size_t tim_gallop_left(
+  const tim_sort_t *ts, const uint8_t *key, const uint8_t *base, size_t len, size_t hint, kernel_fn_t cmp, size_t param)
+{
+  ptrdiff_t last_ofs = 0;
+  ptrdiff_t ofs = 1;
+  ptrdiff_t max_ofs;
+
+  if (TIM_LESS(TIM_AT(base, hint), key))
+  {
+    max_ofs = (ptrdiff_t)(len - hint);
+    while (ofs < max_ofs && TIM_LESS(TIM_AT(base, hint + ofs), key))
+    {
+      last_ofs = ofs;
+      ofs = (ofs << 1) + 1;
+    }
+    ofs = (ofs > max_ofs) ? max_ofs : ofs;
+    last_ofs += hint;
+    ofs += hint;
+  }
+  else
+  {
+    max_ofs = (ptrdiff_t)hint + 1;
+    while (ofs < max_ofs && !TIM_LESS(TIM_AT(base, hint - ofs), key))
+    {
+      last_ofs = ofs;
+      ofs = (ofs << 1) + 1;
+    }
+    ofs = (ofs > max_ofs) ? max_ofs : ofs;
+    ptrdiff_t tmp = last_ofs;
+    last_ofs = (ptrdiff_t)hint - ofs;
+    ofs = (ptrdiff_t)hint - tmp;
+  }
+
+  /* Now base[last_ofs] < key <= base[ofs], so finish by binary search */
+  last_ofs++;
+  while (last_ofs < ofs)
+  {
+    ptrdiff_t m = last_ofs + ((ofs - last_ofs) >> 1);
+    if (TIM_LESS(TIM_AT(base, m), key))
+    {
+      last_ofs = m + 1;
+    }
+    else
+    {
+      ofs = m;
+    }
+  }
+
+  return (size_t)ofs;
+}
+
+/*
+ * Returns the rightmost position in the sorted range `base[0..len)` where `key` can be inserted,
+ * i.e. `base[k - 1] <= key < base[k]`, so the equal elements of the left run stay before the `key`.
+ */
+static inline __attribute__((always_inline)) size_t tim_gallop_right(
+  const tim_sort_t *ts, const uint8_t *key, const uint8_t *base, size_t len, size_t hint, kernel_fn_t cmp, size_t param)
+{
+  ptrdiff_t last_ofs = 0;
+  ptrdiff_t ofs = 1;
+  ptrdiff_t max_ofs;
+
+  if (TIM_LESS(key, TIM_AT(base, hint)))
+  {
+    max_ofs = (ptrdiff_t)hint + 1;
+    while (ofs < max_ofs && TIM_LESS(key, TIM_AT(base, hint - ofs)))
+    {
+      last_ofs = ofs;
+      ofs = (ofs << 1) + 1;
+    }
+    ofs = (ofs > max_ofs) ? max_ofs : ofs;
+    ptrdiff_t tmp = last_ofs;
+    last_ofs = (ptrdiff_t)hint - ofs;
+    ofs = (ptrdiff_t)hint - tmp;
+  }
+  else
+  {
+    max_ofs = (ptrdiff_t)(len - hint);
+    while (ofs < max_ofs && !TIM_LESS(key, TIM_AT(base, hint + ofs)))
+    {
+      last_ofs = ofs;
+      ofs = (ofs << 1) + 1;
+    }
+    ofs = (ofs > max_ofs) ? max_ofs : ofs;
+    last_ofs += hint;
+    ofs += hint;
+  }
+
+  /* Now base[last_ofs] <= key < base[ofs], so finish by binary search */
+  last_ofs++;
+  while (last_ofs < ofs)
+  {
+    ptrdiff_t m = last_ofs + ((ofs - last_ofs) >> 1);
+    if (TIM_LESS(key, TIM_AT(base, m)))
+    {
+      ofs = m;
+    }
+    else
+    {
+      last_ofs = m + 1;
+    }
+  }
+
+  return (size_t)ofs;
+}
+
+/*
+ * Sorts the range [lo, hi) whose prefix [lo, start) is already sorted. The first slot of the buffer is used as pivot.
+ */
+static inline __attribute__((always_inline)) void tim_binary_insertion_sort(
+  tim_sort_t *ts, size_t lo, size_t hi, size_t start, kernel_fn_t cmp, size_t param)
+{
+  uint8_t *pivot = ts->buffer;
+
+  for (; start < hi; start++)
+  {
+    memcpy(pivot, TIM_AT(ts->arr, start), ts->esize);
+
+    size_t left = lo;
+    size_t right = start;
+    while (left < right)
+    {
+      size_t mid = left + ((right - left) >> 1);
+      if (TIM_LESS(pivot, TIM_AT(ts->arr, mid)))
+      {
+        right = mid;
+      }
+      else
+      {
+        left = mid + 1;
+      }
+    }
+
+    memmove(TIM_AT(ts->arr, left + 1), TIM_AT(ts->arr, left), (start - left) * ts->esize);
+    memcpy(TIM_AT(ts->arr, left), pivot, ts->esize);
+  }
+}
+
+/*
+ * Returns length of the natural run which starts at `lo`. Strictly descending run is reversed in place,
+ * the equal elements never form descending run, so the reversing keeps the sort stable.
+ */
+static inline __attribute__((always_inline)) size_t tim_count_run(
+  tim_sort_t *ts, size_t lo, size_t hi, kernel_fn_t cmp, size_t param)
+{
+  size_t run_hi = lo + 1;
+  if (run_hi == hi)
+  {
+    return 1;
+  }
+
+  if (TIM_LESS(TIM_AT(ts->arr, run_hi), TIM_AT(ts->arr, lo)))
+  {
+    run_hi++;
+    while (run_hi < hi && TIM_LESS(TIM_AT(ts->arr, run_hi), TIM_AT(ts->arr, run_hi - 1)))
+    {
+      run_hi++;
+    }
+
+    for (size_t i = lo, j = run_hi - 1; i < j; i++, j--)
+    {
+      swap_elements(TIM_AT(ts->arr, i), TIM_AT(ts->arr, j), ts->esize);
+    }
+  }
+  else
+  {
+    run_hi++;
+    while (run_hi < hi && !TIM_LESS(TIM_AT(ts->arr, run_hi), TIM_AT(ts->arr, run_hi - 1)))
+    {
+      run_hi++;
+    }
+  }
+
+  return run_hi - lo;
+}
+
+/*
+ * Merges two adjacent runs when the left one is shorter: the left run is moved into the buffer
+ * and the merge goes from left to right.
+ */
+static inline __attribute__((always_inline)) void tim_merge_lo(
+  tim_sort_t *ts, size_t base1, size_t len1, size_t base2, size_t len2, kernel_fn_t cmp, size_t param)
+{
+  uint8_t *arr = ts->arr;
+  uint8_t *tmp = ts->buffer;
+  size_t esize = ts->esize;
+  size_t min_gallop = ts->min_gallop;
+  size_t cursor1 = 0;
+  size_t cursor2 = base2;
+  size_t dest = base1;
+
+  memcpy(tmp, TIM_AT(arr, base1), len1 * esize);
+
+  /* The first element of the right run is less than all elements of the left run (see tim_merge_at) */
+  memcpy(TIM_AT(arr, dest++), TIM_AT(arr, cursor2++), esize);
+  if (0 == --len2 || 1 == len1)
+  {
+    goto done;
+  }
+
+  for (;;)
+  {
+    size_t count1 = 0;
+    size_t count2 = 0;
+
+    /* One pair at a time until one run starts winning consistently */
+    do
+    {
+      if (TIM_LESS(TIM_AT(arr, cursor2), TIM_AT(tmp, cursor1)))
+      {
+        memcpy(TIM_AT(arr, dest++), TIM_AT(arr, cursor2++), esize);
+        count2++;
+        count1 = 0;
+        if (0 == --len2)
+        {
+          goto done;
+        }
+      }
+      else
+      {
+        memcpy(TIM_AT(arr, dest++), TIM_AT(tmp, cursor1++), esize);
+        count1++;
+        count2 = 0;
+        if (1 == --len1)
+        {
+          goto done;
+        }
+      }
+    } while ((count1 | count2) < min_gallop);
+
+    /* Galloping: copy whole blocks found by exponential search until it stops paying off */
+    do
+    {
+      count1 = tim_gallop_right(ts, TIM_AT(arr, cursor2), TIM_AT(tmp, cursor1), len1, 0, cmp, param);
+      if (count1)
+      {
+        memcpy(TIM_AT(arr, dest), TIM_AT(tmp, cursor1), count1 * esize);
+        dest += count1;
+        cursor1 += count1;
+        len1 -= count1;
+        if (len1 <= 1)
+        {
+          goto done;
+        }
+      }
+      memcpy(TIM_AT(arr, dest++), TIM_AT(arr, cursor2++), esize);
+      if (0 == --len2)
+      {
+        goto done;
+      }
+
+      count2 = tim_gallop_left(ts, TIM_AT(tmp, cursor1), TIM_AT(arr, cursor2), len2, 0, cmp, param);
+      if (count2)
+      {
+        memmove(TIM_AT(arr, dest), TIM_AT(arr, cursor2), count2 * esize);
+        dest += count2;
+        cursor2 += count2;
+        len2 -= count2;
+        if (0 == len2)
+        {
+          goto done;
+        }
+      }
+      memcpy(TIM_AT(arr, dest++), TIM_AT(tmp, cursor1++), esize);
+      if (1 == --len1)
+      {
+        goto done;
+      }
+
+      min_gallop -= (min_gallop > 1);
+    } while (count1 >= TIM_SORT_MIN_GALLOP || count2 >= TIM_SORT_MIN_GALLOP);
+
+    min_gallop++;
+  }
+
+done:
+  ts->min_gallop = min_gallop;
+  /* Either the right run is exhausted, or the last element of the left run is greater than the rest of the right run */
+  memmove(TIM_AT(arr, dest), TIM_AT(arr, cursor2), len2 * esize);
+  memcpy(TIM_AT(arr, dest + len2), TIM_AT(tmp, cursor1), len1 * esize);
+}
+
+/*
+ * Merges two adjacent runs when the right one is shorter: the right run is moved into the buffer
+ * and the merge goes from right to left.
+ */
+static inline __attribute__((always_inline)) void tim_merge_hi(
+  tim_sort_t *ts, size_t base1, size_t len1, size_t base2, size_t len2, kernel_fn_t cmp, size_t param)
+{
+  uint8_t *arr = ts->arr;
+  uint8_t *tmp = ts->buffer;
+  size_t esize = ts->esize;
+  size_t min_gallop = ts->min_gallop;
+  ptrdiff_t cursor1 = (ptrdiff_t)(base1 + len1) - 1;
+  ptrdiff_t cursor2 = (ptrdiff_t)len2 - 1;
+  ptrdiff_t dest = (ptrdiff_t)(base2 + len2) - 1;
+
+  memcpy(tmp, TIM_AT(arr, base2), len2 * esize);
+
+  /* The last element of the left run is greater than all elements of the right run (see tim_merge_at) */
+  memcpy(TIM_AT(arr, dest--), TIM_AT(arr, cursor1--), esize);
+  if (0 == --len1 || 1 == len2)
+  {
+    goto done;
+  }
+
+  for (;;)
+  {
+    size_t count1 = 0;
+    size_t count2 = 0;
+
+    do
+    {
+      if (TIM_LESS(TIM_AT(tmp, cursor2), TIM_AT(arr, cursor1)))
+      {
+        memcpy(TIM_AT(arr, dest--), TIM_AT(arr, cursor1--), esize);
+        count1++;
+        count2 = 0;
+        if (0 == --len1)
+        {
+          goto done;
+        }
+      }
+      else
+      {
+        memcpy(TIM_AT(arr, dest--), TIM_AT(tmp, cursor2--), esize);
+        count2++;
+        count1 = 0;
+        if (1 == --len2)
+        {
+          goto done;
+        }
+      }
+    } while ((count1 | count2) < min_gallop);
+
+    do
+    {
+      count1 = len1 - tim_gallop_right(ts, TIM_AT(tmp, cursor2), TIM_AT(arr, base1), len1, len1 - 1, cmp, param);
+      if (count1)
+      {
+        dest -= count1;
+        cursor1 -= count1;
+        memmove(TIM_AT(arr, dest + 1), TIM_AT(arr, cursor1 + 1), count1 * esize);
+        len1 -= count1;
+        if (0 == len1)
+        {
+          goto done;
+        }
+      }
+      memcpy(TIM_AT(arr, dest--), TIM_AT(tmp, cursor2--), esize);
+      if (1 == --len2)
+      {
+        goto done;
+      }
+
+      count2 = len2 - tim_gallop_left(ts, TIM_AT(arr, cursor1), tmp, len2, len2 - 1, cmp, param);
+      if (count2)
+      {
+        dest -= count2;
+        cursor2 -= count2;
+        memcpy(TIM_AT(arr, dest + 1), TIM_AT(tmp, cursor2 + 1), count2 * esize);
+        len2 -= count2;
+        if (len2 <= 1)
+        {
+          goto done;
+        }
+      }
+      memcpy(TIM_AT(arr, dest--), TIM_AT(arr, cursor1--), esize);
+      if (0 == --len1)
+      {
+        goto done;
+      }
+
+      min_gallop -= (min_gallop > 1);
+    } while (count1 >= TIM_SORT_MIN_GALLOP || count2 >= TIM_SORT_MIN_GALLOP);
+
+    min_gallop++;
+  }
+
+done:
+  ts->min_gallop = min_gallop;
+  /* Either the left run is exhausted, or the first element of the right run is less than the rest of the left run */
+  dest -= len1;
+  cursor1 -= len1;
+  memmove(TIM_AT(arr, dest + 1), TIM_AT(arr, cursor1 + 1), len1 * esize);
+  memcpy(TIM_AT(arr, dest + 1 - (ptrdiff_t)len2), tmp, len2 * esize);
+}
+
+/*
+ * Merges the pending runs `i` and `i + 1`. The elements which are already in place are skipped by galloping
+ * before the merge, so two runs which are already in order are merged by two searches without any copying.
+ */
+static inline __attribute__((always_inline)) void tim_merge_at(tim_sort_t *ts, size_t i, kernel_fn_t cmp, size_t param)
+{
+  size_t base1 = ts->run_base[i];
+  size_t len1 = ts->run_len[i];
+  size_t base2 = ts->run_base[i + 1];
+  size_t len2 = ts->run_len[i + 1];
+
+  ts->run_len[i] = len1 + len2;
+  if (i + 3 == ts->runs)
+  {
+    ts->run_base[i + 1] = ts->run_base[i + 2];
+    ts->run_len[i + 1] = ts->run_len[i + 2];
+  }
+  ts->runs--;
+
+  size_t k = tim_gallop_right(ts, TIM_AT(ts->arr, base2), TIM_AT(ts->arr, base1), len1, 0, cmp, param);
+  base1 += k;
+  len1 -= k;
+  if (0 == len1)
+  {
+    return;
+  }
+
+  len2 = tim_gallop_left(ts, TIM_AT(ts->arr, base1 + len1 - 1), TIM_AT(ts->arr, base2), len2, len2 - 1, cmp, param);
+  if (0 == len2)
+  {
+    return;
+  }
+
+  if (len1 <= len2)
+  {
+    tim_merge_lo(ts, base1, len1, base2, len2, cmp, param);
+  }
+  else
+  {
+    tim_merge_hi(ts, base1, len1, base2, len2, cmp, param);
+  }
+}
+
+/*
+ * Keeps the invariants of the run stack: len[n - 2] > len[n - 1] + len[n] and len[n - 1] > len[n].
+ * The check of the two topmost triples fixes the known flaw of the original TimSort invariant.
+ */
+static inline __attribute__((always_inline)) void tim_merge_collapse(tim_sort_t *ts, kernel_fn_t cmp, size_t param)
+{
+  while (ts->runs > 1)
+  {
+    size_t n = ts->runs - 2;
+    size_t *len = ts->run_len;
+
+    if ((n > 0 && len[n - 1] <= len[n] + len[n + 1]) || (n > 1 && len[n - 2] <= len[n - 1] + len[n]))
+    {
+      if (len[n - 1] < len[n + 1])
+      {
+        n--;
+      }
+    }
+    else if (len[n] > len[n + 1])
+    {
+      break;
+    }
+
+    tim_merge_at(ts, n, cmp, param);
+  }
+}
+
+static inline __attribute__((always_inline)) void tim_merge_force_collapse(tim_sort_t *ts, kernel_fn_t cmp, size_t param)
+{
+  while (ts->runs > 1)
+  {
+    size_t n = ts->runs - 2;
+    if (n > 0 && ts->run_len[n - 1] < ts->run_len[n + 1])
+    {
+      n--;
+    }
+
+    tim_merge_at(ts, n, cmp, param);
+  }
+}
+
+/*
+ * Adaptive stable sort: the array is split into natural runs (descending runs are reversed), short runs are
+ * extended by binary insertion sort and the runs are merged with galloping. Sorted or nearly sorted input
+ * costs O(N) comparisons, random input O(N*log(N)). Temporary buffer holds a half of the array.
+ */
+static inline __attribute__((always_inline)) void tim_sort_engine(
+  void *arr, size_t size, size_t esize, kernel_fn_t cmp, size_t param, ContainerSortOrder_e order)
+{
+  size_t count = size / esize;
+  if (count < 2)
+  {
+    return;
+  }
+
+  allocate_fn_t mem_allocate = get_allocator();
+  free_fn_t mem_free = get_free();
+
+  tim_sort_t state = {
+    .arr = (uint8_t *)arr,
+    .esize = esize,
+    .before = (order == SORT_ASCENDING) ? LE : GT,
+    .buffer = (uint8_t *)mem_allocate((count / 2 + 1) * esize),
+    .min_gallop = TIM_SORT_MIN_GALLOP,
+    .runs = 0,
+  };
+  tim_sort_t *ts = &state;
+
+  if (NULL == ts->buffer)
+  {
+    /* Stable in-place insertion sort without additional memory, still O(N) for sorted input */
+    for (size_t i = 1; i < count; i++)
+    {
+      for (size_t j = i; j > 0 && TIM_LESS(TIM_AT(ts->arr, j), TIM_AT(ts->arr, j - 1)); j--)
+      {
+        swap_elements(TIM_AT(ts->arr, j), TIM_AT(ts->arr, j - 1), esize);
+      }
+    }
+    return;
+  }
+
+  size_t min_run = tim_min_run(count);
+  size_t lo = 0;
+  size_t remaining = count;
+
+  do
+  {
+    size_t run = tim_count_run(ts, lo, count, cmp, param);
+    if (run < min_run)
+    {
+      size_t force = (remaining < min_run) ? remaining : min_run;
+      tim_binary_insertion_sort(ts, lo, lo + force, lo + run, cmp, param);
+      run = force;
+    }
+
+    ts->run_base[ts->runs] = lo;
+    ts->run_len[ts->runs] = run;
+    ts->runs++;
+    tim_merge_collapse(ts, cmp, param);
+
+    lo += run;
+    remaining -= run;
+  } while (remaining);
+
+  tim_merge_force_collapse(ts, cmp, param);
+
+  mem_free(ts->buffer);
+}
+
+static void bubble_sort(void *arr, size_t size, size_t esize, compare_fn_t cmp, ContainerSortOrder_e order)
+{
+  bubble_sort_engine(arr, size, esize, cmp, esize, order);
+}
+
+static void selection_sort(void *arr, size_t size, size_t esize, compare_fn_t cmp, ContainerSortOrder_e order)
+{
+  selection_sort_engine(arr, size, esize, cmp, esize, order);
+}
+
+static void tim_sort(void *arr, size_t size, size_t esize, compare_fn_t cmp, ContainerSortOrder_e order)
+{
+  tim_sort_engine(arr, size, esize, cmp, esize, order);
+}
+
+/*
+ * Kernel of the indirect sort: the array being sorted holds indices of the elements, `param` is the context.
+ */
+static cmp_t indirect_compare(const void *index1, const void *index2, size_t param)
+{
+  const indirect_t *context = (const indirect_t *)(uintptr_t)param;
+  const uint8_t *data1 = context->base + (*(const size_t *)index1) * context->esize;
+  const uint8_t *data2 = context->base + (*(const size_t *)index2) * context->esize;
+
+  return context->cmp(data1, data2, context->param);
+}
+
+static void bubble_sort_indirect(void *arr, size_t size, size_t esize, size_t param, ContainerSortOrder_e order)
+{
+  bubble_sort_engine(arr, size, esize, indirect_compare, param, order);
+}
+
+static void selection_sort_indirect(void *arr, size_t size, size_t esize, size_t param, ContainerSortOrder_e order)
+{
+  selection_sort_engine(arr, size, esize, indirect_compare, param, order);
+}
+
+static void tim_sort_indirect(void *arr, size_t size, size_t esize, size_t param, ContainerSortOrder_e order)
+{
+  tim_sort_engine(arr, size, esize, indirect_compare, param, order);
+}
+
+#define KEY_SORTS(NAME, TYPE) \
+  static void bubble_sort_##NAME(void *arr, size_t size, size_t esize, size_t offset, ContainerSortOrder_e order) \
+  { \
+    bubble_sort_engine(arr, size, esize, uc_key_cmp_##NAME, offset, order); \
+  } \
+ \
+  static void selection_sort_##NAME(void *arr, size_t size, size_t esize, size_t offset, ContainerSortOrder_e order) \
+  { \
+    selection_sort_engine(arr, size, esize, uc_key_cmp_##NAME, offset, order); \
+  } \
+ \
+  static void tim_sort_##NAME(void *arr, size_t size, size_t esize, size_t offset, ContainerSortOrder_e order) \
+  { \
+    tim_sort_engine(arr, size, esize, uc_key_cmp_##NAME, offset, order); \
+  }
+
+UC_KEY_TYPES(KEY_SORTS)
+#undef KEY_SORTS
+
+static sort_fn_t sorts_callbacks[UC_LAST_TYPE_SORT] = {bubble_sort, selection_sort, tim_sort};
+
+#define KEY_SORT_BUBBLE(NAME, TYPE)    [UC_KEY_TYPE_##NAME] = bubble_sort_##NAME,
+#define KEY_SORT_SELECTION(NAME, TYPE) [UC_KEY_TYPE_##NAME] = selection_sort_##NAME,
+#define KEY_SORT_TIM(NAME, TYPE)       [UC_KEY_TYPE_##NAME] = tim_sort_##NAME,
+static const key_sort_fn_t key_sorts_callbacks[UC_LAST_TYPE_SORT][UC_KEY_TYPE_LAST] = {
+  [UC_BUBBLE_SORT] = {UC_KEY_TYPES(KEY_SORT_BUBBLE)},
+  [UC_SELECTION_SORT] = {UC_KEY_TYPES(KEY_SORT_SELECTION)},
+  [UC_TIM_SORT] = {UC_KEY_TYPES(KEY_SORT_TIM)},
+};
+#undef KEY_SORT_BUBBLE
+#undef KEY_SORT_SELECTION
+#undef KEY_SORT_TIM
+
+static const key_sort_fn_t indirect_sorts_callbacks[UC_LAST_TYPE_SORT] = {bubble_sort_indirect, selection_sort_indirect, tim_sort_indirect};
+
+/*
+ * Fills `indices` by 0..size-1 and sorts them so that `base[indices[i]]` is the i-th element of the sorted array.
+ */
+static void sort_indices(const uint8_t *base,
+                         size_t size,
+                         size_t esize,
+                         size_t *indices,
+                         ContainerSortTypes_e sort,
+                         ContainerSortOrder_e order,
+                         compare_fn_t cmp,
+                         uc_key_t key)
+{
+  indirect_t context = {.base = base, .esize = esize, .cmp = (NULL == cmp) ? default_compare : cmp, .param = esize};
+
+  if (UC_KEY_IS_VALID(key))
+  {
+    UC_ASSERT(key.offset + uc_key_size(key.type) <= esize && "Invalid argument: key");
+    context.cmp = uc_key_compare_kernel(key.type);
+    context.param = key.offset;
+  }
+
+  for (size_t i = 0; i < size; i++)
+  {
+    indices[i] = i;
+  }
+
+  indirect_sorts_callbacks[sort](indices, size * sizeof(size_t), sizeof(size_t), (size_t)(uintptr_t)&context, order);
+}
+
+/*
+ * Rearranges the array so that the new i-th element is the old `indices[i]`-th one. The permutation is applied
+ * cycle by cycle, so every element is copied only once (plus the leader of every cycle via `tmp`).
+ * The `indices` array is destroyed.
+ */
+static void apply_permutation(uint8_t *arr, size_t size, size_t esize, size_t *indices, void *tmp)
+{
+  for (size_t i = 0; i < size; i++)
+  {
+    if (indices[i] == i)
+    {
+      continue;
+    }
+
+    memcpy(tmp, &arr[i * esize], esize);
+
+    size_t j = i;
+    for (;;)
+    {
+      size_t k = indices[j];
+      indices[j] = j;
+      if (k == i)
+      {
+        memcpy(&arr[j * esize], tmp, esize);
+        break;
+      }
+
+      memcpy(&arr[j * esize], &arr[k * esize], esize);
+      j = k;
+    }
+  }
+}
+
+/*
+ * Sorts the array of large elements by the indices and moves every element only once.
+ */
+static bool indirect_sort(uint8_t *arr, size_t size, size_t esize, const AlgSortArg_t *arg)
+{
+  allocate_fn_t mem_allocate = get_allocator();
+  free_fn_t mem_free = get_free();
+
+  size_t *indices = (size_t *)mem_allocate(size * sizeof(size_t) + esize);
+  if (NULL == indices)
+  {
+    return false;
+  }
+
+  sort_indices(arr, size, esize, indices, arg->sort, arg->order, arg->cmp, arg->key);
+  apply_permutation(arr, size, esize, indices, &indices[size]);
+
+  mem_free(indices);
+  return true;
+}
+
+/*
+ * Sorts the container by the indices. The storage of the vector based container is permuted in place, so every
+ * element moves once. The elements of other containers are gathered into a temporary array by the cursors
+ * and every element is written back once to its sorted position.
+ */
+static bool indirect_sort_container(container_t *container, size_t size, size_t esize, const AlgSortArg_t *arg)
+{
+  uint8_t *pool = (uint8_t *)container_data(container);
+  if (NULL != pool)
+  {
+    return indirect_sort(pool, size, esize, arg);
+  }
+
+  container_cursor_t cursor = container_cursor(container, 0);
+  if (NULL == container_cursor_data(&cursor))
+  {
+    return false;
+  }
+
+  allocate_fn_t mem_allocate = get_allocator();
+  free_fn_t mem_free = get_free();
+
+  size_t *indices = (size_t *)mem_allocate(size * (sizeof(size_t) + esize));
+  if (NULL == indices)
+  {
+    return false;
+  }
+
+  uint8_t *arr = (uint8_t *)&indices[size];
+  for (size_t i = 0; i < size; i++, container_cursor_next(&cursor))
+  {
+    memcpy(&arr[i * esize], container_cursor_cdata(&cursor), esize);
+  }
+
+  sort_indices(arr, size, esize, indices, arg->sort, arg->order, arg->cmp, arg->key);
+
+  cursor = container_cursor(container, 0);
+  for (size_t i = 0; i < size; i++, container_cursor_next(&cursor))
+  {
+    memcpy(container_cursor_data(&cursor), &arr[indices[i] * esize], esize);
+  }
+
+  mem_free(indices);
+  return true;
 }
 
 //_____ P U B L I C  F U N C T I O N S_________________________________________
@@ -111,6 +945,11 @@ bool uc_sort_base(AlgSortArg_t arg)
     return true;
   }
 
+  if (arg.indirect)
+  {
+    return indirect_sort_container(arg.container, size, esize, &arg);
+  }
+
   allocate_fn_t mem_allocate = get_allocator();
   free_fn_t mem_free = get_free();
 
@@ -122,18 +961,85 @@ bool uc_sort_base(AlgSortArg_t arg)
     return false;
   }
 
-  bool status1 = uc_to_array(arg.container, arr, arr_size);
+  bool status1 = uc_to_array(arg.container, arr, size);
   if (!status1)
   {
     mem_free(arr);
     return false;
   }
 
-  sort(arr, arr_size, esize, compare, arg.order);
+  if (UC_KEY_IS_VALID(arg.key))
+  {
+    UC_ASSERT(arg.key.offset + uc_key_size(arg.key.type) <= esize && "Invalid argument: key");
+    key_sorts_callbacks[arg.sort][arg.key.type](arr, arr_size, esize, arg.key.offset, arg.order);
+  }
+  else
+  {
+    sort(arr, arr_size, esize, compare, arg.order);
+  }
+
+  /* The read-only view can`t be cleared, so it is left unchanged */
+  if (!container_clear(arg.container))
+  {
+    mem_free(arr);
+    return false;
+  }
 
-  container_clear(arg.container);
-  bool status = uc_from_array(arg.container, arr, arr_size);
+  bool status = uc_from_array(arg.container, arr, size);
 
   mem_free(arr);
   return status;
 }
+
+/**
+ * Computes the permutation which sorts the container without reordering it.
+ *
+ * Detailed description see in uc_sort.h
+ */
+bool uc_argsort_base(AlgArgsortArg_t arg)
+{
+  UC_ASSERT(arg.container && "Invalid argument: container");
+  UC_ASSERT(arg.indices && "Invalid argument: indices");
+  UC_ASSERT(arg.sort < UC_LAST_TYPE_SORT && "Invalid argument: sort");
+
+  size_t size = container_size(arg.container);
+  size_t esize = container_esize(arg.container);
+  UC_ASSERT(esize != 0 && "Size of single element can`t be equal 0!");
+
+  if (size == 0)
+  {
+    return true;
+  }
+
+  free_fn_t mem_free = get_free();
+
+  /* The vector based container is sorted by its own storage, others are copied into temporary array */
+  uint8_t *arr = NULL;
+  const uint8_t *base = (const uint8_t *)container_cdata(arg.container);
+  if (NULL == base)
+  {
+    allocate_fn_t mem_allocate = get_allocator();
+
+    arr = (uint8_t *)mem_allocate(size * esize);
+    if (NULL == arr)
+    {
+      return false;
+    }
+
+    if (!uc_to_array(arg.container, arr, size))
+    {
+      mem_free(arr);
+      return false;
+    }
+    base = arr;
+  }
+
+  sort_indices(base, size, esize, arg.indices, arg.sort, arg.order, arg.cmp, arg.key);
+
+  if (NULL != arr)
+  {
+    mem_free(arr);
+  }
+
+  return true;
+}
@@ -4,6 +4,7 @@
 #include <stdbool.h>
 #include <stddef.h>
 
+#include "algorithms/key/uc_key.h"
 #include "common/contants.h"
 #include "core/container.h"
 //_____ C O N F I G S  ________________________________________________________
@@ -15,6 +16,7 @@ typedef enum tagContainerSortTypesEnum
 {
   UC_BUBBLE_SORT = 0,
   UC_SELECTION_SORT,
+  UC_TIM_SORT, /* Adaptive stable sort: O(N) for sorted or nearly sorted data */
   /* Put new value here */
   UC_LAST_TYPE_SORT
 } ContainerSortTypes_e;
@@ -48,8 +50,20 @@ typedef struct
   ContainerSortTypes_e sort;
   ContainerSortOrder_e order;
   compare_fn_t cmp;
+  uc_key_t key;
+  bool indirect;
 } AlgSortArg_t;
 
+typedef struct
+{
+  const container_t *container;
+  size_t *indices;
+  ContainerSortTypes_e sort;
+  ContainerSortOrder_e order;
+  compare_fn_t cmp;
+  uc_key_t key;
+} AlgArgsortArg_t;
+
 //_____ M A C R O S ___________________________________________________________
 //_____ V A R I A B L E S _____________________________________________________
 //_____ P U B L I C  F U N C T I O N S_________________________________________
@@ -68,11 +82,34 @@ extern "C"
    *   this argument the default order will be used.
    * \param[in] cmp callback fuction which will be used for comparing. This argument isn`t mandatory. In case if user do not give
    *   this argument the default comparision function will be used.
+   * \param[in] key key descriptor see @uc_key_t. This argument isn`t mandatory. If it is given then the elements are
+   *   compared by the typed inline kernel instead of `cmp` callback.
+   * \param[in] indirect indirect sort mode. This argument isn`t mandatory. If it is true then the sort method orders
+   *   an array of indices and the elements are rearranged by a single permutation pass afterwards, so every element
+   *   of the vector based container is moved only once in its storage. The elements of other containers are copied
+   *   into a temporary array and back. Recommended for large elements (structures of hundreds of bytes).
    * \return true if container sorted
    * \return false if fault occur
    */
   bool uc_sort_base(AlgSortArg_t arg);
 
+  /**
+   * \brief Computes the permutation which sorts the container. The container isn`t changed.
+   *
+   * After the call `indices[i]` is the index of the element which would be at the position `i` in the sorted container.
+   *
+   * \param[in] container container (mandatory argument).
+   * \param[out] indices array of `container_size(container)` indices (mandatory argument).
+   * \param[in] sort selected sort method see @ContainerSortTypes_e. This argument isn`t mandatory. By default the stable
+   *   `UC_TIM_SORT` is used, so the indices of equal elements stay in ascending order.
+   * \param[in] order selected order type see @ContainerSortOrder_e. This argument isn`t mandatory.
+   * \param[in] cmp callback fuction which will be used for comparing. This argument isn`t mandatory.
+   * \param[in] key key descriptor see @uc_key_t. This argument isn`t mandatory.
+   * \return true if the permutation is computed
+   * \return false if fault occur
+   */
+  bool uc_argsort_base(AlgArgsortArg_t arg);
+
   /**
    * \brief A special macro that allows you to apply default arguments and a variable list of arguments.
    *
@@ -89,9 +126,46 @@ extern "C"
    * ```code
    * bool res = uc_sort(.container = container, .sort=UC_SELECTION_SORT, .order=SORT_DESCENDING);
    * ```
+   *
+   * or
+   *
+   * ```code
+   * bool res = uc_sort(.container = container, .key = UC_KEY_FIELD(record_t, id, U32));
+   * ```
+   *
+   * or
+   *
+   * ```code
+   * bool res = uc_sort(.container = records, .sort = UC_TIM_SORT, .cmp = record_compare, .indirect = true);
+   * ```
    */
 #define uc_sort(...) \
-  (uc_sort_base((AlgSortArg_t){.container = NULL, .sort = UC_BUBBLE_SORT, .order = SORT_ASCENDING, .cmp = NULL, __VA_ARGS__}))
+  (uc_sort_base((AlgSortArg_t){.container = NULL, \
+                               .sort = UC_BUBBLE_SORT, \
+                               .order = SORT_ASCENDING, \
+                               .cmp = NULL, \
+                               .key = UC_KEY_NONE, \
+                               .indirect = false, \
+                               __VA_ARGS__}))
+
+  /**
+   * \brief A special macro that allows you to apply default arguments to `uc_argsort_base`.
+   *
+   * \example
+   *
+   * ```code
+   * size_t indices[N];
+   * bool res = uc_argsort(.container = container, .indices = indices, .key = UC_KEY_FIELD(record_t, id, U32));
+   * ```
+   */
+#define uc_argsort(...) \
+  (uc_argsort_base((AlgArgsortArg_t){.container = NULL, \
+                                     .indices = NULL, \
+                                     .sort = UC_TIM_SORT, \
+                                     .order = SORT_ASCENDING, \
+                                     .cmp = NULL, \
+                                     .key = UC_KEY_NONE, \
+                                     __VA_ARGS__}))
 /* C++ detection */
 #ifdef __cplusplus
 }
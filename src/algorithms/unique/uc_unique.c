@@ -0,0 +1,251 @@
+/**
+ * @file    uc_unique.c
+ * @author  Aliaksander Kavalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Removal of the duplicated elements.
+ * @date    2023-10-14
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "uc_unique.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "algorithms/select/uc_select.h"
+#include "common/uc_assert.h"
+#include "interface/allocator_if.h"
+//_____ C O N F I G S  ________________________________________________________
+/**
+ * \brief The hash set has at least this number of slots per element, so the probe sequences stay short.
+ */
+#define UNIQUE_HASH_LOAD_FACTOR 2
+//_____ D E F I N I T I O N S _________________________________________________
+/**
+ * \brief Open addressing hash set of the pointers to the kept elements, an empty slot is NULL.
+ */
+typedef struct
+{
+  const uint8_t **slots;
+  size_t mask;
+  size_t esize;
+} unique_set_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+/*
+ * FNV-1a hash of the element bytes.
+ */
+static inline uint64_t hash_bytes(const uint8_t *data, size_t esize)
+{
+  uint64_t hash = 0xCBF29CE484222325ull;
+  for (size_t i = 0; i < esize; i++)
+  {
+    hash = (hash ^ data[i]) * 0x100000001B3ull;
+  }
+
+  return hash;
+}
+
+static bool set_create(unique_set_t *set, size_t size, size_t esize)
+{
+  size_t capacity = 1;
+  while (capacity < size * UNIQUE_HASH_LOAD_FACTOR)
+  {
+    capacity <<= 1;
+  }
+
+  allocate_fn_t mem_allocate = get_allocator();
+  set->slots = (const uint8_t **)mem_allocate(capacity * sizeof(set->slots[0]));
+  if (NULL == set->slots)
+  {
+    return false;
+  }
+
+  memset(set->slots, 0, capacity * sizeof(set->slots[0]));
+  set->mask = capacity - 1;
+  set->esize = esize;
+  return true;
+}
+
+static void set_delete(unique_set_t *set)
+{
+  free_fn_t mem_free = get_free();
+  mem_free(set->slots);
+}
+
+/*
+ * Returns the slot which holds the element equal to the given one or the empty slot where it must be placed.
+ */
+static const uint8_t **set_lookup(const unique_set_t *set, const uint8_t *element)
+{
+  size_t i = (size_t)hash_bytes(element, set->esize) & set->mask;
+  while (NULL != set->slots[i] && 0 != memcmp(set->slots[i], element, set->esize))
+  {
+    i = (i + 1) & set->mask;
+  }
+
+  return &set->slots[i];
+}
+
+/*
+ * The kept elements are moved to the front of the storage and the rest of the storage is erased once.
+ * The slots of the set point to the kept elements at their new positions: the position is never
+ * overwritten afterwards because the write index only grows.
+ */
+static bool hash_unique_vector(container_t *container, uint8_t *arr, const unique_set_t *set)
+{
+  size_t size = container_size(container);
+  size_t esize = set->esize;
+  size_t write = 0;
+
+  for (size_t read = 0; read < size; read++)
+  {
+    const uint8_t **slot = set_lookup(set, &arr[read * esize]);
+    if (NULL != *slot)
+    {
+      continue;
+    }
+
+    if (write != read)
+    {
+      memcpy(&arr[write * esize], &arr[read * esize], esize);
+    }
+    *slot = &arr[write * esize];
+    write++;
+  }
+
+  return (write == size) ? true : container_erase_range(container, write, size - write);
+}
+
+static bool hash_unique_list(container_t *container, const unique_set_t *set)
+{
+  container_cursor_t cursor = container_cursor(container, 0);
+  while (container_cursor_valid(&cursor))
+  {
+    const uint8_t *element = (const uint8_t *)container_cursor_data(&cursor);
+    const uint8_t **slot = set_lookup(set, element);
+    if (NULL != *slot)
+    {
+      if (!container_cursor_erase(&cursor))
+      {
+        return false;
+      }
+      continue;
+    }
+
+    *slot = element;
+    container_cursor_next(&cursor);
+  }
+
+  return true;
+}
+
+static bool hash_unique(container_t *container)
+{
+  unique_set_t set;
+  if (!set_create(&set, container_size(container), container_esize(container)))
+  {
+    return false;
+  }
+
+  uint8_t *arr = (uint8_t *)container_data(container);
+  bool status = (NULL != arr) ? hash_unique_vector(container, arr, &set) : hash_unique_list(container, &set);
+
+  set_delete(&set);
+  return status;
+}
+
+static bool adjacent_unique(container_t *container)
+{
+  size_t size = container_size(container);
+  size_t esize = container_esize(container);
+
+  uint8_t *arr = (uint8_t *)container_data(container);
+  if (NULL != arr)
+  {
+    size_t write = 1;
+    for (size_t read = 1; read < size; read++)
+    {
+      if (0 == memcmp(&arr[(write - 1) * esize], &arr[read * esize], esize))
+      {
+        continue;
+      }
+
+      if (write != read)
+      {
+        memcpy(&arr[write * esize], &arr[read * esize], esize);
+      }
+      write++;
+    }
+
+    return (write >= size) ? true : container_erase_range(container, write, size - write);
+  }
+
+  container_cursor_t cursor = container_cursor(container, 0);
+  const void *previous = container_cursor_data(&cursor);
+  container_cursor_next(&cursor);
+
+  while (container_cursor_valid(&cursor))
+  {
+    const void *element = container_cursor_data(&cursor);
+    if (0 == memcmp(previous, element, esize))
+    {
+      if (!container_cursor_erase(&cursor))
+      {
+        return false;
+      }
+      continue;
+    }
+
+    previous = element;
+    container_cursor_next(&cursor);
+  }
+
+  return true;
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * Removes the duplicated elements from the container.
+ *
+ * Detailed description see in uc_unique.h
+ */
+bool uc_unique_base(AlgUniqueArg_t arg)
+{
+  UC_ASSERT(arg.container && "Invalid argument: container");
+  UC_ASSERT(arg.method < UC_LAST_TYPE_UNIQUE && "Invalid argument: method");
+
+  /* The view can`t erase the elements, so it is refused before any element is moved */
+  if (container_is_view(arg.container))
+  {
+    return false;
+  }
+
+  size_t size = container_size(arg.container);
+  if (size < 2)
+  {
+    return true;
+  }
+
+  /* The heap sort works in place, the order of equal elements doesn`t matter because they are removed */
+  AlgSelectArg_t sort = {
+    .container = arg.container,
+    .nth = 0,
+    .count = size,
+    .output = NULL,
+    .order = SORT_ASCENDING,
+    .cmp = NULL,
+    .key = UC_KEY_NONE,
+  };
+
+  switch (arg.method)
+  {
+    case UC_HASH_UNIQUE: return hash_unique(arg.container);
+    case UC_SORT_UNIQUE:
+      if (!uc_partial_sort_base(sort))
+      {
+        return false;
+      }
+      return adjacent_unique(arg.container);
+    default: return adjacent_unique(arg.container);
+  }
+}
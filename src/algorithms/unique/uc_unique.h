@@ -0,0 +1,82 @@
+/**
+ * @file    uc_unique.h
+ * @author  Aliaksander Kavalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Removal of the duplicated elements.
+ * @date    2023-10-14
+ *
+ * This header file provides the `uc_unique` function which keeps only one copy of every element.
+ * The elements are equal if they are equal byte by byte. Supported methods:
+ * - `UC_HASH_UNIQUE` keeps the first copy of every element and the order of the elements. The seen elements
+ *   are kept in a temporary hash set, so the method takes O(N) expected time and O(N) additional memory.
+ * - `UC_SORT_UNIQUE` sorts the container by `memcmp` order in place and removes the adjacent duplicates.
+ *   The method takes O(N*log(N)) time and no additional memory for the vector based containers.
+ * - `UC_ADJACENT_UNIQUE` only removes the adjacent duplicates in O(N), i.e. deduplicates the sorted container.
+ *
+ * The vector based containers are compacted in their storage and shrunk once at the end;
+ * from the linked list based containers the duplicates are unlinked by the cursor.
+ * The views can`t erase the elements of their parent, so `uc_unique` fails on them without changing the elements.
+ */
+
+#pragma once
+
+//_____ I N C L U D E S _______________________________________________________
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "core/container.h"
+//_____ C O N F I G S  ________________________________________________________
+//_____ D E F I N I T I O N S _________________________________________________
+/**
+ *  \brief List of supported deduplication methods
+ */
+typedef enum tagContainerUniqueTypesEnum
+{
+  UC_HASH_UNIQUE = 0,
+  UC_SORT_UNIQUE,
+  UC_ADJACENT_UNIQUE,
+  /* Put new value here */
+  UC_LAST_TYPE_UNIQUE
+} ContainerUniqueTypes_e;
+
+/**
+ * \brief The deduplication function argument structure
+ */
+typedef struct
+{
+  container_t *container;
+  ContainerUniqueTypes_e method;
+} AlgUniqueArg_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/* C++ detection */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+  /**
+   * \brief Removes the duplicated elements from the container.
+   *
+   * \param[in] container container (mandatory argument).
+   * \param[in] method selected method see @ContainerUniqueTypes_e. This argument isn`t mandatory. In case if user do not give
+   *   this argument the order preserving `UC_HASH_UNIQUE` method will be used.
+   * \return true if the duplicates are removed
+   * \return false if fault occur or the container is a view, the container isn`t changed in this case
+   */
+  bool uc_unique_base(AlgUniqueArg_t arg);
+
+  /**
+   * \brief A special macro that allows you to apply default arguments and a variable list of arguments.
+   *
+   * \example
+   *
+   * ```code
+   * bool res = uc_unique(.container = container);
+   * bool res = uc_unique(.container = container, .method = UC_SORT_UNIQUE);
+   * ```
+   */
+#define uc_unique(...) (uc_unique_base((AlgUniqueArg_t){.container = NULL, .method = UC_HASH_UNIQUE, __VA_ARGS__}))
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,42 @@
+/**
+ * @file    uc_crc.h
+ * @author  Aliaksander Kavalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   CRC32C (Castagnoli) checksum.
+ * @date    2023-10-13
+ *
+ * The checksum is computed by the SSE4.2 or ARMv8 CRC instructions when the compiler targets them.
+ * Otherwise the table driven implementation is used if `CRC32_TABLE` is defined, and the bitwise
+ * implementation without the table is used if it isn`t (it is slower, but needs no memory for the table).
+ */
+
+#pragma once
+
+//_____ I N C L U D E S _______________________________________________________
+#include <stddef.h>
+#include <stdint.h>
+//_____ C O N F I G S  ________________________________________________________
+//_____ D E F I N I T I O N S _________________________________________________
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/* C++ detection */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+  /**
+   * \brief Updates the CRC32C checksum by the block of data.
+   *
+   * The checksum can be computed by parts: `uc_crc32c(uc_crc32c(0, a, n), b, m)` is equal to the checksum
+   * of the concatenation of the blocks `a` and `b`.
+   *
+   * \param[in] crc checksum of the previous data or 0 for the first block.
+   * \param[in] data pointer to the data.
+   * \param[in] size size of the data in bytes.
+   * \return the checksum of the previous data followed by the block.
+   */
+  uint32_t uc_crc32c(uint32_t crc, const void *data, size_t size);
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
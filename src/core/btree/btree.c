@@ -0,0 +1,867 @@
+/**
+ * \file    btree.c
+ * \author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * \brief   Ordered map and ordered set with fixed size keys and values on the B+ tree.
+ * \date    2023-10-16
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "btree.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "common/uc_assert.h"
+#include "interface/allocator_if.h"
+//_____ C O N F I G S  ________________________________________________________
+/**
+ * \brief Size of the cache line and the number of the cache lines taken by the keys and the values
+ * (the children) of the node.
+ */
+#define CACHE_LINE 64
+#define NODE_LINES 4
+
+/**
+ * \brief Minimal number of the keys in the full node.
+ */
+#define MIN_FANOUT 4
+
+/**
+ * \brief Maximal height of the tree: the non-root node has at least MIN_FANOUT / 2 + 1 children.
+ */
+#define MAX_DEPTH 48
+//_____ D E F I N I T I O N S _________________________________________________
+/**
+ * \brief Alignment of the arrays in the node.
+ */
+#define ALIGNMENT 16
+
+/*
+ * The internal node with `count` keys has `count + 1` children, the keys of the child `i` are not less than
+ * the key `i - 1` and less than the key `i`. The arrays of the node have a spare slot, so the key is
+ * inserted into the full node before it is split.
+ */
+struct BTreeNode_tag
+{
+  size_t count;            /// Number of the keys
+  bool leaf;               /// The node is a leaf
+  btree_node_t *prev;      /// Previous leaf (NULL for the internal node)
+  btree_node_t *next;      /// Next leaf (NULL for the internal node)
+  uint8_t *keys;           /// Keys of the node
+  uint8_t *values;         /// Values of the leaf
+  btree_node_t **children; /// Children of the internal node
+};
+
+struct BTree_tag
+{
+  btree_node_t *root;
+  btree_node_t *head;  /// Leaf with the smallest keys
+  btree_node_t *tail;  /// Leaf with the largest keys
+  size_t size;         /// Number of the elements
+  size_t depth;        /// Number of the levels of the internal nodes
+  size_t key_size;     /// Size of the key
+  size_t value_size;   /// Size of the value
+  size_t leaf_max;     /// Maximal number of the keys in the leaf
+  size_t inner_max;    /// Maximal number of the keys in the internal node
+  compare_fn_t cmp;
+  uint8_t *separator;  /// Buffer for the key which is moved up by the split
+};
+//_____ M A C R O S ___________________________________________________________
+/**
+ * \brief Pointer to the key and to the value with the index `i` of the node.
+ */
+#define KEY(tree, node, i)   ((node)->keys + (i) * (tree)->key_size)
+#define VALUE(tree, node, i) ((node)->values + (i) * (tree)->value_size)
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+static cmp_t default_compare(const void *key1, const void *key2, size_t key_size)
+{
+  int result = memcmp(key1, key2, key_size);
+  return (result > 0) ? GT : ((result < 0) ? LE : EQ);
+}
+
+static inline size_t round_up(size_t value, size_t align)
+{
+  return (value + align - 1) / align * align;
+}
+
+static inline size_t fanout(size_t entry_size)
+{
+  size_t count = NODE_LINES * CACHE_LINE / entry_size;
+  return (count < MIN_FANOUT) ? MIN_FANOUT : count;
+}
+
+static btree_node_t *node_create(const btree_t *tree, bool leaf)
+{
+  size_t capacity = (leaf ? tree->leaf_max : tree->inner_max) + 1;
+  size_t header = round_up(sizeof(btree_node_t), ALIGNMENT);
+  size_t keys = round_up(capacity * tree->key_size, ALIGNMENT);
+  size_t rest = leaf ? capacity * tree->value_size : (capacity + 1) * sizeof(btree_node_t *);
+
+  allocate_fn_t mem_allocate = get_allocator();
+  btree_node_t *node = (btree_node_t *)mem_allocate(header + keys + rest);
+  if (NULL == node)
+  {
+    return NULL;
+  }
+
+  node->count = 0;
+  node->leaf = leaf;
+  node->prev = NULL;
+  node->next = NULL;
+  node->keys = (uint8_t *)node + header;
+  node->values = leaf ? node->keys + keys : NULL;
+  node->children = leaf ? NULL : (btree_node_t **)(node->keys + keys);
+
+  return node;
+}
+
+static void free_subtree(btree_node_t *node)
+{
+  free_fn_t mem_free = get_free();
+
+  if (!node->leaf)
+  {
+    for (size_t i = 0; i <= node->count; i++)
+    {
+      free_subtree(node->children[i]);
+    }
+  }
+
+  mem_free(node);
+}
+
+/* Index of the first key which is not less than the given one */
+static size_t lower_bound(const btree_t *tree, const btree_node_t *node, const void *key)
+{
+  size_t first = 0;
+  size_t count = node->count;
+
+  while (0 != count)
+  {
+    size_t half = count / 2;
+    if (LE == tree->cmp(KEY(tree, node, first + half), key, tree->key_size))
+    {
+      first += half + 1;
+      count -= half + 1;
+    }
+    else
+    {
+      count = half;
+    }
+  }
+
+  return first;
+}
+
+/* Index of the first key which is greater than the given one */
+static size_t upper_bound(const btree_t *tree, const btree_node_t *node, const void *key)
+{
+  size_t first = 0;
+  size_t count = node->count;
+
+  while (0 != count)
+  {
+    size_t half = count / 2;
+    if (GT != tree->cmp(KEY(tree, node, first + half), key, tree->key_size))
+    {
+      first += half + 1;
+      count -= half + 1;
+    }
+    else
+    {
+      count = half;
+    }
+  }
+
+  return first;
+}
+
+/* The internal nodes and the indexes of the children on the way to the leaf are saved into the path */
+static btree_node_t *descend(const btree_t *tree, const void *key, btree_node_t **path, size_t *slots)
+{
+  btree_node_t *node = tree->root;
+
+  for (size_t level = 0; !node->leaf; level++)
+  {
+    size_t slot = upper_bound(tree, node, key);
+    if (NULL != path)
+    {
+      path[level] = node;
+      slots[level] = slot;
+    }
+    node = node->children[slot];
+  }
+
+  return node;
+}
+
+static void *slot_value(const btree_t *tree, const btree_node_t *node, size_t index)
+{
+  return (0 == tree->value_size) ? KEY(tree, node, index) : VALUE(tree, node, index);
+}
+
+static void move_entries(const btree_t *tree, btree_node_t *dst, size_t dst_index, btree_node_t *src, size_t src_index, size_t count)
+{
+  memmove(KEY(tree, dst, dst_index), KEY(tree, src, src_index), count * tree->key_size);
+  if (dst->leaf)
+  {
+    memmove(VALUE(tree, dst, dst_index), VALUE(tree, src, src_index), count * tree->value_size);
+  }
+}
+
+static void move_children(btree_node_t *dst, size_t dst_index, btree_node_t *src, size_t src_index, size_t count)
+{
+  memmove(&dst->children[dst_index], &src->children[src_index], count * sizeof(btree_node_t *));
+}
+
+/* The upper half of the leaf is moved into the new right leaf */
+static void split_leaf(btree_t *tree, btree_node_t *leaf, btree_node_t *right)
+{
+  size_t mid = leaf->count / 2;
+
+  move_entries(tree, right, 0, leaf, mid, leaf->count - mid);
+  right->count = leaf->count - mid;
+  leaf->count = mid;
+
+  right->next = leaf->next;
+  right->prev = leaf;
+  if (NULL != leaf->next)
+  {
+    leaf->next->prev = right;
+  }
+  else
+  {
+    tree->tail = right;
+  }
+  leaf->next = right;
+
+  memcpy(tree->separator, KEY(tree, right, 0), tree->key_size);
+}
+
+/* The middle key goes up into the separator, the keys after it are moved into the new right node */
+static void split_inner(btree_t *tree, btree_node_t *node, btree_node_t *right)
+{
+  size_t mid = node->count / 2;
+
+  memcpy(tree->separator, KEY(tree, node, mid), tree->key_size);
+  move_entries(tree, right, 0, node, mid + 1, node->count - mid - 1);
+  move_children(right, 0, node, mid + 1, node->count - mid);
+  right->count = node->count - mid - 1;
+  node->count = mid;
+}
+
+/* The key with the index `index` of the parent separates the left node and the right one, which is released */
+static void merge(btree_t *tree, btree_node_t *parent, size_t index, btree_node_t *left, btree_node_t *right)
+{
+  if (left->leaf)
+  {
+    move_entries(tree, left, left->count, right, 0, right->count);
+    left->count += right->count;
+
+    left->next = right->next;
+    if (NULL != right->next)
+    {
+      right->next->prev = left;
+    }
+    else
+    {
+      tree->tail = left;
+    }
+  }
+  else
+  {
+    memcpy(KEY(tree, left, left->count), KEY(tree, parent, index), tree->key_size);
+    move_entries(tree, left, left->count + 1, right, 0, right->count);
+    move_children(left, left->count + 1, right, 0, right->count + 1);
+    left->count += right->count + 1;
+  }
+
+  move_entries(tree, parent, index, parent, index + 1, parent->count - index - 1);
+  move_children(parent, index + 1, parent, index + 2, parent->count - index - 1);
+  parent->count--;
+
+  free_fn_t mem_free = get_free();
+  mem_free(right);
+}
+
+/* The last element of the left sibling is moved into the beginning of the node */
+static void borrow_left(btree_t *tree, btree_node_t *parent, size_t index, btree_node_t *left, btree_node_t *node)
+{
+  move_entries(tree, node, 1, node, 0, node->count);
+
+  if (node->leaf)
+  {
+    move_entries(tree, node, 0, left, left->count - 1, 1);
+    memcpy(KEY(tree, parent, index - 1), KEY(tree, node, 0), tree->key_size);
+  }
+  else
+  {
+    move_children(node, 1, node, 0, node->count + 1);
+    memcpy(KEY(tree, node, 0), KEY(tree, parent, index - 1), tree->key_size);
+    node->children[0] = left->children[left->count];
+    memcpy(KEY(tree, parent, index - 1), KEY(tree, left, left->count - 1), tree->key_size);
+  }
+
+  left->count--;
+  node->count++;
+}
+
+/* The first element of the right sibling is moved into the end of the node */
+static void borrow_right(btree_t *tree, btree_node_t *parent, size_t index, btree_node_t *node, btree_node_t *right)
+{
+  if (node->leaf)
+  {
+    move_entries(tree, node, node->count, right, 0, 1);
+    move_entries(tree, right, 0, right, 1, right->count - 1);
+    memcpy(KEY(tree, parent, index), KEY(tree, right, 0), tree->key_size);
+  }
+  else
+  {
+    memcpy(KEY(tree, node, node->count), KEY(tree, parent, index), tree->key_size);
+    node->children[node->count + 1] = right->children[0];
+    memcpy(KEY(tree, parent, index), KEY(tree, right, 0), tree->key_size);
+    move_entries(tree, right, 0, right, 1, right->count - 1);
+    move_children(right, 0, right, 1, right->count);
+  }
+
+  node->count++;
+  right->count--;
+}
+
+/* The leaf is walked to the next one if the index points after its last element */
+static btree_cursor_t make_cursor(const btree_t *tree, btree_node_t *leaf, size_t index)
+{
+  if (NULL != leaf && index >= leaf->count)
+  {
+    leaf = leaf->next;
+    index = 0;
+  }
+
+  return (btree_cursor_t){.tree = tree, .leaf = leaf, .index = index};
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * \brief Creates a new empty tree.
+ *
+ * Detailed description see in btree.h
+ */
+btree_t *btree_create(size_t key_size, size_t value_size, compare_fn_t cmp)
+{
+  UC_ASSERT(0 != key_size);
+
+  if (!is_allocator_valid())
+  {
+    return NULL;
+  }
+
+  allocate_fn_t mem_allocate = get_allocator();
+  free_fn_t mem_free = get_free();
+
+  btree_t *tree = (btree_t *)mem_allocate(sizeof *tree);
+  if (NULL == tree)
+  {
+    return NULL;
+  }
+
+  tree->separator = (uint8_t *)mem_allocate(key_size);
+  if (NULL == tree->separator)
+  {
+    mem_free(tree);
+    return NULL;
+  }
+
+  tree->root = NULL;
+  tree->head = NULL;
+  tree->tail = NULL;
+  tree->size = 0;
+  tree->depth = 0;
+  tree->key_size = key_size;
+  tree->value_size = value_size;
+  tree->leaf_max = fanout(key_size + value_size);
+  tree->inner_max = fanout(key_size + sizeof(btree_node_t *));
+  tree->cmp = (NULL == cmp) ? default_compare : cmp;
+
+  return tree;
+}
+
+/**
+ * \brief Frees up the memory associated with the tree.
+ *
+ * Detailed description see in btree.h
+ */
+void btree_delete(btree_t **tree)
+{
+  UC_ASSERT(tree);
+  UC_ASSERT(*tree);
+  UC_ASSERT(is_allocator_valid());
+
+  free_fn_t mem_free = get_free();
+
+  btree_clear(*tree);
+  mem_free((*tree)->separator);
+  mem_free(*tree);
+  (*tree) = NULL;
+}
+
+/**
+ * \brief Finds the key or inserts it with the zero filled value.
+ *
+ * Detailed description see in btree.h
+ */
+void *btree_emplace(btree_t *tree, const void *key, bool *inserted)
+{
+  UC_ASSERT(tree);
+  UC_ASSERT(key);
+
+  if (NULL != inserted)
+  {
+    (*inserted) = false;
+  }
+
+  if (NULL == tree->root)
+  {
+    tree->root = node_create(tree, true);
+    if (NULL == tree->root)
+    {
+      return NULL;
+    }
+    tree->head = tree->root;
+    tree->tail = tree->root;
+    tree->depth = 0;
+  }
+
+  btree_node_t *path[MAX_DEPTH];
+  size_t slots[MAX_DEPTH];
+  btree_node_t *leaf = descend(tree, key, path, slots);
+  size_t index = lower_bound(tree, leaf, key);
+
+  if (index < leaf->count && EQ == tree->cmp(KEY(tree, leaf, index), key, tree->key_size))
+  {
+    return slot_value(tree, leaf, index);
+  }
+
+  /* All nodes for the splits are allocated beforehand, so the failed allocation leaves the tree unchanged */
+  btree_node_t *spare[MAX_DEPTH + 1];
+  size_t splits = 0;
+  if (leaf->count == tree->leaf_max)
+  {
+    splits = 1;
+    size_t level = tree->depth;
+    while (0 != level && path[level - 1]->count == tree->inner_max)
+    {
+      splits++;
+      level--;
+    }
+    if (0 == level)
+    {
+      splits++;
+    }
+  }
+
+  UC_ASSERT(tree->depth + 1 < MAX_DEPTH);
+
+  for (size_t i = 0; i < splits; i++)
+  {
+    spare[i] = node_create(tree, 0 == i);
+    if (NULL == spare[i])
+    {
+      free_fn_t mem_free = get_free();
+      while (0 != i)
+      {
+        mem_free(spare[--i]);
+      }
+      return NULL;
+    }
+  }
+
+  move_entries(tree, leaf, index + 1, leaf, index, leaf->count - index);
+  memcpy(KEY(tree, leaf, index), key, tree->key_size);
+  memset(VALUE(tree, leaf, index), 0, tree->value_size);
+  leaf->count++;
+  tree->size++;
+
+  if (NULL != inserted)
+  {
+    (*inserted) = true;
+  }
+
+  if (leaf->count <= tree->leaf_max)
+  {
+    return slot_value(tree, leaf, index);
+  }
+
+  size_t used = 0;
+  btree_node_t *right = spare[used++];
+  split_leaf(tree, leaf, right);
+  void *result = (index < leaf->count) ? slot_value(tree, leaf, index) : slot_value(tree, right, index - leaf->count);
+
+  for (size_t level = tree->depth;; level--)
+  {
+    if (0 == level)
+    {
+      btree_node_t *root = spare[used++];
+      memcpy(KEY(tree, root, 0), tree->separator, tree->key_size);
+      root->children[0] = tree->root;
+      root->children[1] = right;
+      root->count = 1;
+      tree->root = root;
+      tree->depth++;
+      break;
+    }
+
+    btree_node_t *parent = path[level - 1];
+    size_t slot = slots[level - 1];
+
+    move_entries(tree, parent, slot + 1, parent, slot, parent->count - slot);
+    move_children(parent, slot + 2, parent, slot + 1, parent->count - slot);
+    memcpy(KEY(tree, parent, slot), tree->separator, tree->key_size);
+    parent->children[slot + 1] = right;
+    parent->count++;
+
+    if (parent->count <= tree->inner_max)
+    {
+      break;
+    }
+
+    right = spare[used++];
+    split_inner(tree, parent, right);
+  }
+
+  return result;
+}
+
+/**
+ * \brief Inserts the key with the value or replaces the value.
+ *
+ * Detailed description see in btree.h
+ */
+bool btree_insert(btree_t *tree, const void *key, const void *value)
+{
+  UC_ASSERT(tree);
+  UC_ASSERT(key);
+  UC_ASSERT(0 == tree->value_size || NULL != value);
+
+  void *slot = btree_emplace(tree, key, NULL);
+  if (NULL == slot)
+  {
+    return false;
+  }
+
+  if (0 != tree->value_size)
+  {
+    memcpy(slot, value, tree->value_size);
+  }
+
+  return true;
+}
+
+/**
+ * \brief Finds the key in the tree.
+ *
+ * Detailed description see in btree.h
+ */
+void *btree_find(const btree_t *tree, const void *key)
+{
+  UC_ASSERT(tree);
+  UC_ASSERT(key);
+
+  if (NULL == tree->root)
+  {
+    return NULL;
+  }
+
+  btree_node_t *leaf = descend(tree, key, NULL, NULL);
+  size_t index = lower_bound(tree, leaf, key);
+
+  if (index < leaf->count && EQ == tree->cmp(KEY(tree, leaf, index), key, tree->key_size))
+  {
+    return slot_value(tree, leaf, index);
+  }
+
+  return NULL;
+}
+
+/**
+ * \brief Checks if the key is in the tree.
+ *
+ * Detailed description see in btree.h
+ */
+bool btree_contains(const btree_t *tree, const void *key)
+{
+  return NULL != btree_find(tree, key);
+}
+
+/**
+ * \brief Erases the key and its value from the tree.
+ *
+ * Detailed description see in btree.h
+ */
+bool btree_erase(btree_t *tree, const void *key)
+{
+  UC_ASSERT(tree);
+  UC_ASSERT(key);
+
+  if (NULL == tree->root)
+  {
+    return false;
+  }
+
+  btree_node_t *path[MAX_DEPTH];
+  size_t slots[MAX_DEPTH];
+  btree_node_t *node = descend(tree, key, path, slots);
+  size_t index = lower_bound(tree, node, key);
+
+  if (index >= node->count || EQ != tree->cmp(KEY(tree, node, index), key, tree->key_size))
+  {
+    return false;
+  }
+
+  move_entries(tree, node, index, node, index + 1, node->count - index - 1);
+  node->count--;
+  tree->size--;
+
+  /* The separators in the internal nodes may keep the erased key: they still split the keys of the children */
+  for (size_t level = tree->depth; 0 != level; level--)
+  {
+    size_t min = (node->leaf ? tree->leaf_max : tree->inner_max) / 2;
+    if (node->count >= min)
+    {
+      break;
+    }
+
+    btree_node_t *parent = path[level - 1];
+    size_t slot = slots[level - 1];
+    btree_node_t *left = (0 != slot) ? parent->children[slot - 1] : NULL;
+    btree_node_t *right = (slot < parent->count) ? parent->children[slot + 1] : NULL;
+
+    if (NULL != left && left->count > min)
+    {
+      borrow_left(tree, parent, slot, left, node);
+      break;
+    }
+
+    if (NULL != right && right->count > min)
+    {
+      borrow_right(tree, parent, slot, node, right);
+      break;
+    }
+
+    if (NULL != left)
+    {
+      merge(tree, parent, slot - 1, left, node);
+    }
+    else
+    {
+      merge(tree, parent, slot, node, right);
+    }
+
+    node = parent;
+  }
+
+  free_fn_t mem_free = get_free();
+  btree_node_t *root = tree->root;
+
+  if (!root->leaf && 0 == root->count)
+  {
+    tree->root = root->children[0];
+    tree->depth--;
+    mem_free(root);
+  }
+  else if (root->leaf && 0 == root->count)
+  {
+    tree->root = NULL;
+    tree->head = NULL;
+    tree->tail = NULL;
+    mem_free(root);
+  }
+
+  return true;
+}
+
+/**
+ * \brief Erases all elements from the tree.
+ *
+ * Detailed description see in btree.h
+ */
+void btree_clear(btree_t *tree)
+{
+  UC_ASSERT(tree);
+
+  if (NULL != tree->root)
+  {
+    free_subtree(tree->root);
+  }
+
+  tree->root = NULL;
+  tree->head = NULL;
+  tree->tail = NULL;
+  tree->size = 0;
+  tree->depth = 0;
+}
+
+/**
+ * \brief Returns the number of elements in the tree.
+ *
+ * Detailed description see in btree.h
+ */
+size_t btree_size(const btree_t *tree)
+{
+  UC_ASSERT(tree);
+
+  return tree->size;
+}
+
+/**
+ * \brief Creates a cursor which points to the element with the smallest key.
+ *
+ * Detailed description see in btree.h
+ */
+btree_cursor_t btree_first(const btree_t *tree)
+{
+  UC_ASSERT(tree);
+
+  return make_cursor(tree, tree->head, 0);
+}
+
+/**
+ * \brief Creates a cursor which points to the element with the largest key.
+ *
+ * Detailed description see in btree.h
+ */
+btree_cursor_t btree_last(const btree_t *tree)
+{
+  UC_ASSERT(tree);
+
+  return make_cursor(tree, tree->tail, (NULL == tree->tail) ? 0 : tree->tail->count - 1);
+}
+
+/**
+ * \brief Creates a cursor which points to the first element with the key not less than the given one.
+ *
+ * Detailed description see in btree.h
+ */
+btree_cursor_t btree_lower_bound(const btree_t *tree, const void *key)
+{
+  UC_ASSERT(tree);
+  UC_ASSERT(key);
+
+  if (NULL == tree->root)
+  {
+    return make_cursor(tree, NULL, 0);
+  }
+
+  btree_node_t *leaf = descend(tree, key, NULL, NULL);
+  return make_cursor(tree, leaf, lower_bound(tree, leaf, key));
+}
+
+/**
+ * \brief Creates a cursor which points to the first element with the key greater than the given one.
+ *
+ * Detailed description see in btree.h
+ */
+btree_cursor_t btree_upper_bound(const btree_t *tree, const void *key)
+{
+  UC_ASSERT(tree);
+  UC_ASSERT(key);
+
+  if (NULL == tree->root)
+  {
+    return make_cursor(tree, NULL, 0);
+  }
+
+  btree_node_t *leaf = descend(tree, key, NULL, NULL);
+  return make_cursor(tree, leaf, upper_bound(tree, leaf, key));
+}
+
+/**
+ * \brief Checks that the cursor points to an element of the tree.
+ *
+ * Detailed description see in btree.h
+ */
+bool btree_cursor_valid(const btree_cursor_t *cursor)
+{
+  UC_ASSERT(cursor);
+
+  return NULL != cursor->leaf && cursor->index < cursor->leaf->count;
+}
+
+/**
+ * \brief Moves the cursor to the element with the next key.
+ *
+ * Detailed description see in btree.h
+ */
+bool btree_cursor_next(btree_cursor_t *cursor)
+{
+  UC_ASSERT(cursor);
+
+  if (NULL == cursor->leaf)
+  {
+    return false;
+  }
+
+  if (++cursor->index < cursor->leaf->count)
+  {
+    return true;
+  }
+
+  cursor->leaf = cursor->leaf->next;
+  cursor->index = 0;
+  return NULL != cursor->leaf;
+}
+
+/**
+ * \brief Moves the cursor to the element with the previous key.
+ *
+ * Detailed description see in btree.h
+ */
+bool btree_cursor_prev(btree_cursor_t *cursor)
+{
+  UC_ASSERT(cursor);
+
+  if (NULL == cursor->leaf)
+  {
+    return false;
+  }
+
+  if (0 != cursor->index)
+  {
+    cursor->index--;
+  }
+  else
+  {
+    cursor->leaf = cursor->leaf->prev;
+    cursor->index = (NULL == cursor->leaf) ? 0 : cursor->leaf->count - 1;
+  }
+
+  return btree_cursor_valid(cursor);
+}
+
+/**
+ * \brief Returns a pointer to the key which the cursor points to.
+ *
+ * Detailed description see in btree.h
+ */
+const void *btree_cursor_key(const btree_cursor_t *cursor)
+{
+  UC_ASSERT(cursor);
+
+  return btree_cursor_valid(cursor) ? KEY(cursor->tree, cursor->leaf, cursor->index) : NULL;
+}
+
+/**
+ * \brief Returns a pointer to the value which the cursor points to.
+ *
+ * Detailed description see in btree.h
+ */
+void *btree_cursor_value(const btree_cursor_t *cursor)
+{
+  UC_ASSERT(cursor);
+
+  if (!btree_cursor_valid(cursor) || 0 == cursor->tree->value_size)
+  {
+    return NULL;
+  }
+
+  return VALUE(cursor->tree, cursor->leaf, cursor->index);
+}
@@ -0,0 +1,211 @@
+/**
+ * \file    btree.h
+ * \author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * \brief   Ordered map and ordered set with fixed size keys and values on the B+ tree.
+ *
+ * The elements are stored in the leaves in the order of the keys and the leaves are linked with each other,
+ * so the range of the keys is walked by the cursor without going back to the upper levels of the tree.
+ * The insertion, the erasing and the lookup take O(log N) comparisons.
+ *
+ * The node of the tree takes a few cache lines: the number of the keys in the node is chosen
+ * by the sizes of the key and the value, so the binary search in the node touches a few cache lines
+ * and the tree is low.
+ *
+ * The tree with `value_size` equal to 0 is an ordered set: it stores the keys only.
+ *
+ * The keys and the values are copied into the tree, the memory is allocated through the allocator interface.
+ * Any insertion or erasing can move the elements, so the pointers returned by the tree and the cursors
+ * are valid until the next insertion or erasing.
+ *
+ * \date    2023-10-16
+ */
+
+#pragma once
+
+//_____ I N C L U D E S _______________________________________________________
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "algorithms/sort/uc_sort.h"
+//_____ C O N F I G S  ________________________________________________________
+//_____ D E F I N I T I O N S _________________________________________________
+typedef struct BTree_tag btree_t;
+typedef struct BTreeNode_tag btree_node_t;
+
+/**
+ * \brief Position of the element in the tree.
+ */
+typedef struct
+{
+  const btree_t *tree; /**< The tree which the cursor walks through. */
+  btree_node_t *leaf;  /**< The leaf with the element or NULL if the cursor is out of the tree. */
+  size_t index;        /**< Index of the element in the leaf. */
+} btree_cursor_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/* C++ detection */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+  /**
+   * \brief Creates a new empty tree.
+   *
+   * \param key_size Size in bytes of the key.
+   * \param value_size Size in bytes of the value or 0 for the ordered set.
+   * \param cmp Callback function which compares the keys or NULL for `memcmp`.
+   * \return Pointer to the newly created tree or NULL if the allocation failed.
+   */
+  btree_t *btree_create(size_t key_size, size_t value_size, compare_fn_t cmp);
+
+  /**
+   * \brief Frees up the memory associated with the tree.
+   *
+   * \param tree Double pointer to the tree to be deleted.
+   */
+  void btree_delete(btree_t **tree);
+
+  /**
+   * \brief Inserts the key with the value or replaces the value if the key is already in the tree.
+   *
+   * \param tree Pointer to the tree.
+   * \param key Pointer to the key.
+   * \param value Pointer to the value (it is ignored by the ordered set).
+   * \return true if the operation was successful, false if the memory allocation failed.
+   */
+  bool btree_insert(btree_t *tree, const void *key, const void *value);
+
+  /**
+   * \brief Finds the key or inserts it with the zero filled value and returns a pointer to the value.
+   *
+   * \param tree Pointer to the tree.
+   * \param key Pointer to the key.
+   * \param inserted Pointer to the variable which is set to true if the key was inserted (it can be NULL).
+   * \return Pointer to the value (to the key for the ordered set) or NULL if the memory allocation failed.
+   */
+  void *btree_emplace(btree_t *tree, const void *key, bool *inserted);
+
+  /**
+   * \brief Finds the key in the tree.
+   *
+   * \param tree Pointer to the tree.
+   * \param key Pointer to the key.
+   * \return Pointer to the value (to the key for the ordered set) or NULL if the key isn`t in the tree.
+   */
+  void *btree_find(const btree_t *tree, const void *key);
+
+  /**
+   * \brief Checks if the key is in the tree.
+   *
+   * \param tree Pointer to the tree.
+   * \param key Pointer to the key.
+   * \return true if the key is in the tree, false otherwise.
+   */
+  bool btree_contains(const btree_t *tree, const void *key);
+
+  /**
+   * \brief Erases the key and its value from the tree.
+   *
+   * \param tree Pointer to the tree.
+   * \param key Pointer to the key.
+   * \return true if the key was erased, false if the key isn`t in the tree.
+   */
+  bool btree_erase(btree_t *tree, const void *key);
+
+  /**
+   * \brief Erases all elements from the tree and releases the nodes.
+   *
+   * \param tree Pointer to the tree.
+   */
+  void btree_clear(btree_t *tree);
+
+  /**
+   * \brief Returns the number of elements in the tree.
+   *
+   * \param tree Pointer to the tree.
+   * \return Number of elements in the tree.
+   */
+  size_t btree_size(const btree_t *tree);
+
+  /**
+   * \brief Creates a cursor which points to the element with the smallest key.
+   *
+   * \param tree Pointer to the tree.
+   * \return The cursor. The cursor is invalid if the tree is empty.
+   */
+  btree_cursor_t btree_first(const btree_t *tree);
+
+  /**
+   * \brief Creates a cursor which points to the element with the largest key.
+   *
+   * \param tree Pointer to the tree.
+   * \return The cursor. The cursor is invalid if the tree is empty.
+   */
+  btree_cursor_t btree_last(const btree_t *tree);
+
+  /**
+   * \brief Creates a cursor which points to the first element with the key not less than the given one.
+   *
+   * The range [first, last) of the keys is walked from `btree_lower_bound(first)`
+   * until the cursor reaches `btree_lower_bound(last)` or the key not less than `last`.
+   *
+   * \param tree Pointer to the tree.
+   * \param key Pointer to the key.
+   * \return The cursor. The cursor is invalid if all keys are less than the given one.
+   */
+  btree_cursor_t btree_lower_bound(const btree_t *tree, const void *key);
+
+  /**
+   * \brief Creates a cursor which points to the first element with the key greater than the given one.
+   *
+   * \param tree Pointer to the tree.
+   * \param key Pointer to the key.
+   * \return The cursor. The cursor is invalid if all keys aren`t greater than the given one.
+   */
+  btree_cursor_t btree_upper_bound(const btree_t *tree, const void *key);
+
+  /**
+   * \brief Checks that the cursor points to an element of the tree.
+   *
+   * \param cursor Pointer to the cursor.
+   * \return true if the cursor points to an element, false otherwise.
+   */
+  bool btree_cursor_valid(const btree_cursor_t *cursor);
+
+  /**
+   * \brief Moves the cursor to the element with the next key.
+   *
+   * \param cursor Pointer to the cursor.
+   * \return true if the cursor points to an element after the move, false if the end of the tree is reached.
+   */
+  bool btree_cursor_next(btree_cursor_t *cursor);
+
+  /**
+   * \brief Moves the cursor to the element with the previous key.
+   *
+   * \param cursor Pointer to the cursor.
+   * \return true if the cursor points to an element after the move, false if the beginning of the tree is reached.
+   */
+  bool btree_cursor_prev(btree_cursor_t *cursor);
+
+  /**
+   * \brief Returns a pointer to the key which the cursor points to. The key must not be changed.
+   *
+   * \param cursor Pointer to the cursor.
+   * \return Pointer to the key or NULL if the cursor is invalid.
+   */
+  const void *btree_cursor_key(const btree_cursor_t *cursor);
+
+  /**
+   * \brief Returns a pointer to the value which the cursor points to.
+   *
+   * \param cursor Pointer to the cursor.
+   * \return Pointer to the value or NULL if the cursor is invalid or the tree is an ordered set.
+   */
+  void *btree_cursor_value(const btree_cursor_t *cursor);
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
@@ -18,41 +18,58 @@
 //_____ I N C L U D E S _______________________________________________________
 #include "container.h"
 
+#include <string.h>
+
 #include "common/uc_assert.h"
+#include "common/uc_crc.h"
 
 #include "linked_list/linked_list.h"
+#include "tiered_vector/tiered_vector.h"
+#include "unrolled_list/unrolled_list.h"
 #include "vector/vector.h"
+#include "view/view.h"
 //_____ C O N F I G S  ________________________________________________________
+/**
+ * \brief Base of the polynomial hash and its multiplicative inverse modulo 2^64.
+ */
+#define HASH_BASE     0x9E3779B97F4A7C15ull
+#define HASH_BASE_INV 0xF1DE83E19937733Dull
 //_____ D E F I N I T I O N S _________________________________________________
+/**
+ * \brief Incrementally maintained hash: the value of the hash and `HASH_BASE` in the power of the size.
+ */
+typedef struct
+{
+  uint64_t value;
+  uint64_t power;
+  bool valid;
+} container_hash_t;
+
 struct Container_tag
 {
   void *core;
   container_type_e type;
+  bool view;              /// The core is a view of other container and doesn`t own the elements
+  container_hash_t *hash; /// The tracked hash or NULL if the hash isn`t tracked
 };
 //_____ M A C R O S ___________________________________________________________
 //_____ V A R I A B L E S _____________________________________________________
 //_____ P R I V A T E  F U N C T I O N S_______________________________________
-//_____ P U B L I C  F U N C T I O N S_________________________________________
-/**
- * \brief Initializes the container allocator with custom memory functions.
- *
- * Detailed description see in container.h
+/*
+ * Creates the core of the type. The vector pool is allocated for `capacity` elements, other cores allocate on demand.
  */
-void container_alloc_init(allocate_fn_t alloc_cb, free_fn_t free_cb)
+static void *core_create(size_t esize, container_type_e type, size_t capacity)
 {
-  UC_ASSERT(alloc_cb);
-  UC_ASSERT(free_cb);
-
-  allocation_cb_register(alloc_cb);
-  free_cb_register(free_cb);
+  return ((CONTAINER_LINKED_LIST_BASED == type)
+            ? (void *)linked_list_create(esize)
+            : ((CONTAINER_VECTOR_BASED == type)
+                 ? (void *)vector_create_reserved(esize, capacity)
+                 : ((CONTAINER_UNROLLED_LIST_BASED == type)
+                      ? (void *)unrolled_list_create(esize)
+                      : ((CONTAINER_TIERED_VECTOR_BASED == type) ? (void *)tiered_vector_create(esize) : NULL))));
 }
 
-/**
- * \brief Creates a new container of a specified type.
- *
- * Detailed description see in container.h
- */
-container_t *container_create(size_t esize, container_type_e type)
+static container_t *container_allocate(size_t esize, container_type_e type, size_t capacity)
 {
   UC_ASSERT(0 != esize);
 
@@ -71,9 +88,9 @@ container_t *container_create(size_t esize, container_type_e type)
   }
 
   container->type = type;
-  container->core =
-    ((CONTAINER_LINKED_LIST_BASED == type) ? (void *)linked_list_create(esize)
-                                           : ((CONTAINER_VECTOR_BASED == type) ? (void *)vector_create(esize) : NULL));
+  container->view = false;
+  container->hash = NULL;
+  container->core = core_create(esize, type, capacity);
 
   if (container->core == NULL)
   {
@@ -84,6 +101,193 @@ container_t *container_create(size_t esize, container_type_e type)
   return container;
 }
 
+static void core_delete(void *core, container_type_e type, bool view)
+{
+  if (view)
+  {
+    if (CONTAINER_LINKED_LIST_BASED == type)
+    {
+      linked_list_t *pointer = (linked_list_t *)core;
+      linked_list_view_delete(&pointer);
+    }
+    else if (CONTAINER_VECTOR_BASED == type)
+    {
+      vector_t *pointer = (vector_t *)core;
+      vector_view_delete(&pointer);
+    }
+    else if (CONTAINER_UNROLLED_LIST_BASED == type)
+    {
+      unrolled_list_t *pointer = (unrolled_list_t *)core;
+      unrolled_list_view_delete(&pointer);
+    }
+    else if (CONTAINER_TIERED_VECTOR_BASED == type)
+    {
+      tiered_vector_t *pointer = (tiered_vector_t *)core;
+      tiered_vector_view_delete(&pointer);
+    }
+  }
+  else if (CONTAINER_LINKED_LIST_BASED == type)
+  {
+    linked_list_t *pointer = (linked_list_t *)core;
+    linked_list_delete(&pointer);
+  }
+  else if (CONTAINER_VECTOR_BASED == type)
+  {
+    vector_t *pointer = (vector_t *)core;
+    vector_delete(&pointer);
+  }
+  else if (CONTAINER_UNROLLED_LIST_BASED == type)
+  {
+    unrolled_list_t *pointer = (unrolled_list_t *)core;
+    unrolled_list_delete(&pointer);
+  }
+  else if (CONTAINER_TIERED_VECTOR_BASED == type)
+  {
+    tiered_vector_t *pointer = (tiered_vector_t *)core;
+    tiered_vector_delete(&pointer);
+  }
+}
+
+static bool splice_mixed(container_t *dst, size_t index, container_t *src)
+{
+  size_t count = container_size(src);
+
+  // Vector stores elements contiguously, so its pool can be inserted directly
+  if (CONTAINER_VECTOR_BASED == src->type)
+  {
+    if (!container_insert_range(dst, container_cpeek(src, 0), index, count))
+    {
+      return false;
+    }
+
+    return container_erase_range(src, 0, count);
+  }
+
+  allocate_fn_t mem_allocate = get_allocator();
+  free_fn_t mem_free = get_free();
+
+  void *buffer = mem_allocate(count * container_esize(src));
+  if (NULL == buffer)
+  {
+    return false;
+  }
+
+  bool status = container_extract_range(src, buffer, 0, count);
+  if (status && !container_insert_range(dst, buffer, index, count))
+  {
+    // Give the elements back so the source is left untouched
+    container_insert_range(src, buffer, 0, count);
+    status = false;
+  }
+
+  mem_free(buffer);
+
+  return status;
+}
+
+/*
+ * The element digest is the CRC32C of the element spread over 64 bits by the splitmix64 finalizer.
+ */
+static uint64_t hash_element(const void *data, size_t esize)
+{
+  uint64_t z = (uint64_t)uc_crc32c(0, data, esize) + HASH_BASE;
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+  return z ^ (z >> 31);
+}
+
+/*
+ * The hash of the elements x[0]..x[n-1] is the sum of digest(x[i]) * HASH_BASE^(n-1-i) modulo 2^64,
+ * so the elements can be added and removed at both ends in O(1).
+ */
+static uint64_t hash_compute(const container_t *container, uint64_t *power)
+{
+  size_t esize = container_esize(container);
+  uint64_t value = 0;
+  *power = 1;
+
+  container_cursor_t cursor = container_cursor(container, 0);
+  for (; container_cursor_valid(&cursor); container_cursor_next(&cursor))
+  {
+    value = value * HASH_BASE + hash_element(container_cursor_cdata(&cursor), esize);
+    *power *= HASH_BASE;
+  }
+
+  return value;
+}
+
+/*
+ * Any change of the elements except the push and pop at the ends invalidates the tracked hash,
+ * it is recomputed by the next `container_hash` call.
+ */
+static inline void hash_drop(const container_t *container)
+{
+  if (NULL != container->hash)
+  {
+    container->hash->valid = false;
+  }
+}
+
+static inline void hash_reset(const container_t *container)
+{
+  if (NULL != container->hash)
+  {
+    container->hash->value = 0;
+    container->hash->power = 1;
+    container->hash->valid = true;
+  }
+}
+
+static void hash_push(const container_t *container, const void *data, bool front)
+{
+  container_hash_t *hash = container->hash;
+  if (NULL == hash || !hash->valid)
+  {
+    return;
+  }
+
+  uint64_t element = hash_element(data, container_esize(container));
+  hash->value = (front) ? hash->value + element * hash->power : hash->value * HASH_BASE + element;
+  hash->power *= HASH_BASE;
+}
+
+static void hash_pop(const container_t *container, const void *data, bool front)
+{
+  container_hash_t *hash = container->hash;
+  if (NULL == hash || !hash->valid)
+  {
+    return;
+  }
+
+  uint64_t element = hash_element(data, container_esize(container));
+  hash->power *= HASH_BASE_INV;
+  hash->value = (front) ? hash->value - element * hash->power : (hash->value - element) * HASH_BASE_INV;
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * \brief Initializes the container allocator with custom memory functions.
+ *
+ * Detailed description see in container.h
+ */
+void container_alloc_init(allocate_fn_t alloc_cb, free_fn_t free_cb)
+{
+  UC_ASSERT(alloc_cb);
+  UC_ASSERT(free_cb);
+
+  allocation_cb_register(alloc_cb);
+  free_cb_register(free_cb);
+}
+
+/**
+ * \brief Creates a new container of a specified type.
+ *
+ * Detailed description see in container.h
+ */
+container_t *container_create(size_t esize, container_type_e type)
+{
+  return container_allocate(esize, type, 0);
+}
+
 #if 0
 container_t* container_from_array(void *arr, size_t size, size_t esize)
 {
@@ -119,15 +323,11 @@ void container_delete(container_t **container)
 
   free_fn_t mem_free = get_free();
 
-  if (CONTAINER_LINKED_LIST_BASED == (*container)->type)
-  {
-    linked_list_t *pointer = (linked_list_t *)((*container)->core);
-    linked_list_delete(&pointer);
-  }
-  else if (CONTAINER_VECTOR_BASED == (*container)->type)
+  core_delete((*container)->core, (*container)->type, (*container)->view);
+
+  if (NULL != (*container)->hash)
   {
-    vector_t *pointer = (vector_t *)((*container)->core);
-    vector_delete(&pointer);
+    mem_free((*container)->hash);
   }
 
   mem_free(*container);
@@ -143,11 +343,17 @@ bool container_resize(container_t *container, size_t new_size)
 {
   UC_ASSERT(container);
 
+  hash_drop(container);
+
   return ((CONTAINER_LINKED_LIST_BASED == container->type)
             ? ((linked_list_t *)container->core)->resize(((linked_list_t *)container->core), new_size)
             : ((CONTAINER_VECTOR_BASED == container->type)
                  ? ((vector_t *)container->core)->resize(((vector_t *)container->core), new_size)
-                 : false));
+                 : ((CONTAINER_UNROLLED_LIST_BASED == container->type)
+                      ? ((unrolled_list_t *)container->core)->resize(((unrolled_list_t *)container->core), new_size)
+                      : ((CONTAINER_TIERED_VECTOR_BASED == container->type)
+                           ? ((tiered_vector_t *)container->core)->resize(((tiered_vector_t *)container->core), new_size)
+                           : false))));
 }
 
 /**
@@ -160,11 +366,22 @@ bool container_push_front(container_t *container, const void *data)
   UC_ASSERT(container);
   UC_ASSERT(data);
 
-  return ((CONTAINER_LINKED_LIST_BASED == container->type)
-            ? ((linked_list_t *)container->core)->push_front(((linked_list_t *)container->core), data)
-            : ((CONTAINER_VECTOR_BASED == container->type)
-                 ? ((vector_t *)container->core)->push_front(((vector_t *)container->core), data)
-                 : false));
+  bool status = ((CONTAINER_LINKED_LIST_BASED == container->type)
+                   ? ((linked_list_t *)container->core)->push_front(((linked_list_t *)container->core), data)
+                   : ((CONTAINER_VECTOR_BASED == container->type)
+                        ? ((vector_t *)container->core)->push_front(((vector_t *)container->core), data)
+                        : ((CONTAINER_UNROLLED_LIST_BASED == container->type)
+                             ? ((unrolled_list_t *)container->core)->push_front(((unrolled_list_t *)container->core), data)
+                             : ((CONTAINER_TIERED_VECTOR_BASED == container->type)
+                                  ? ((tiered_vector_t *)container->core)->push_front(((tiered_vector_t *)container->core), data)
+                                  : false))));
+
+  if (status)
+  {
+    hash_push(container, data, true);
+  }
+
+  return status;
 }
 
 /**
@@ -177,11 +394,22 @@ bool container_pop_front(container_t *container, void *data)
   UC_ASSERT(container);
   UC_ASSERT(data);
 
-  return ((CONTAINER_LINKED_LIST_BASED == container->type)
-            ? ((linked_list_t *)container->core)->pop_front(((linked_list_t *)container->core), data)
-            : ((CONTAINER_VECTOR_BASED == container->type)
-                 ? ((vector_t *)container->core)->pop_front(((vector_t *)container->core), data)
-                 : false));
+  bool status = ((CONTAINER_LINKED_LIST_BASED == container->type)
+                   ? ((linked_list_t *)container->core)->pop_front(((linked_list_t *)container->core), data)
+                   : ((CONTAINER_VECTOR_BASED == container->type)
+                        ? ((vector_t *)container->core)->pop_front(((vector_t *)container->core), data)
+                        : ((CONTAINER_UNROLLED_LIST_BASED == container->type)
+                             ? ((unrolled_list_t *)container->core)->pop_front(((unrolled_list_t *)container->core), data)
+                             : ((CONTAINER_TIERED_VECTOR_BASED == container->type)
+                                  ? ((tiered_vector_t *)container->core)->pop_front(((tiered_vector_t *)container->core), data)
+                                  : false))));
+
+  if (status)
+  {
+    hash_pop(container, data, true);
+  }
+
+  return status;
 }
 
 /**
@@ -194,11 +422,22 @@ bool container_push_back(container_t *container, const void *data)
   UC_ASSERT(container);
   UC_ASSERT(data);
 
-  return ((CONTAINER_LINKED_LIST_BASED == container->type)
-            ? ((linked_list_t *)container->core)->push_back(((linked_list_t *)container->core), data)
-            : ((CONTAINER_VECTOR_BASED == container->type)
-                 ? ((vector_t *)container->core)->push_back(((vector_t *)container->core), data)
-                 : false));
+  bool status = ((CONTAINER_LINKED_LIST_BASED == container->type)
+                   ? ((linked_list_t *)container->core)->push_back(((linked_list_t *)container->core), data)
+                   : ((CONTAINER_VECTOR_BASED == container->type)
+                        ? ((vector_t *)container->core)->push_back(((vector_t *)container->core), data)
+                        : ((CONTAINER_UNROLLED_LIST_BASED == container->type)
+                             ? ((unrolled_list_t *)container->core)->push_back(((unrolled_list_t *)container->core), data)
+                             : ((CONTAINER_TIERED_VECTOR_BASED == container->type)
+                                  ? ((tiered_vector_t *)container->core)->push_back(((tiered_vector_t *)container->core), data)
+                                  : false))));
+
+  if (status)
+  {
+    hash_push(container, data, false);
+  }
+
+  return status;
 }
 
 /**
@@ -211,11 +450,22 @@ bool container_pop_back(container_t *container, void *data)
   UC_ASSERT(container);
   UC_ASSERT(data);
 
-  return ((CONTAINER_LINKED_LIST_BASED == container->type)
-            ? ((linked_list_t *)container->core)->pop_back(((linked_list_t *)container->core), data)
-            : ((CONTAINER_VECTOR_BASED == container->type)
-                 ? ((vector_t *)container->core)->pop_back(((vector_t *)container->core), data)
-                 : false));
+  bool status = ((CONTAINER_LINKED_LIST_BASED == container->type)
+                   ? ((linked_list_t *)container->core)->pop_back(((linked_list_t *)container->core), data)
+                   : ((CONTAINER_VECTOR_BASED == container->type)
+                        ? ((vector_t *)container->core)->pop_back(((vector_t *)container->core), data)
+                        : ((CONTAINER_UNROLLED_LIST_BASED == container->type)
+                             ? ((unrolled_list_t *)container->core)->pop_back(((unrolled_list_t *)container->core), data)
+                             : ((CONTAINER_TIERED_VECTOR_BASED == container->type)
+                                  ? ((tiered_vector_t *)container->core)->pop_back(((tiered_vector_t *)container->core), data)
+                                  : false))));
+
+  if (status)
+  {
+    hash_pop(container, data, false);
+  }
+
+  return status;
 }
 
 /**
@@ -228,11 +478,17 @@ bool container_insert(container_t *container, const void *data, size_t index)
   UC_ASSERT(container);
   UC_ASSERT(data);
 
+  hash_drop(container);
+
   return ((CONTAINER_LINKED_LIST_BASED == container->type)
             ? ((linked_list_t *)container->core)->insert(((linked_list_t *)container->core), data, index)
             : ((CONTAINER_VECTOR_BASED == container->type)
                  ? ((vector_t *)container->core)->insert(((vector_t *)container->core), data, index)
-                 : false));
+                 : ((CONTAINER_UNROLLED_LIST_BASED == container->type)
+                      ? ((unrolled_list_t *)container->core)->insert(((unrolled_list_t *)container->core), data, index)
+                      : ((CONTAINER_TIERED_VECTOR_BASED == container->type)
+                           ? ((tiered_vector_t *)container->core)->insert(((tiered_vector_t *)container->core), data, index)
+                           : false))));
 }
 
 /**
@@ -245,11 +501,17 @@ bool container_extract(container_t *container, void *data, size_t index)
   UC_ASSERT(container);
   UC_ASSERT(data);
 
+  hash_drop(container);
+
   return ((CONTAINER_LINKED_LIST_BASED == container->type)
             ? ((linked_list_t *)container->core)->extract(((linked_list_t *)container->core), data, index)
             : ((CONTAINER_VECTOR_BASED == container->type)
                  ? ((vector_t *)container->core)->extract(((vector_t *)container->core), data, index)
-                 : false));
+                 : ((CONTAINER_UNROLLED_LIST_BASED == container->type)
+                      ? ((unrolled_list_t *)container->core)->extract(((unrolled_list_t *)container->core), data, index)
+                      : ((CONTAINER_TIERED_VECTOR_BASED == container->type)
+                           ? ((tiered_vector_t *)container->core)->extract(((tiered_vector_t *)container->core), data, index)
+                           : false))));
 }
 
 /**
@@ -262,11 +524,17 @@ bool container_replace(container_t *container, const void *data, size_t index)
   UC_ASSERT(container);
   UC_ASSERT(data);
 
+  hash_drop(container);
+
   return ((CONTAINER_LINKED_LIST_BASED == container->type)
             ? ((linked_list_t *)container->core)->replace(((linked_list_t *)container->core), data, index)
             : ((CONTAINER_VECTOR_BASED == container->type)
                  ? ((vector_t *)container->core)->replace(((vector_t *)container->core), data, index)
-                 : false));
+                 : ((CONTAINER_UNROLLED_LIST_BASED == container->type)
+                      ? ((unrolled_list_t *)container->core)->replace(((unrolled_list_t *)container->core), data, index)
+                      : ((CONTAINER_TIERED_VECTOR_BASED == container->type)
+                           ? ((tiered_vector_t *)container->core)->replace(((tiered_vector_t *)container->core), data, index)
+                           : false))));
 }
 
 /**
@@ -283,7 +551,11 @@ bool container_at(const container_t *container, void *data, size_t index)
             ? ((linked_list_t *)container->core)->at(((linked_list_t *)container->core), data, index)
             : ((CONTAINER_VECTOR_BASED == container->type)
                  ? ((vector_t *)container->core)->at(((vector_t *)container->core), data, index)
-                 : false));
+                 : ((CONTAINER_UNROLLED_LIST_BASED == container->type)
+                      ? ((unrolled_list_t *)container->core)->at(((unrolled_list_t *)container->core), data, index)
+                      : ((CONTAINER_TIERED_VECTOR_BASED == container->type)
+                           ? ((tiered_vector_t *)container->core)->at(((tiered_vector_t *)container->core), data, index)
+                           : false))));
 }
 
 /**
@@ -295,11 +567,17 @@ bool container_erase(container_t *container, size_t index)
 {
   UC_ASSERT(container);
 
+  hash_drop(container);
+
   return ((CONTAINER_LINKED_LIST_BASED == container->type)
             ? ((linked_list_t *)container->core)->erase(((linked_list_t *)container->core), index)
             : ((CONTAINER_VECTOR_BASED == container->type)
                  ? ((vector_t *)container->core)->erase(((vector_t *)container->core), index)
-                 : false));
+                 : ((CONTAINER_UNROLLED_LIST_BASED == container->type)
+                      ? ((unrolled_list_t *)container->core)->erase(((unrolled_list_t *)container->core), index)
+                      : ((CONTAINER_TIERED_VECTOR_BASED == container->type)
+                           ? ((tiered_vector_t *)container->core)->erase(((tiered_vector_t *)container->core), index)
+                           : false))));
 }
 
 /**
@@ -311,11 +589,42 @@ void *container_peek(const container_t *container, size_t index)
 {
   UC_ASSERT(container);
 
+  hash_drop(container);
+
+  return ((CONTAINER_LINKED_LIST_BASED == container->type)
+            ? ((linked_list_t *)container->core)->peek(((linked_list_t *)container->core), index)
+            : ((CONTAINER_VECTOR_BASED == container->type)
+                 ? ((vector_t *)container->core)->peek(((vector_t *)container->core), index)
+                 : ((CONTAINER_UNROLLED_LIST_BASED == container->type)
+                      ? ((unrolled_list_t *)container->core)->peek(((unrolled_list_t *)container->core), index)
+                      : ((CONTAINER_TIERED_VECTOR_BASED == container->type)
+                           ? ((tiered_vector_t *)container->core)->peek(((tiered_vector_t *)container->core), index)
+                           : NULL))));
+}
+
+/**
+ * \brief Returns a read-only pointer to an element at a specified index in the container.
+ *
+ * Detailed description see in container.h
+ */
+const void *container_cpeek(const container_t *container, size_t index)
+{
+  UC_ASSERT(container);
+
+  if (container->view)
+  {
+    return view_cpeek(container->core, index);
+  }
+
   return ((CONTAINER_LINKED_LIST_BASED == container->type)
             ? ((linked_list_t *)container->core)->peek(((linked_list_t *)container->core), index)
             : ((CONTAINER_VECTOR_BASED == container->type)
                  ? ((vector_t *)container->core)->peek(((vector_t *)container->core), index)
-                 : NULL));
+                 : ((CONTAINER_UNROLLED_LIST_BASED == container->type)
+                      ? ((unrolled_list_t *)container->core)->peek(((unrolled_list_t *)container->core), index)
+                      : ((CONTAINER_TIERED_VECTOR_BASED == container->type)
+                           ? ((tiered_vector_t *)container->core)->peek(((tiered_vector_t *)container->core), index)
+                           : NULL))));
 }
 
 /**
@@ -327,11 +636,17 @@ size_t container_clear(const container_t *container)
 {
   UC_ASSERT(container);
 
+  hash_reset(container);
+
   return ((CONTAINER_LINKED_LIST_BASED == container->type)
             ? ((linked_list_t *)container->core)->clear(((linked_list_t *)container->core))
             : ((CONTAINER_VECTOR_BASED == container->type)
                  ? ((vector_t *)container->core)->clear(((vector_t *)container->core))
-                 : false));
+                 : ((CONTAINER_UNROLLED_LIST_BASED == container->type)
+                      ? ((unrolled_list_t *)container->core)->clear(((unrolled_list_t *)container->core))
+                      : ((CONTAINER_TIERED_VECTOR_BASED == container->type)
+                           ? ((tiered_vector_t *)container->core)->clear(((tiered_vector_t *)container->core))
+                           : false))));
 }
 
 /**
@@ -347,7 +662,11 @@ size_t container_size(const container_t *container)
             ? ((linked_list_t *)container->core)->size(((linked_list_t *)container->core))
             : ((CONTAINER_VECTOR_BASED == container->type)
                  ? ((vector_t *)container->core)->size(((vector_t *)container->core))
-                 : false));
+                 : ((CONTAINER_UNROLLED_LIST_BASED == container->type)
+                      ? ((unrolled_list_t *)container->core)->size(((unrolled_list_t *)container->core))
+                      : ((CONTAINER_TIERED_VECTOR_BASED == container->type)
+                           ? ((tiered_vector_t *)container->core)->size(((tiered_vector_t *)container->core))
+                           : false))));
 }
 
 /**
@@ -363,5 +682,888 @@ size_t container_esize(const container_t *container)
             ? ((linked_list_t *)container->core)->esize(((linked_list_t *)container->core))
             : ((CONTAINER_VECTOR_BASED == container->type)
                  ? ((vector_t *)container->core)->esize(((vector_t *)container->core))
-                 : false));
+                 : ((CONTAINER_UNROLLED_LIST_BASED == container->type)
+                      ? ((unrolled_list_t *)container->core)->esize(((unrolled_list_t *)container->core))
+                      : ((CONTAINER_TIERED_VECTOR_BASED == container->type)
+                           ? ((tiered_vector_t *)container->core)->esize(((tiered_vector_t *)container->core))
+                           : false))));
+}
+
+/**
+ * \brief Reserves a new element at the front of the container and returns a pointer to it.
+ *
+ * Detailed description see in container.h
+ */
+void *container_emplace_front(container_t *container)
+{
+  UC_ASSERT(container);
+
+  return container_emplace_at(container, 0);
+}
+
+/**
+ * \brief Reserves a new element at the back of the container and returns a pointer to it.
+ *
+ * Detailed description see in container.h
+ */
+void *container_emplace_back(container_t *container)
+{
+  UC_ASSERT(container);
+
+  return container_emplace_at(container, container_size(container));
+}
+
+/**
+ * \brief Reserves a new element at a specified index in the container and returns a pointer to it.
+ *
+ * Detailed description see in container.h
+ */
+void *container_emplace_at(container_t *container, size_t index)
+{
+  UC_ASSERT(container);
+
+  hash_drop(container);
+
+  return ((CONTAINER_LINKED_LIST_BASED == container->type)
+            ? ((linked_list_t *)container->core)->emplace(((linked_list_t *)container->core), index)
+            : ((CONTAINER_VECTOR_BASED == container->type)
+                 ? ((vector_t *)container->core)->emplace(((vector_t *)container->core), index)
+                 : ((CONTAINER_UNROLLED_LIST_BASED == container->type)
+                      ? ((unrolled_list_t *)container->core)->emplace(((unrolled_list_t *)container->core), index)
+                      : ((CONTAINER_TIERED_VECTOR_BASED == container->type)
+                           ? ((tiered_vector_t *)container->core)->emplace(((tiered_vector_t *)container->core), index)
+                           : NULL))));
+}
+
+/**
+ * \brief Removes the front element of the container and returns a pointer to it without copying.
+ *
+ * Detailed description see in container.h
+ */
+void *container_acquire_front(container_t *container)
+{
+  UC_ASSERT(container);
+
+  hash_drop(container);
+
+  return ((CONTAINER_LINKED_LIST_BASED == container->type)
+            ? ((linked_list_t *)container->core)->acquire_front(((linked_list_t *)container->core))
+            : ((CONTAINER_VECTOR_BASED == container->type)
+                 ? ((vector_t *)container->core)->acquire_front(((vector_t *)container->core))
+                 : ((CONTAINER_UNROLLED_LIST_BASED == container->type)
+                      ? ((unrolled_list_t *)container->core)->acquire_front(((unrolled_list_t *)container->core))
+                      : ((CONTAINER_TIERED_VECTOR_BASED == container->type)
+                           ? ((tiered_vector_t *)container->core)->acquire_front(((tiered_vector_t *)container->core))
+                           : NULL))));
+}
+
+/**
+ * \brief Pops several elements from the front of the container in one operation.
+ *
+ * Detailed description see in container.h
+ */
+bool container_pop_front_n(container_t *container, void *data, size_t count)
+{
+  UC_ASSERT(container);
+  UC_ASSERT(data);
+
+  return container_extract_range(container, data, 0, count);
+}
+
+/**
+ * \brief Pops several elements from the back of the container in one operation.
+ *
+ * Detailed description see in container.h
+ */
+bool container_pop_back_n(container_t *container, void *data, size_t count)
+{
+  UC_ASSERT(container);
+  UC_ASSERT(data);
+
+  size_t size = container_size(container);
+  if (count > size)
+  {
+    return false;
+  }
+
+  return container_extract_range(container, data, size - count, count);
+}
+
+/**
+ * \brief Extracts a range of elements from the container in one operation.
+ *
+ * Detailed description see in container.h
+ */
+bool container_extract_range(container_t *container, void *data, size_t index, size_t count)
+{
+  UC_ASSERT(container);
+  UC_ASSERT(data);
+
+  hash_drop(container);
+
+  return ((CONTAINER_LINKED_LIST_BASED == container->type)
+            ? ((linked_list_t *)container->core)->extract_range(((linked_list_t *)container->core), data, index, count)
+            : ((CONTAINER_VECTOR_BASED == container->type)
+                 ? ((vector_t *)container->core)->extract_range(((vector_t *)container->core), data, index, count)
+                 : ((CONTAINER_UNROLLED_LIST_BASED == container->type)
+                      ? ((unrolled_list_t *)container->core)->extract_range(((unrolled_list_t *)container->core), data, index, count)
+                      : ((CONTAINER_TIERED_VECTOR_BASED == container->type)
+                           ? ((tiered_vector_t *)container->core)->extract_range(((tiered_vector_t *)container->core), data, index, count)
+                           : false))));
+}
+
+/**
+ * \brief Inserts an array of elements at a specified index in the container in one operation.
+ *
+ * Detailed description see in container.h
+ */
+bool container_insert_range(container_t *container, const void *data, size_t index, size_t count)
+{
+  UC_ASSERT(container);
+  UC_ASSERT(data);
+
+  hash_drop(container);
+
+  return ((CONTAINER_LINKED_LIST_BASED == container->type)
+            ? ((linked_list_t *)container->core)->insert_range(((linked_list_t *)container->core), data, index, count)
+            : ((CONTAINER_VECTOR_BASED == container->type)
+                 ? ((vector_t *)container->core)->insert_range(((vector_t *)container->core), data, index, count)
+                 : ((CONTAINER_UNROLLED_LIST_BASED == container->type)
+                      ? ((unrolled_list_t *)container->core)->insert_range(((unrolled_list_t *)container->core), data, index, count)
+                      : ((CONTAINER_TIERED_VECTOR_BASED == container->type)
+                           ? ((tiered_vector_t *)container->core)->insert_range(((tiered_vector_t *)container->core), data, index, count)
+                           : false))));
+}
+
+/**
+ * \brief Erases a range of elements from the container in one operation.
+ *
+ * Detailed description see in container.h
+ */
+bool container_erase_range(container_t *container, size_t first, size_t count)
+{
+  UC_ASSERT(container);
+
+  hash_drop(container);
+
+  return ((CONTAINER_LINKED_LIST_BASED == container->type)
+            ? ((linked_list_t *)container->core)->extract_range(((linked_list_t *)container->core), NULL, first, count)
+            : ((CONTAINER_VECTOR_BASED == container->type)
+                 ? ((vector_t *)container->core)->extract_range(((vector_t *)container->core), NULL, first, count)
+                 : ((CONTAINER_UNROLLED_LIST_BASED == container->type)
+                      ? ((unrolled_list_t *)container->core)->extract_range(((unrolled_list_t *)container->core), NULL, first, count)
+                      : ((CONTAINER_TIERED_VECTOR_BASED == container->type)
+                           ? ((tiered_vector_t *)container->core)->extract_range(((tiered_vector_t *)container->core), NULL, first, count)
+                           : false))));
+}
+
+/**
+ * \brief Erases all elements for which the predicate returns true.
+ *
+ * Detailed description see in container.h
+ */
+size_t container_erase_if(container_t *container, predicate_fn_t predicate)
+{
+  UC_ASSERT(container);
+  UC_ASSERT(predicate);
+
+  hash_drop(container);
+
+  return ((CONTAINER_LINKED_LIST_BASED == container->type)
+            ? ((linked_list_t *)container->core)->erase_if(((linked_list_t *)container->core), predicate)
+            : ((CONTAINER_VECTOR_BASED == container->type)
+                 ? ((vector_t *)container->core)->erase_if(((vector_t *)container->core), predicate)
+                 : ((CONTAINER_UNROLLED_LIST_BASED == container->type)
+                      ? ((unrolled_list_t *)container->core)->erase_if(((unrolled_list_t *)container->core), predicate)
+                      : ((CONTAINER_TIERED_VECTOR_BASED == container->type)
+                           ? ((tiered_vector_t *)container->core)->erase_if(((tiered_vector_t *)container->core), predicate)
+                           : 0))));
+}
+
+/**
+ * \brief Erases an element at a specified index without keeping the order of the elements.
+ *
+ * Detailed description see in container.h
+ */
+bool container_erase_unordered(container_t *container, size_t index)
+{
+  UC_ASSERT(container);
+
+  hash_drop(container);
+
+  return ((CONTAINER_LINKED_LIST_BASED == container->type)
+            ? ((linked_list_t *)container->core)->erase_unordered(((linked_list_t *)container->core), index)
+            : ((CONTAINER_VECTOR_BASED == container->type)
+                 ? ((vector_t *)container->core)->erase_unordered(((vector_t *)container->core), index)
+                 : ((CONTAINER_UNROLLED_LIST_BASED == container->type)
+                      ? ((unrolled_list_t *)container->core)->erase_unordered(((unrolled_list_t *)container->core), index)
+                      : ((CONTAINER_TIERED_VECTOR_BASED == container->type)
+                           ? ((tiered_vector_t *)container->core)->erase_unordered(((tiered_vector_t *)container->core), index)
+                           : false))));
+}
+
+/**
+ * \brief Creates a cursor which points to the element at a specified index.
+ *
+ * Detailed description see in container.h
+ */
+container_cursor_t container_cursor(const container_t *container, size_t index)
+{
+  UC_ASSERT(container);
+
+  container_cursor_t cursor = {.container = (container_t *)container, .position = NULL};
+
+  cursor.position = ((CONTAINER_LINKED_LIST_BASED == container->type)
+                       ? ((linked_list_t *)container->core)->cursor(((linked_list_t *)container->core), index)
+                       : ((CONTAINER_VECTOR_BASED == container->type)
+                            ? ((vector_t *)container->core)->cursor(((vector_t *)container->core), index)
+                            : ((CONTAINER_UNROLLED_LIST_BASED == container->type)
+                                 ? ((unrolled_list_t *)container->core)->cursor(((unrolled_list_t *)container->core), index)
+                                 : ((CONTAINER_TIERED_VECTOR_BASED == container->type)
+                                      ? ((tiered_vector_t *)container->core)->cursor(((tiered_vector_t *)container->core), index)
+                                      : NULL))));
+
+  return cursor;
+}
+
+/**
+ * \brief Checks that the cursor points to an element of the container.
+ *
+ * Detailed description see in container.h
+ */
+bool container_cursor_valid(const container_cursor_t *cursor)
+{
+  UC_ASSERT(cursor);
+
+  return (NULL != cursor->position);
+}
+
+/**
+ * \brief Moves the cursor to the next element of the container.
+ *
+ * Detailed description see in container.h
+ */
+bool container_cursor_next(container_cursor_t *cursor)
+{
+  UC_ASSERT(cursor);
+  UC_ASSERT(cursor->container);
+
+  if (NULL == cursor->position)
+  {
+    return false;
+  }
+
+  container_t *container = cursor->container;
+
+  cursor->position =
+    ((CONTAINER_LINKED_LIST_BASED == container->type)
+       ? ((linked_list_t *)container->core)->cursor_next(((linked_list_t *)container->core), cursor->position)
+       : ((CONTAINER_VECTOR_BASED == container->type)
+            ? ((vector_t *)container->core)->cursor_next(((vector_t *)container->core), cursor->position)
+            : ((CONTAINER_UNROLLED_LIST_BASED == container->type)
+                 ? ((unrolled_list_t *)container->core)->cursor_next(((unrolled_list_t *)container->core), cursor->position)
+                 : ((CONTAINER_TIERED_VECTOR_BASED == container->type)
+                      ? ((tiered_vector_t *)container->core)->cursor_next(((tiered_vector_t *)container->core), cursor->position)
+                      : NULL))));
+
+  return (NULL != cursor->position);
+}
+
+/**
+ * \brief Returns a pointer to the element which the cursor points to.
+ *
+ * Detailed description see in container.h
+ */
+void *container_cursor_data(const container_cursor_t *cursor)
+{
+  UC_ASSERT(cursor);
+  UC_ASSERT(cursor->container);
+
+  if (NULL == cursor->position)
+  {
+    return NULL;
+  }
+
+  container_t *container = cursor->container;
+
+  hash_drop(container);
+
+  return ((CONTAINER_LINKED_LIST_BASED == container->type)
+            ? ((linked_list_t *)container->core)->cursor_data(((linked_list_t *)container->core), cursor->position)
+            : ((CONTAINER_VECTOR_BASED == container->type)
+                 ? ((vector_t *)container->core)->cursor_data(((vector_t *)container->core), cursor->position)
+                 : ((CONTAINER_UNROLLED_LIST_BASED == container->type)
+                      ? ((unrolled_list_t *)container->core)->cursor_data(((unrolled_list_t *)container->core), cursor->position)
+                      : ((CONTAINER_TIERED_VECTOR_BASED == container->type)
+                           ? ((tiered_vector_t *)container->core)->cursor_data(((tiered_vector_t *)container->core), cursor->position)
+                           : NULL))));
+}
+
+/**
+ * \brief Returns a read-only pointer to the element which the cursor points to.
+ *
+ * Detailed description see in container.h
+ */
+const void *container_cursor_cdata(const container_cursor_t *cursor)
+{
+  UC_ASSERT(cursor);
+  UC_ASSERT(cursor->container);
+
+  if (NULL == cursor->position)
+  {
+    return NULL;
+  }
+
+  const container_t *container = cursor->container;
+  if (container->view)
+  {
+    return view_cursor_cdata(container->core, cursor->position);
+  }
+
+  return ((CONTAINER_LINKED_LIST_BASED == container->type)
+            ? ((linked_list_t *)container->core)->cursor_data(((linked_list_t *)container->core), cursor->position)
+            : ((CONTAINER_VECTOR_BASED == container->type)
+                 ? ((vector_t *)container->core)->cursor_data(((vector_t *)container->core), cursor->position)
+                 : ((CONTAINER_UNROLLED_LIST_BASED == container->type)
+                      ? ((unrolled_list_t *)container->core)->cursor_data(((unrolled_list_t *)container->core), cursor->position)
+                      : ((CONTAINER_TIERED_VECTOR_BASED == container->type)
+                           ? ((tiered_vector_t *)container->core)->cursor_data(((tiered_vector_t *)container->core), cursor->position)
+                           : NULL))));
+}
+
+/**
+ * \brief Erases the element which the cursor points to in O(1).
+ *
+ * Detailed description see in container.h
+ */
+bool container_cursor_erase(container_cursor_t *cursor)
+{
+  UC_ASSERT(cursor);
+  UC_ASSERT(cursor->container);
+
+  if (NULL == cursor->position)
+  {
+    return false;
+  }
+
+  container_t *container = cursor->container;
+
+  // The view can`t erase the elements of its parent
+  if (container->view)
+  {
+    return false;
+  }
+
+  hash_drop(container);
+
+  cursor->position =
+    ((CONTAINER_LINKED_LIST_BASED == container->type)
+       ? ((linked_list_t *)container->core)->erase_cursor(((linked_list_t *)container->core), cursor->position)
+       : ((CONTAINER_VECTOR_BASED == container->type)
+            ? ((vector_t *)container->core)->erase_cursor(((vector_t *)container->core), cursor->position)
+            : ((CONTAINER_UNROLLED_LIST_BASED == container->type)
+                 ? ((unrolled_list_t *)container->core)->erase_cursor(((unrolled_list_t *)container->core), cursor->position)
+                 : ((CONTAINER_TIERED_VECTOR_BASED == container->type)
+                      ? ((tiered_vector_t *)container->core)->erase_cursor(((tiered_vector_t *)container->core), cursor->position)
+                      : NULL))));
+
+  return true;
+}
+
+/**
+ * \brief Moves all elements of the source container into the destination container at a specified index.
+ *
+ * Detailed description see in container.h
+ */
+bool container_splice(container_t *dst, size_t index, container_t *src)
+{
+  UC_ASSERT(dst);
+  UC_ASSERT(src);
+
+  if (dst == src || dst->view || src->view || container_esize(dst) != container_esize(src) || index > container_size(dst))
+  {
+    return false;
+  }
+
+  hash_drop(dst);
+  hash_drop(src);
+
+  if (0 == container_size(src))
+  {
+    return true;
+  }
+
+  if (dst->type != src->type)
+  {
+    return splice_mixed(dst, index, src);
+  }
+
+  return ((CONTAINER_LINKED_LIST_BASED == dst->type)
+            ? ((linked_list_t *)dst->core)->splice(((linked_list_t *)dst->core), index, src->core)
+            : ((CONTAINER_VECTOR_BASED == dst->type)
+                 ? ((vector_t *)dst->core)->splice(((vector_t *)dst->core), index, src->core)
+                 : ((CONTAINER_UNROLLED_LIST_BASED == dst->type)
+                      ? ((unrolled_list_t *)dst->core)->splice(((unrolled_list_t *)dst->core), index, src->core)
+                      : ((CONTAINER_TIERED_VECTOR_BASED == dst->type)
+                           ? ((tiered_vector_t *)dst->core)->splice(((tiered_vector_t *)dst->core), index, src->core)
+                           : false))));
+}
+
+/**
+ * \brief Moves all elements of the source container to the end of the destination container.
+ *
+ * Detailed description see in container.h
+ */
+bool container_append(container_t *dst, container_t *src)
+{
+  UC_ASSERT(dst);
+  UC_ASSERT(src);
+
+  return container_splice(dst, container_size(dst), src);
+}
+
+/**
+ * \brief Exchanges the contents of two containers.
+ *
+ * Detailed description see in container.h
+ */
+void container_swap(container_t *a, container_t *b)
+{
+  UC_ASSERT(a);
+  UC_ASSERT(b);
+
+  void *core = a->core;
+  container_type_e type = a->type;
+  bool view = a->view;
+  container_hash_t *hash = a->hash;
+
+  a->core = b->core;
+  a->type = b->type;
+  a->view = b->view;
+  a->hash = b->hash;
+  b->core = core;
+  b->type = type;
+  b->view = view;
+  b->hash = hash;
+}
+
+/**
+ * \brief Transfers the contents of the source container to the destination container.
+ *
+ * Detailed description see in container.h
+ */
+bool container_move(container_t *dst, container_t *src)
+{
+  UC_ASSERT(dst);
+  UC_ASSERT(src);
+
+  if (dst == src)
+  {
+    return true;
+  }
+
+  if (dst->view || src->view)
+  {
+    return false;
+  }
+
+  // Create the empty core for the source first, so nothing is changed if the allocation fails
+  void *empty = core_create(container_esize(src), src->type, 0);
+  if (NULL == empty)
+  {
+    return false;
+  }
+
+  core_delete(dst->core, dst->type, dst->view);
+
+  dst->core = src->core;
+  dst->type = src->type;
+  src->core = empty;
+
+  hash_drop(dst);
+  hash_reset(src);
+
+  return true;
+}
+
+/**
+ * \brief Creates a copy of the container.
+ *
+ * Detailed description see in container.h
+ */
+container_t *container_clone(const container_t *src, container_copy_mode_e mode, copy_fn_t copy)
+{
+  UC_ASSERT(src);
+  UC_ASSERT(CONTAINER_COPY_DEEP != mode || NULL != copy);
+
+  copy_fn_t copy_cb = (CONTAINER_COPY_DEEP == mode) ? copy : NULL;
+
+  // The vector pool is allocated once for all elements of the source
+  container_t *container = container_allocate(container_esize(src), src->type, container_size(src));
+  if (NULL == container)
+  {
+    return NULL;
+  }
+
+  if (src->view)
+  {
+    // The view core has no storage of its own to copy from, so the elements are copied one by one
+    container_cursor_t cursor = container_cursor(src, 0);
+    for (; container_cursor_valid(&cursor); container_cursor_next(&cursor))
+    {
+      void *element = container_emplace_back(container);
+      if (NULL == element)
+      {
+        container_delete(&container);
+        return NULL;
+      }
+
+      if (NULL == copy_cb)
+      {
+        memcpy(element, container_cursor_cdata(&cursor), container_esize(src));
+      }
+      else
+      {
+        copy_cb(element, container_cursor_cdata(&cursor), container_esize(src));
+      }
+    }
+
+    return container;
+  }
+
+  bool status = ((CONTAINER_LINKED_LIST_BASED == src->type)
+                   ? ((linked_list_t *)container->core)->copy(((linked_list_t *)container->core), src->core, copy_cb)
+                   : ((CONTAINER_VECTOR_BASED == src->type)
+                        ? ((vector_t *)container->core)->copy(((vector_t *)container->core), src->core, copy_cb)
+                        : ((CONTAINER_UNROLLED_LIST_BASED == src->type)
+                             ? ((unrolled_list_t *)container->core)->copy(((unrolled_list_t *)container->core), src->core, copy_cb)
+                             : ((CONTAINER_TIERED_VECTOR_BASED == src->type)
+                                  ? ((tiered_vector_t *)container->core)->copy(((tiered_vector_t *)container->core), src->core, copy_cb)
+                                  : false))));
+
+  if (!status)
+  {
+    container_delete(&container);
+  }
+
+  return container;
+}
+
+/**
+ * \brief Returns a pointer to the contiguous storage of the elements.
+ *
+ * Detailed description see in container.h
+ */
+void *container_data(const container_t *container)
+{
+  UC_ASSERT(container);
+
+  hash_drop(container);
+
+  return ((CONTAINER_LINKED_LIST_BASED == container->type)
+            ? ((linked_list_t *)container->core)->data(((linked_list_t *)container->core))
+            : ((CONTAINER_VECTOR_BASED == container->type)
+                 ? ((vector_t *)container->core)->data(((vector_t *)container->core))
+                 : ((CONTAINER_UNROLLED_LIST_BASED == container->type)
+                      ? ((unrolled_list_t *)container->core)->data(((unrolled_list_t *)container->core))
+                      : ((CONTAINER_TIERED_VECTOR_BASED == container->type)
+                           ? ((tiered_vector_t *)container->core)->data(((tiered_vector_t *)container->core))
+                           : NULL))));
+}
+
+/**
+ * \brief Returns a read-only pointer to the contiguous storage of the elements.
+ *
+ * Detailed description see in container.h
+ */
+const void *container_cdata(const container_t *container)
+{
+  UC_ASSERT(container);
+
+  if (container->view)
+  {
+    return view_cdata(container->core);
+  }
+
+  return ((CONTAINER_LINKED_LIST_BASED == container->type)
+            ? ((linked_list_t *)container->core)->data(((linked_list_t *)container->core))
+            : ((CONTAINER_VECTOR_BASED == container->type)
+                 ? ((vector_t *)container->core)->data(((vector_t *)container->core))
+                 : ((CONTAINER_UNROLLED_LIST_BASED == container->type)
+                      ? ((unrolled_list_t *)container->core)->data(((unrolled_list_t *)container->core))
+                      : ((CONTAINER_TIERED_VECTOR_BASED == container->type)
+                           ? ((tiered_vector_t *)container->core)->data(((tiered_vector_t *)container->core))
+                           : NULL))));
+}
+
+/**
+ * \brief Inserts an element into the sorted container keeping it sorted.
+ *
+ * Detailed description see in container.h
+ */
+bool container_insert_sorted(container_t *container, const void *data, order_fn_t cmp)
+{
+  UC_ASSERT(container);
+  UC_ASSERT(data);
+
+  size_t size = container_size(container);
+  size_t esize = container_esize(container);
+  size_t index = 0;
+
+  const uint8_t *arr = (const uint8_t *)container_cdata(container);
+  if (NULL != arr || container_random_access(container))
+  {
+    /* Upper bound: the first element which is placed after the new one */
+    size_t count = size;
+    while (count > 0)
+    {
+      size_t half = count / 2;
+      const uint8_t *middle = (NULL != arr) ? &arr[(index + half) * esize] : (const uint8_t *)container_cpeek(container, index + half);
+      bool after = (NULL == cmp) ? (memcmp(middle, data, esize) > 0) : (GT == cmp(middle, data, esize));
+
+      index = (after) ? index : index + half + 1;
+      count = (after) ? half : count - half - 1;
+    }
+  }
+  else
+  {
+    container_cursor_t cursor = container_cursor(container, 0);
+    for (; container_cursor_valid(&cursor); container_cursor_next(&cursor), index++)
+    {
+      const void *element = container_cursor_cdata(&cursor);
+      if ((NULL == cmp) ? (memcmp(element, data, esize) > 0) : (GT == cmp(element, data, esize)))
+      {
+        break;
+      }
+    }
+  }
+
+  return container_insert(container, data, index);
+}
+
+/**
+ * \brief Reverses the order of the elements of the container in place.
+ *
+ * Detailed description see in container.h
+ */
+bool container_reverse(container_t *container)
+{
+  UC_ASSERT(container);
+
+  hash_drop(container);
+
+  return ((CONTAINER_LINKED_LIST_BASED == container->type)
+            ? ((linked_list_t *)container->core)->reverse(((linked_list_t *)container->core))
+            : ((CONTAINER_VECTOR_BASED == container->type)
+                 ? ((vector_t *)container->core)->reverse(((vector_t *)container->core))
+                 : ((CONTAINER_UNROLLED_LIST_BASED == container->type)
+                      ? ((unrolled_list_t *)container->core)->reverse(((unrolled_list_t *)container->core))
+                      : ((CONTAINER_TIERED_VECTOR_BASED == container->type)
+                           ? ((tiered_vector_t *)container->core)->reverse(((tiered_vector_t *)container->core))
+                           : false))));
+}
+
+/**
+ * \brief Rotates the elements of the container to the left in place.
+ *
+ * Detailed description see in container.h
+ */
+bool container_rotate(container_t *container, size_t count)
+{
+  UC_ASSERT(container);
+
+  hash_drop(container);
+
+  return ((CONTAINER_LINKED_LIST_BASED == container->type)
+            ? ((linked_list_t *)container->core)->rotate(((linked_list_t *)container->core), count)
+            : ((CONTAINER_VECTOR_BASED == container->type)
+                 ? ((vector_t *)container->core)->rotate(((vector_t *)container->core), count)
+                 : ((CONTAINER_UNROLLED_LIST_BASED == container->type)
+                      ? ((unrolled_list_t *)container->core)->rotate(((unrolled_list_t *)container->core), count)
+                      : ((CONTAINER_TIERED_VECTOR_BASED == container->type)
+                           ? ((tiered_vector_t *)container->core)->rotate(((tiered_vector_t *)container->core), count)
+                           : false))));
+}
+
+/**
+ * \brief Replaces the elements of the range by the value.
+ *
+ * Detailed description see in container.h
+ */
+bool container_fill(container_t *container, size_t first, size_t count, const void *data)
+{
+  UC_ASSERT(container);
+  UC_ASSERT(data);
+
+  hash_drop(container);
+
+  return ((CONTAINER_LINKED_LIST_BASED == container->type)
+            ? ((linked_list_t *)container->core)->fill(((linked_list_t *)container->core), first, count, data)
+            : ((CONTAINER_VECTOR_BASED == container->type)
+                 ? ((vector_t *)container->core)->fill(((vector_t *)container->core), first, count, data)
+                 : ((CONTAINER_UNROLLED_LIST_BASED == container->type)
+                      ? ((unrolled_list_t *)container->core)->fill(((unrolled_list_t *)container->core), first, count, data)
+                      : ((CONTAINER_TIERED_VECTOR_BASED == container->type)
+                           ? ((tiered_vector_t *)container->core)->fill(((tiered_vector_t *)container->core), first, count, data)
+                           : false))));
+}
+
+/**
+ * \brief Creates a view of a range of the elements of the container.
+ *
+ * Detailed description see in container.h
+ */
+uc_view_t *container_view(container_t *container, size_t first, size_t count, container_view_mode_e mode)
+{
+  UC_ASSERT(container);
+
+  bool writable = (CONTAINER_VIEW_MUTABLE == mode);
+  if (!is_allocator_valid() || (writable && container->view && !view_writable(container->core)))
+  {
+    return NULL;
+  }
+
+  allocate_fn_t mem_allocate = get_allocator();
+  free_fn_t mem_free = get_free();
+
+  uc_view_t *view = (uc_view_t *)mem_allocate(sizeof *view);
+  if (view == NULL)
+  {
+    return NULL;
+  }
+
+  view->type = container->type;
+  view->view = true;
+  view->hash = NULL;
+  view->core = ((CONTAINER_LINKED_LIST_BASED == container->type)
+                  ? (void *)linked_list_view_create(container, first, count, writable)
+                  : ((CONTAINER_VECTOR_BASED == container->type)
+                       ? (void *)vector_view_create(container, first, count, writable)
+                       : ((CONTAINER_UNROLLED_LIST_BASED == container->type)
+                            ? (void *)unrolled_list_view_create(container, first, count, writable)
+                            : ((CONTAINER_TIERED_VECTOR_BASED == container->type)
+                                 ? (void *)tiered_vector_view_create(container, first, count, writable)
+                                 : NULL))));
+
+  if (view->core == NULL)
+  {
+    mem_free(view);
+    return NULL;
+  }
+
+  return view;
+}
+
+/**
+ * \brief Checks if the elements of the container are accessed by the index in O(1).
+ *
+ * Detailed description see in container.h
+ */
+bool container_random_access(const container_t *container)
+{
+  UC_ASSERT(container);
+
+  // The view has the type of its parent and accesses the elements through it
+  return (CONTAINER_VECTOR_BASED == container->type) || (CONTAINER_TIERED_VECTOR_BASED == container->type);
+}
+
+/**
+ * \brief Checks if the container is a view of other container.
+ *
+ * Detailed description see in container.h
+ */
+bool container_is_view(const container_t *container)
+{
+  UC_ASSERT(container);
+
+  return container->view;
+}
+
+/**
+ * \brief Returns the order-aware hash of the elements of the container.
+ *
+ * Detailed description see in container.h
+ */
+uint64_t container_hash(const container_t *container)
+{
+  UC_ASSERT(container);
+
+  container_hash_t *hash = container->hash;
+  if (NULL != hash && hash->valid)
+  {
+    return hash->value;
+  }
+
+  uint64_t power = 1;
+  uint64_t value = hash_compute(container, &power);
+
+  if (NULL != hash)
+  {
+    hash->value = value;
+    hash->power = power;
+    hash->valid = true;
+  }
+
+  return value;
+}
+
+/**
+ * \brief Enables or disables the incremental maintenance of the hash of the container.
+ *
+ * Detailed description see in container.h
+ */
+bool container_hash_track(container_t *container, bool enable)
+{
+  UC_ASSERT(container);
+
+  if (!enable)
+  {
+    if (NULL != container->hash)
+    {
+      free_fn_t mem_free = get_free();
+      mem_free(container->hash);
+      container->hash = NULL;
+    }
+
+    return true;
+  }
+
+  if (container->view)
+  {
+    return false;
+  }
+
+  if (NULL == container->hash)
+  {
+    allocate_fn_t mem_allocate = get_allocator();
+    container->hash = (container_hash_t *)mem_allocate(sizeof *container->hash);
+    if (NULL == container->hash)
+    {
+      return false;
+    }
+
+    container->hash->valid = false;
+  }
+
+  container_hash(container);
+  return true;
+}
+
+/**
+ * \brief Returns the tracked hash without computing it.
+ *
+ * Detailed description see in container.h
+ */
+bool container_hash_cached(const container_t *container, uint64_t *hash)
+{
+  UC_ASSERT(container);
+  UC_ASSERT(hash);
+
+  if (NULL == container->hash || !container->hash->valid)
+  {
+    return false;
+  }
+
+  *hash = container->hash->value;
+  return true;
 }
@@ -18,176 +18,676 @@
 #pragma once
 
 //_____ I N C L U D E S _______________________________________________________
+#include "common/contants.h"
 #include "interface/allocator_if.h"
 
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 //_____ C O N F I G S  ________________________________________________________
 //_____ D E F I N I T I O N S _________________________________________________
 struct Container_tag;
 typedef struct Container_tag container_t;
 
 /**
- *  \brief Enumerates the types of containers available.
- */
-typedef enum ContainerType_tag
-{
-  CONTAINER_LINKED_LIST_BASED = 0, /**< Specifies a container based on a linked list. */
-  CONTAINER_VECTOR_BASED = 1,      /**< Specifies a container based on a vector (dynamic array). */
-} container_type_e;
-
-//_____ M A C R O S ___________________________________________________________
-
-//_____ V A R I A B L E S _____________________________________________________
-
-//_____ P U B L I C  F U N C T I O N S_________________________________________
-/**
- * \brief Initializes the container allocator with custom memory functions.
+ * \brief View of a range of the elements of other container.
  *
- * \param alloc_cb Callback function for memory allocation.
- * \param free_cb Callback function for memory deallocation.
+ * The view is a container itself, so it can be passed to any function which accepts the container.
  */
-void container_alloc_init(allocate_fn_t alloc_cb, free_fn_t free_cb);
+typedef struct Container_tag uc_view_t;
 
 /**
- * \brief Creates a new container of a specified type.
+ * \brief Callback function for element selection.
  *
- * \param esize Size in bytes of the single element that this container will store.
- * \param type Type of the container to be created.
- * \return Pointer to the newly created container or NULL if creation failed.
+ * \note All custom function which will be pass in function in `predicate` argument must follow this prototype.
  */
-container_t *container_create(size_t esize, container_type_e type);
+typedef bool (*predicate_fn_t)(const void *data, size_t esize);
 
 /**
- * \brief Frees up the memory associated with the container.
+ * \brief Function prototype for element copy callback used by deep copy of the container.
  *
- * \param container Double pointer to the container to be deleted.
- */
-void container_delete(container_t **container);
-
-/**
- * \brief Resizes the container to a new size.
+ * The callback receives uninitialized element storage in the new container and must fill it
+ * with a copy of the source element, duplicating the resources which the element owns.
  *
- * \param container Pointer to the container.
- * \param new_size The new size for the container.
- * \return true if resizing was successful, false otherwise.
+ * \note All custom function which will be pass in function in `copy` argument must follow this prototype.
  */
-bool container_resize(container_t *container, size_t new_size);
+typedef void (*copy_fn_t)(void *dst, const void *src, size_t esize);
 
 /**
- * \brief Pushes an element to the front of the container.
+ * \brief Function prototype for element ordering callback used by ordered insertion.
  *
- * \param container Pointer to the container.
- * \param data Pointer to the data to be pushed.
- * \return true if the operation was successful, false otherwise.
+ * The callback returns `LE` if the first element must be placed before the second one, `GT` if after
+ * and `EQ` if the elements are equal. It has the same prototype as the comparison callbacks of the algorithms.
  */
-bool container_push_front(container_t *container, const void *data);
+typedef cmp_t (*order_fn_t)(const void *data1, const void *data2, size_t esize);
 
 /**
- * \brief Pops an element from the front of the container.
+ * \brief Position of an element inside the container.
  *
- * \param container Pointer to the container.
- * \param data Pointer to store the popped data.
- * \return true if the operation was successful, false otherwise.
+ * The cursor allows to walk through the container without looking up every element by its index,
+ * which costs O(N) for the linked list based container. Any modification of the container which is not
+ * done through the cursor itself invalidates the cursor.
  */
-bool container_pop_front(container_t *container, void *data);
+typedef struct
+{
+  container_t *container; /**< The container which the cursor walks through. */
+  void *position;         /**< Core specific position of the element or NULL if the cursor is out of the container. */
+} container_cursor_t;
 
 /**
- * \brief Pushes an element to the back of the container.
- *
- * \param container Pointer to the container.
- * \param data Pointer to the data to be pushed.
- * \return true if the operation was successful, false otherwise.
+ * \brief Enumerates the copy modes of the container.
  */
-bool container_push_back(container_t *container, const void *data);
+typedef enum
+{
+  CONTAINER_COPY_SHALLOW = 0, /**< Elements are copied byte by byte. */
+  CONTAINER_COPY_DEEP,        /**< Elements are copied by the user callback. */
+} container_copy_mode_e;
 
 /**
- * \brief Pops an element from the back of the container.
- *
- * \param container Pointer to the container.
- * \param data Pointer to store the popped data.
- * \return true if the operation was successful, false otherwise.
+ * \brief Enumerates the access modes of the view.
  */
-bool container_pop_back(container_t *container, void *data);
+typedef enum
+{
+  CONTAINER_VIEW_READ_ONLY = 0, /**< Elements can only be read through the view. */
+  CONTAINER_VIEW_MUTABLE,       /**< Elements can be replaced through the view, their number can`t be changed. */
+} container_view_mode_e;
 
 /**
- * \brief Inserts an element at a specified index in the container.
- *
- * \param container Pointer to the container.
- * \param data Pointer to the data to be inserted.
- * \param index The index at which the data should be inserted.
- * \return true if the operation was successful, false otherwise.
+ *  \brief Enumerates the types of containers available.
  */
-bool container_insert(container_t *container, const void *data, size_t index);
+typedef enum ContainerType_tag
+{
+  CONTAINER_LINKED_LIST_BASED = 0,   /**< Specifies a container based on a linked list. */
+  CONTAINER_VECTOR_BASED = 1,        /**< Specifies a container based on a vector (dynamic array). */
+  CONTAINER_UNROLLED_LIST_BASED = 2, /**< Specifies a container based on an unrolled list (linked chunks of elements). */
+  CONTAINER_TIERED_VECTOR_BASED = 3, /**< Specifies a container based on a tiered vector (sqrt(N) wide circular tiers). */
+} container_type_e;
 
-/**
- * \brief Extracts an element from a specified index in the container.
- *
- * \param container Pointer to the container.
- * \param data Pointer to store the extracted data.
- * \param index The index from which the data should be extracted.
- * \return true if the operation was successful, false otherwise.
- */
-bool container_extract(container_t *container, void *data, size_t index);
+//_____ M A C R O S ___________________________________________________________
 
-/**
- * \brief Replaces an element at a specified index in the container.
- *
- * \param container Pointer to the container.
- * \param data Pointer to the data to replace the current one.
- * \param index The index at which the data should be replaced.
- * \return true if the operation was successful, false otherwise.
- */
-bool container_replace(container_t *container, const void *data, size_t index);
+//_____ V A R I A B L E S _____________________________________________________
 
-/**
- * \brief Retrieves an element from a specified index in the container.
- *
- * \param container Pointer to the container.
- * \param data Pointer to store the retrieved data.
- * \param index The index from which the data should be retrieved.
- * \return true if the operation was successful, false otherwise.
- */
-bool container_at(const container_t *container, void *data, size_t index);
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/* C++ detection */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+  /**
+   * \brief Initializes the container allocator with custom memory functions.
+   *
+   * \param alloc_cb Callback function for memory allocation.
+   * \param free_cb Callback function for memory deallocation.
+   */
+  void container_alloc_init(allocate_fn_t alloc_cb, free_fn_t free_cb);
 
-/**
- * \brief Erases an element at a specified index in the container.
- *
- * \param container Pointer to the container.
- * \param index The index at which the element should be erased.
- * \return true if the operation was successful, false otherwise.
- */
-bool container_erase(container_t *container, size_t index);
+  /**
+   * \brief Creates a new container of a specified type.
+   *
+   * \param esize Size in bytes of the single element that this container will store.
+   * \param type Type of the container to be created.
+   * \return Pointer to the newly created container or NULL if creation failed.
+   */
+  container_t *container_create(size_t esize, container_type_e type);
 
-/**
- * \brief Peeks at an element at a specified index in the container without removing it.
- *
- * \param container Pointer to the container.
- * \param index The index from which the data should be peeked.
- * \return Pointer to the peeked data or NULL.
- */
-void *container_peek(const container_t *container, size_t index);
+  /**
+   * \brief Frees up the memory associated with the container.
+   *
+   * \param container Double pointer to the container to be deleted.
+   */
+  void container_delete(container_t **container);
 
-/**
- * \brief Clears all the elements from the container.
- *
- * \param container Pointer to the container.
- * \return true if the operation was successful, false otherwise.
- */
-size_t container_clear(const container_t *container);
+  /**
+   * \brief Resizes the container to a new size.
+   *
+   * \param container Pointer to the container.
+   * \param new_size The new size for the container.
+   * \return true if resizing was successful, false otherwise.
+   */
+  bool container_resize(container_t *container, size_t new_size);
 
-/**
- * \brief Returns the number of elements in the container.
- *
- * \param container Pointer to the container.
- * \return Number of elements in the container.
- */
-size_t container_size(const container_t *container);
+  /**
+   * \brief Pushes an element to the front of the container.
+   *
+   * \param container Pointer to the container.
+   * \param data Pointer to the data to be pushed.
+   * \return true if the operation was successful, false otherwise.
+   */
+  bool container_push_front(container_t *container, const void *data);
 
-/**
- * \brief Returns the size of single element (in bytes).
- *
- * \param container Pointer to the container.
- * \return Size of single element.
- */
-size_t container_esize(const container_t *container);
+  /**
+   * \brief Pops an element from the front of the container.
+   *
+   * \param container Pointer to the container.
+   * \param data Pointer to store the popped data.
+   * \return true if the operation was successful, false otherwise.
+   */
+  bool container_pop_front(container_t *container, void *data);
+
+  /**
+   * \brief Pushes an element to the back of the container.
+   *
+   * \param container Pointer to the container.
+   * \param data Pointer to the data to be pushed.
+   * \return true if the operation was successful, false otherwise.
+   */
+  bool container_push_back(container_t *container, const void *data);
+
+  /**
+   * \brief Pops an element from the back of the container.
+   *
+   * \param container Pointer to the container.
+   * \param data Pointer to store the popped data.
+   * \return true if the operation was successful, false otherwise.
+   */
+  bool container_pop_back(container_t *container, void *data);
+
+  /**
+   * \brief Inserts an element at a specified index in the container.
+   *
+   * \param container Pointer to the container.
+   * \param data Pointer to the data to be inserted.
+   * \param index The index at which the data should be inserted.
+   * \return true if the operation was successful, false otherwise.
+   */
+  bool container_insert(container_t *container, const void *data, size_t index);
+
+  /**
+   * \brief Extracts an element from a specified index in the container.
+   *
+   * \param container Pointer to the container.
+   * \param data Pointer to store the extracted data.
+   * \param index The index from which the data should be extracted.
+   * \return true if the operation was successful, false otherwise.
+   */
+  bool container_extract(container_t *container, void *data, size_t index);
+
+  /**
+   * \brief Replaces an element at a specified index in the container.
+   *
+   * \param container Pointer to the container.
+   * \param data Pointer to the data to replace the current one.
+   * \param index The index at which the data should be replaced.
+   * \return true if the operation was successful, false otherwise.
+   */
+  bool container_replace(container_t *container, const void *data, size_t index);
+
+  /**
+   * \brief Retrieves an element from a specified index in the container.
+   *
+   * \param container Pointer to the container.
+   * \param data Pointer to store the retrieved data.
+   * \param index The index from which the data should be retrieved.
+   * \return true if the operation was successful, false otherwise.
+   */
+  bool container_at(const container_t *container, void *data, size_t index);
+
+  /**
+   * \brief Erases an element at a specified index in the container.
+   *
+   * \param container Pointer to the container.
+   * \param index The index at which the element should be erased.
+   * \return true if the operation was successful, false otherwise.
+   */
+  bool container_erase(container_t *container, size_t index);
+
+  /**
+   * \brief Peeks at an element at a specified index in the container without removing it.
+   *
+   * \param container Pointer to the container.
+   * \param index The index from which the data should be peeked.
+   * \return Pointer to the peeked data or NULL.
+   */
+  void *container_peek(const container_t *container, size_t index);
+
+  /**
+   * \brief Returns a read-only pointer to an element at a specified index in the container.
+   *
+   * Unlike `container_peek` it doesn`t invalidate the tracked hash (see `container_hash_track`),
+   * so it is intended for the algorithms which only read the elements.
+   *
+   * \param container Pointer to the container.
+   * \param index The index of the element.
+   * \return Pointer to the element or NULL if the index is out of the container.
+   */
+  const void *container_cpeek(const container_t *container, size_t index);
+
+  /**
+   * \brief Clears all the elements from the container.
+   *
+   * \param container Pointer to the container.
+   * \return true if the operation was successful, false otherwise.
+   */
+  size_t container_clear(const container_t *container);
+
+  /**
+   * \brief Returns the number of elements in the container.
+   *
+   * \param container Pointer to the container.
+   * \return Number of elements in the container.
+   */
+  size_t container_size(const container_t *container);
+
+  /**
+   * \brief Returns the size of single element (in bytes).
+   *
+   * \param container Pointer to the container.
+   * \return Size of single element.
+   */
+  size_t container_esize(const container_t *container);
+
+  /**
+   * \brief Reserves a new element at the front of the container and returns a pointer to it.
+   *
+   * The element is constructed directly in the container storage, so no copy from a caller buffer is needed.
+   * The content of the reserved element is unspecified until the caller writes it.
+   *
+   * \warning The returned pointer is valid until the next modification of the container.
+   *
+   * \param container Pointer to the container.
+   * \return Pointer to the reserved element or NULL if the operation failed.
+   */
+  void *container_emplace_front(container_t *container);
+
+  /**
+   * \brief Reserves a new element at the back of the container and returns a pointer to it.
+   *
+   * \warning The returned pointer is valid until the next modification of the container.
+   *
+   * \param container Pointer to the container.
+   * \return Pointer to the reserved element or NULL if the operation failed.
+   */
+  void *container_emplace_back(container_t *container);
+
+  /**
+   * \brief Reserves a new element at a specified index in the container and returns a pointer to it.
+   *
+   * \warning The returned pointer is valid until the next modification of the container.
+   *
+   * \param container Pointer to the container.
+   * \param index The index at which the element should be reserved.
+   * \return Pointer to the reserved element or NULL if the operation failed.
+   */
+  void *container_emplace_at(container_t *container, size_t index);
+
+  /**
+   * \brief Removes the front element of the container and returns a pointer to it without copying.
+   *
+   * This is the consumer counterpart of `container_emplace_back`: the caller reads the element in place
+   * instead of copying it into its own buffer as `container_pop_front` does.
+   *
+   * It takes O(1) and never allocates memory for the linked list and vector based containers: the vector only moves
+   * the start of its pool, the memory of the removed elements is reused by the next insertions. The unrolled list
+   * and tiered vector based containers move the elements behind the removed one, so they return a pointer
+   * to its copy kept by the container.
+   *
+   * \warning The returned pointer is valid until the next modification of the container.
+   *
+   * \param container Pointer to the container.
+   * \return Pointer to the removed element or NULL if the container is empty.
+   */
+  void *container_acquire_front(container_t *container);
+
+  /**
+   * \brief Pops several elements from the front of the container in one operation.
+   *
+   * The elements are copied into `data` in the order they are stored in the container.
+   * Nothing is removed if the container holds less than `count` elements.
+   *
+   * \param container Pointer to the container.
+   * \param data Pointer to the buffer of at least `count` elements to store the popped data.
+   * \param count Number of elements to pop.
+   * \return true if the operation was successful, false otherwise.
+   */
+  bool container_pop_front_n(container_t *container, void *data, size_t count);
+
+  /**
+   * \brief Pops several elements from the back of the container in one operation.
+   *
+   * The elements are copied into `data` in the order they are stored in the container.
+   * Nothing is removed if the container holds less than `count` elements.
+   *
+   * \param container Pointer to the container.
+   * \param data Pointer to the buffer of at least `count` elements to store the popped data.
+   * \param count Number of elements to pop.
+   * \return true if the operation was successful, false otherwise.
+   */
+  bool container_pop_back_n(container_t *container, void *data, size_t count);
+
+  /**
+   * \brief Extracts a range of elements from the container in one operation.
+   *
+   * \param container Pointer to the container.
+   * \param data Pointer to the buffer of at least `count` elements to store the extracted data.
+   * \param index The index of the first element of the range.
+   * \param count Number of elements in the range.
+   * \return true if the operation was successful, false if the range is out of the container.
+   */
+  bool container_extract_range(container_t *container, void *data, size_t index, size_t count);
+
+  /**
+   * \brief Inserts an array of elements at a specified index in the container in one operation.
+   *
+   * Nothing is inserted if the container can`t hold all the elements.
+   *
+   * \param container Pointer to the container.
+   * \param data Pointer to the array of `count` elements to be inserted.
+   * \param index The index at which the first element should be inserted.
+   * \param count Number of elements in the array.
+   * \return true if the operation was successful, false otherwise.
+   */
+  bool container_insert_range(container_t *container, const void *data, size_t index, size_t count);
+
+  /**
+   * \brief Erases a range of elements from the container in one operation.
+   *
+   * \param container Pointer to the container.
+   * \param first The index of the first element of the range.
+   * \param count Number of elements in the range.
+   * \return true if the operation was successful, false if the range is out of the container.
+   */
+  bool container_erase_range(container_t *container, size_t first, size_t count);
+
+  /**
+   * \brief Erases all elements for which the predicate returns true.
+   *
+   * The relative order of the remaining elements is preserved. The container is traversed once.
+   *
+   * \param container Pointer to the container.
+   * \param predicate Callback function which selects the elements to be erased.
+   * \return Number of erased elements.
+   */
+  size_t container_erase_if(container_t *container, predicate_fn_t predicate);
+
+  /**
+   * \brief Erases an element at a specified index without keeping the order of the elements.
+   *
+   * The last element of the vector based container is moved into the place of the erased one,
+   * so the operation takes O(1) regardless of the position.
+   *
+   * \param container Pointer to the container.
+   * \param index The index at which the element should be erased.
+   * \return true if the operation was successful, false otherwise.
+   */
+  bool container_erase_unordered(container_t *container, size_t index);
+
+  /**
+   * \brief Creates a cursor which points to the element at a specified index.
+   *
+   * \param container Pointer to the container.
+   * \param index The index of the element.
+   * \return The cursor. The cursor is invalid if the index is out of the container.
+   */
+  container_cursor_t container_cursor(const container_t *container, size_t index);
+
+  /**
+   * \brief Checks that the cursor points to an element of the container.
+   *
+   * \param cursor Pointer to the cursor.
+   * \return true if the cursor points to an element, false otherwise.
+   */
+  bool container_cursor_valid(const container_cursor_t *cursor);
+
+  /**
+   * \brief Moves the cursor to the next element of the container.
+   *
+   * \param cursor Pointer to the cursor.
+   * \return true if the cursor points to an element after the move, false if the end of the container is reached.
+   */
+  bool container_cursor_next(container_cursor_t *cursor);
+
+  /**
+   * \brief Returns a pointer to the element which the cursor points to.
+   *
+   * \param cursor Pointer to the cursor.
+   * \return Pointer to the element or NULL if the cursor is invalid.
+   */
+  void *container_cursor_data(const container_cursor_t *cursor);
+
+  /**
+   * \brief Returns a read-only pointer to the element which the cursor points to.
+   *
+   * Unlike `container_cursor_data` it doesn`t invalidate the tracked hash.
+   *
+   * \param cursor Pointer to the cursor.
+   * \return Pointer to the element or NULL if the cursor is invalid.
+   */
+  const void *container_cursor_cdata(const container_cursor_t *cursor);
+
+  /**
+   * \brief Erases the element which the cursor points to in O(1).
+   *
+   * After the call the cursor points to the next element which wasn`t visited yet, so the loop
+   * over the container can be continued without calling `container_cursor_next`.
+   *
+   * \warning For the vector based container the last element is moved into the place of the erased one,
+   *          i.e. the order of the elements isn`t kept.
+   *
+   * \param cursor Pointer to the cursor.
+   * \return true if the operation was successful, false if the cursor is invalid or the container is a view
+   *         (the cursor isn`t changed in this case).
+   */
+  bool container_cursor_erase(container_cursor_t *cursor);
+
+  /**
+   * \brief Moves all elements of the source container into the destination container at a specified index.
+   *
+   * If both containers are linked list based the nodes are relinked in O(1) without copying any element.
+   * If both containers are vector based the destination is reserved once and filled by single copy.
+   * Containers of different types are merged by bulk copy of the whole source content.
+   * After successful call the source container is empty but still valid.
+   *
+   * \param dst Pointer to the destination container.
+   * \param index The index in the destination container at which the elements should be inserted.
+   * \param src Pointer to the source container. Must have the same element size as the destination.
+   * \return true if the operation was successful, false otherwise (e.g. if any of the containers is a view).
+   *         On failure both containers are left untouched.
+   */
+  bool container_splice(container_t *dst, size_t index, container_t *src);
+
+  /**
+   * \brief Moves all elements of the source container to the end of the destination container.
+   *
+   * \param dst Pointer to the destination container.
+   * \param src Pointer to the source container. Must have the same element size as the destination.
+   * \return true if the operation was successful, false otherwise.
+   *
+   * \see container_splice
+   */
+  bool container_append(container_t *dst, container_t *src);
+
+  /**
+   * \brief Exchanges the contents of two containers in O(1).
+   *
+   * Only the internal cores of the containers are exchanged, no element is copied.
+   * The containers may have different types and element sizes; both are exchanged along with the contents.
+   *
+   * \param a Pointer to the first container.
+   * \param b Pointer to the second container.
+   */
+  void container_swap(container_t *a, container_t *b);
+
+  /**
+   * \brief Transfers the contents of the source container to the destination container in O(1).
+   *
+   * The destination takes over the pool or the node chain of the source together with its type and element size.
+   * The previous contents of the destination are freed. The source is left empty but valid
+   * and keeps its type and element size.
+   *
+   * \param dst Pointer to the destination container.
+   * \param src Pointer to the source container.
+   * \return true if the operation was successful, false if any of the containers is a view or the memory for the new
+   *         empty source couldn`t be allocated. On failure both containers are left untouched.
+   */
+  bool container_move(container_t *dst, container_t *src);
+
+  /**
+   * \brief Creates a copy of the container.
+   *
+   * The new container has the same type and element size as the source. Its storage is sized once:
+   * the vector pool is filled by a single copy, all linked list nodes and unrolled list chunks are allocated before being linked.
+   *
+   * \param src Pointer to the source container.
+   * \param mode Copy mode. In `CONTAINER_COPY_SHALLOW` mode the elements are copied byte by byte,
+   *             in `CONTAINER_COPY_DEEP` mode every element is copied by the `copy` callback.
+   * \param copy Callback which copies a single element. Used only in `CONTAINER_COPY_DEEP` mode and may be NULL otherwise.
+   * \return Pointer to the new container or NULL if the memory allocation failed.
+   */
+  container_t *container_clone(const container_t *src, container_copy_mode_e mode, copy_fn_t copy);
+
+  /**
+   * \brief Returns a pointer to the contiguous storage of the elements.
+   *
+   * The elements of the vector based container are stored one after another, so they can be accessed
+   * directly as an array of `container_size` elements. The pointer is valid until the next insertion into the container.
+   *
+   * \param container Pointer to the container.
+   * \return Pointer to the first element or NULL if the container doesn`t store the elements contiguously (linked list based).
+   */
+  void *container_data(const container_t *container);
+
+  /**
+   * \brief Returns a read-only pointer to the contiguous storage of the elements.
+   *
+   * Unlike `container_data` it doesn`t invalidate the tracked hash.
+   *
+   * \param container Pointer to the container.
+   * \return Pointer to the first element or NULL if the container doesn`t store the elements contiguously.
+   */
+  const void *container_cdata(const container_t *container);
+
+  /**
+   * \brief Inserts an element into the sorted container keeping it sorted.
+   *
+   * The slot is found by binary search in the vector and tiered vector based containers (O(log N) comparisons)
+   * and by a walk through the list based containers. The element is inserted after all equal elements,
+   * so the elements inserted with equal keys keep the insertion order.
+   *
+   * \param container Pointer to the container sorted in ascending order by `cmp`.
+   * \param data Pointer to the data to be inserted.
+   * \param cmp Ordering callback. If it is NULL the elements are compared byte by byte by `memcmp`.
+   * \return true if the operation was successful, false otherwise.
+   */
+  bool container_insert_sorted(container_t *container, const void *data, order_fn_t cmp);
+
+  /**
+   * \brief Reverses the order of the elements of the container in place.
+   *
+   * The linked list based container only flips the links of the nodes, the elements aren`t moved.
+   *
+   * \param container Pointer to the container.
+   * \return true if the operation was successful, false otherwise.
+   */
+  bool container_reverse(container_t *container);
+
+  /**
+   * \brief Rotates the elements of the container to the left in place: the element at the index `count`
+   * becomes the first one.
+   *
+   * The vector based container is rotated by block swaps without additional memory, the linked list based
+   * container is relinked in O(1) after the walk to the new first node.
+   *
+   * \param container Pointer to the container.
+   * \param count Number of positions. If it exceeds the size of the container it is taken modulo the size.
+   * \return true if the operation was successful, false otherwise.
+   */
+  bool container_rotate(container_t *container, size_t count);
+
+  /**
+   * \brief Replaces the elements of the range [first, first + count) by the value.
+   *
+   * \param container Pointer to the container.
+   * \param first The index of the first element of the range.
+   * \param count The number of elements in the range.
+   * \param data Pointer to the value.
+   * \return true if the operation was successful, false if the range is out of the container.
+   */
+  bool container_fill(container_t *container, size_t first, size_t count, const void *data);
+
+  /**
+   * \brief Creates a view of the range [first, first + count) of the elements of the container without copying.
+   *
+   * The view is a container of the same type which references the elements of the parent in place:
+   * the view of the vector based container is a contiguous part of its pool, the view of the linked list based
+   * container is a range of its nodes. The view can be passed to any function which accepts the container,
+   * e.g. `uc_find`, `uc_equal` or `uc_sort` (mutable view only).
+   *
+   * The view doesn`t own the elements, so the operations which change the number of the elements fail.
+   * The mutable view can replace the elements; it can also be cleared and filled by `container_push_back`
+   * again up to its initial size, which overwrites the elements of the parent in order.
+   * Any change of the number of the elements of the parent invalidates the view.
+   * The view must be deleted by `container_delete` before the parent; the parent isn`t changed by the deletion.
+   *
+   * \param container Pointer to the parent container (it can be a view too).
+   * \param first The index of the first element of the range.
+   * \param count The number of elements in the range.
+   * \param mode Access mode of the view.
+   * \return Pointer to the view or NULL if the range is out of the container, the mutable view of the read-only view
+   *         is requested or the memory allocation failed.
+   */
+  uc_view_t *container_view(container_t *container, size_t first, size_t count, container_view_mode_e mode);
+
+  /**
+   * \brief Checks if the elements of the container are accessed by the index in O(1).
+   *
+   * It is true for the vector and tiered vector based containers and their views, so the algorithms can use
+   * `container_cpeek` for the binary search instead of the walk by the cursors.
+   *
+   * \param container Pointer to the container.
+   * \return true if `container_peek` and `container_at` take O(1), false otherwise.
+   */
+  bool container_random_access(const container_t *container);
+
+  /**
+   * \brief Checks if the container is a view of other container.
+   *
+   * \param container Pointer to the container.
+   * \return true if the container is a view, false otherwise.
+   */
+  bool container_is_view(const container_t *container);
+
+  /**
+   * \brief Returns the order-aware hash of the elements of the container.
+   *
+   * The hash is a polynomial modulo 2^64 over the CRC32C digests of the elements, so the containers with the same
+   * elements in the same order have the same hash independently of their type. If the hashes of two containers
+   * differ, their elements differ too; equal hashes must be confirmed by the full comparison.
+   *
+   * If the hash is tracked (see `container_hash_track`) and still valid, it is returned in O(1),
+   * otherwise it is computed in one pass over the elements.
+   *
+   * \param container Pointer to the container.
+   * \return The hash of the elements.
+   */
+  uint64_t container_hash(const container_t *container);
+
+  /**
+   * \brief Enables or disables the incremental maintenance of the hash of the container.
+   *
+   * The tracked hash is updated in O(1) by `container_push_front`, `container_push_back`, `container_pop_front`,
+   * `container_pop_back` and `container_clear`. Any other operation which may change the elements (including the
+   * functions which return a mutable pointer to the elements: `container_peek`, `container_data` and
+   * `container_cursor_data`) only invalidates it, and the next `container_hash` call recomputes it.
+   * The read-only accessors `container_cpeek`, `container_cdata` and `container_cursor_cdata` keep it valid.
+   *
+   * \note The elements must not be changed through the pointers obtained before the last `container_hash` call.
+   *
+   * \param container Pointer to the container (views can`t be tracked).
+   * \param enable true to track the hash, false to stop tracking.
+   * \return true if the operation was successful, false if the container is a view or the memory allocation failed.
+   */
+  bool container_hash_track(container_t *container, bool enable);
+
+  /**
+   * \brief Returns the tracked hash without computing it.
+   *
+   * \param container Pointer to the container.
+   * \param hash Pointer to the variable which receives the hash.
+   * \return true if the hash is tracked and valid, false otherwise (the variable isn`t changed).
+   */
+  bool container_hash_cached(const container_t *container, uint64_t *hash);
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
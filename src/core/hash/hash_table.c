@@ -0,0 +1,607 @@
+/**
+ * \file    hash_table.c
+ * \author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * \brief   Open addressing hash table: hash map and hash set with fixed size keys and values.
+ * \date    2023-10-14
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "hash_table.h"
+
+#include <string.h>
+
+#include "common/uc_assert.h"
+#include "common/uc_crc.h"
+#include "interface/allocator_if.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+//_____ C O N F I G S  ________________________________________________________
+/**
+ * \brief Number of the control bytes which are matched at once.
+ */
+#define GROUP_WIDTH 16
+
+/**
+ * \brief Capacity of the table after the first insertion.
+ */
+#define MIN_CAPACITY GROUP_WIDTH
+//_____ D E F I N I T I O N S _________________________________________________
+/**
+ * \brief Control bytes of the free slots. The control byte of the used slot is the 7 bits of the hash (0..127).
+ */
+#define CTRL_EMPTY   ((int8_t)-128)
+#define CTRL_DELETED ((int8_t)-2)
+
+/**
+ * \brief Bit mask of the slots of the group: the bit `i` stands for the slot `position + i`.
+ */
+typedef uint32_t group_mask_t;
+
+struct HashTable_tag
+{
+  int8_t *ctrl;        /// Control bytes: capacity + GROUP_WIDTH (copy of the first group) bytes
+  uint8_t *slots;      /// Pool of the slots: key and value of every slot
+  size_t capacity;     /// Number of the slots: 0 or power of two
+  size_t size;         /// Number of the elements
+  size_t deleted;      /// Number of the deleted slots which aren`t reused yet
+  size_t key_size;     /// Size of the key
+  size_t value_size;   /// Size of the value
+  size_t value_offset; /// Offset of the value in the slot
+  size_t stride;       /// Size of the slot
+  hash_fn_t hash;
+  hash_equal_fn_t equal;
+};
+//_____ M A C R O S ___________________________________________________________
+/**
+ * \brief Maximal number of the used and deleted slots.
+ */
+#define MAX_LOAD(capacity) ((capacity) - (capacity) / 8)
+
+/**
+ * \brief Pointer to the key of the slot with the index `i`.
+ */
+#define SLOT_KEY(table, i) ((table)->slots + (i) * (table)->stride)
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+static uint64_t default_hash(const void *key, size_t key_size)
+{
+  uint64_t z = 0;
+  if (key_size <= sizeof(z))
+  {
+    memcpy(&z, key, key_size);
+  }
+  else
+  {
+    z = (uint64_t)uc_crc32c(0, key, key_size) | ((uint64_t)key_size << 32);
+  }
+
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+  return z ^ (z >> 31);
+}
+
+static bool default_equal(const void *key1, const void *key2, size_t key_size)
+{
+  return 0 == memcmp(key1, key2, key_size);
+}
+
+/* The value is aligned by its own size up to 8 bytes, so the values of the scalar types can be accessed directly */
+static size_t natural_align(size_t size)
+{
+  size_t align = 1;
+  while (align < 8 && 0 == (size & align))
+  {
+    align <<= 1;
+  }
+
+  return align;
+}
+
+static inline size_t round_up(size_t size, size_t align)
+{
+  return (size + align - 1) / align * align;
+}
+
+#if defined(__SSE2__)
+static inline __attribute__((always_inline)) group_mask_t group_match(const int8_t *group, int8_t value)
+{
+  __m128i ctrl = _mm_loadu_si128((const __m128i *)group);
+  return (group_mask_t)_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(value)));
+}
+
+static inline __attribute__((always_inline)) group_mask_t group_match_free(const int8_t *group)
+{
+  __m128i ctrl = _mm_loadu_si128((const __m128i *)group);
+  return (group_mask_t)_mm_movemask_epi8(_mm_cmplt_epi8(ctrl, _mm_set1_epi8(-1)));
+}
+#else
+static inline __attribute__((always_inline)) group_mask_t group_match(const int8_t *group, int8_t value)
+{
+  group_mask_t mask = 0;
+  for (size_t i = 0; i < GROUP_WIDTH; i++)
+  {
+    mask |= (group_mask_t)(group[i] == value) << i;
+  }
+
+  return mask;
+}
+
+static inline __attribute__((always_inline)) group_mask_t group_match_free(const int8_t *group)
+{
+  group_mask_t mask = 0;
+  for (size_t i = 0; i < GROUP_WIDTH; i++)
+  {
+    mask |= (group_mask_t)(group[i] < -1) << i;
+  }
+
+  return mask;
+}
+#endif
+
+/* The first group is copied after the last slot, so the group can be loaded from any slot without wrapping */
+static inline void set_ctrl(hash_table_t *table, size_t slot, int8_t value)
+{
+  table->ctrl[slot] = value;
+  table->ctrl[((slot - GROUP_WIDTH) & (table->capacity - 1)) + GROUP_WIDTH] = value;
+}
+
+/*
+ * The groups are probed by the triangular sequence, which visits every group of the power of two table.
+ * The lookup stops on the group with an empty slot: the key would have been inserted there.
+ */
+static size_t find_slot(const hash_table_t *table, const void *key, uint64_t hash)
+{
+  size_t mask = table->capacity - 1;
+  size_t position = (size_t)(hash >> 7) & mask;
+  int8_t h2 = (int8_t)(hash & 0x7F);
+
+  for (size_t step = GROUP_WIDTH;; step += GROUP_WIDTH)
+  {
+    const int8_t *group = &table->ctrl[position];
+
+    for (group_mask_t match = group_match(group, h2); 0 != match; match &= match - 1)
+    {
+      size_t slot = (position + (size_t)__builtin_ctz(match)) & mask;
+      if (table->equal(key, SLOT_KEY(table, slot), table->key_size))
+      {
+        return slot;
+      }
+    }
+
+    if (0 != group_match(group, CTRL_EMPTY))
+    {
+      return table->capacity;
+    }
+
+    position = (position + step) & mask;
+  }
+}
+
+static size_t find_free_slot(const hash_table_t *table, uint64_t hash)
+{
+  size_t mask = table->capacity - 1;
+  size_t position = (size_t)(hash >> 7) & mask;
+
+  for (size_t step = GROUP_WIDTH;; step += GROUP_WIDTH)
+  {
+    group_mask_t available = group_match_free(&table->ctrl[position]);
+    if (0 != available)
+    {
+      return (position + (size_t)__builtin_ctz(available)) & mask;
+    }
+
+    position = (position + step) & mask;
+  }
+}
+
+/* All elements are moved into the new arrays, the deleted slots are dropped */
+static bool rehash(hash_table_t *table, size_t capacity)
+{
+  allocate_fn_t mem_allocate = get_allocator();
+  free_fn_t mem_free = get_free();
+
+  int8_t *ctrl = (int8_t *)mem_allocate(capacity + GROUP_WIDTH);
+  uint8_t *slots = (uint8_t *)mem_allocate(capacity * table->stride);
+  if (NULL == ctrl || NULL == slots)
+  {
+    if (NULL != ctrl)
+    {
+      mem_free(ctrl);
+    }
+    if (NULL != slots)
+    {
+      mem_free(slots);
+    }
+    return false;
+  }
+
+  hash_table_t old = *table;
+
+  memset(ctrl, CTRL_EMPTY, capacity + GROUP_WIDTH);
+  table->ctrl = ctrl;
+  table->slots = slots;
+  table->capacity = capacity;
+  table->deleted = 0;
+
+  for (size_t i = 0; i < old.capacity; i++)
+  {
+    if (old.ctrl[i] >= 0)
+    {
+      const uint8_t *key = SLOT_KEY(&old, i);
+      uint64_t hash = table->hash(key, table->key_size);
+      size_t slot = find_free_slot(table, hash);
+
+      set_ctrl(table, slot, (int8_t)(hash & 0x7F));
+      memcpy(SLOT_KEY(table, slot), key, table->stride);
+    }
+  }
+
+  if (NULL != old.ctrl)
+  {
+    mem_free(old.ctrl);
+    mem_free(old.slots);
+  }
+
+  return true;
+}
+
+/* The table with many deleted slots is rehashed with the same capacity instead of growing */
+static bool grow(hash_table_t *table)
+{
+  if (0 == table->capacity)
+  {
+    return rehash(table, MIN_CAPACITY);
+  }
+
+  size_t capacity = (table->size + 1 > MAX_LOAD(table->capacity) / 2) ? table->capacity * 2 : table->capacity;
+  return rehash(table, capacity);
+}
+
+static void *slot_value(const hash_table_t *table, size_t slot)
+{
+  return SLOT_KEY(table, slot) + ((0 == table->value_size) ? 0 : table->value_offset);
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * \brief Creates a new empty hash table.
+ *
+ * Detailed description see in hash_table.h
+ */
+hash_table_t *hash_table_create(size_t key_size, size_t value_size, hash_fn_t hash, hash_equal_fn_t equal)
+{
+  UC_ASSERT(0 != key_size);
+
+  if (!is_allocator_valid())
+  {
+    return NULL;
+  }
+
+  allocate_fn_t mem_allocate = get_allocator();
+
+  hash_table_t *table = (hash_table_t *)mem_allocate(sizeof *table);
+  if (NULL == table)
+  {
+    return NULL;
+  }
+
+  size_t align = (0 == value_size) ? 1 : natural_align(value_size);
+
+  table->ctrl = NULL;
+  table->slots = NULL;
+  table->capacity = 0;
+  table->size = 0;
+  table->deleted = 0;
+  table->key_size = key_size;
+  table->value_size = value_size;
+  table->value_offset = round_up(key_size, align);
+  table->stride = round_up(table->value_offset + value_size, (align > natural_align(key_size)) ? align : natural_align(key_size));
+  table->hash = (NULL == hash) ? default_hash : hash;
+  table->equal = (NULL == equal) ? default_equal : equal;
+
+  return table;
+}
+
+/**
+ * \brief Frees up the memory associated with the table.
+ *
+ * Detailed description see in hash_table.h
+ */
+void hash_table_delete(hash_table_t **table)
+{
+  UC_ASSERT(table);
+  UC_ASSERT(*table);
+  UC_ASSERT(is_allocator_valid());
+
+  free_fn_t mem_free = get_free();
+
+  if (NULL != (*table)->ctrl)
+  {
+    mem_free((*table)->ctrl);
+    mem_free((*table)->slots);
+  }
+
+  mem_free(*table);
+  (*table) = NULL;
+}
+
+/**
+ * \brief Finds the key or inserts it with the zero filled value.
+ *
+ * Detailed description see in hash_table.h
+ */
+void *hash_table_emplace(hash_table_t *table, const void *key, bool *inserted)
+{
+  UC_ASSERT(table);
+  UC_ASSERT(key);
+
+  uint64_t hash = table->hash(key, table->key_size);
+
+  if (0 != table->capacity)
+  {
+    size_t slot = find_slot(table, key, hash);
+    if (slot != table->capacity)
+    {
+      if (NULL != inserted)
+      {
+        *inserted = false;
+      }
+      return slot_value(table, slot);
+    }
+  }
+
+  if (table->size + table->deleted + 1 > MAX_LOAD(table->capacity) && !grow(table))
+  {
+    return NULL;
+  }
+
+  size_t slot = find_free_slot(table, hash);
+  table->deleted -= (CTRL_DELETED == table->ctrl[slot]) ? 1 : 0;
+  table->size++;
+  set_ctrl(table, slot, (int8_t)(hash & 0x7F));
+
+  uint8_t *element = SLOT_KEY(table, slot);
+  memcpy(element, key, table->key_size);
+  memset(element + table->key_size, 0, table->stride - table->key_size);
+
+  if (NULL != inserted)
+  {
+    *inserted = true;
+  }
+  return slot_value(table, slot);
+}
+
+/**
+ * \brief Inserts the key with the value or replaces the value.
+ *
+ * Detailed description see in hash_table.h
+ */
+bool hash_table_insert(hash_table_t *table, const void *key, const void *value)
+{
+  UC_ASSERT(table);
+  UC_ASSERT(key);
+  UC_ASSERT(0 == table->value_size || NULL != value);
+
+  void *data = hash_table_emplace(table, key, NULL);
+  if (NULL == data)
+  {
+    return false;
+  }
+
+  if (0 != table->value_size)
+  {
+    memcpy(data, value, table->value_size);
+  }
+
+  return true;
+}
+
+/**
+ * \brief Finds the key in the table.
+ *
+ * Detailed description see in hash_table.h
+ */
+void *hash_table_find(const hash_table_t *table, const void *key)
+{
+  UC_ASSERT(table);
+  UC_ASSERT(key);
+
+  if (0 == table->size)
+  {
+    return NULL;
+  }
+
+  size_t slot = find_slot(table, key, table->hash(key, table->key_size));
+  return (slot == table->capacity) ? NULL : slot_value(table, slot);
+}
+
+/**
+ * \brief Checks if the key is in the table.
+ *
+ * Detailed description see in hash_table.h
+ */
+bool hash_table_contains(const hash_table_t *table, const void *key)
+{
+  return NULL != hash_table_find(table, key);
+}
+
+/**
+ * \brief Erases the key and its value from the table.
+ *
+ * Detailed description see in hash_table.h
+ */
+bool hash_table_erase(hash_table_t *table, const void *key)
+{
+  UC_ASSERT(table);
+  UC_ASSERT(key);
+
+  if (0 == table->size)
+  {
+    return false;
+  }
+
+  size_t slot = find_slot(table, key, table->hash(key, table->key_size));
+  if (slot == table->capacity)
+  {
+    return false;
+  }
+
+  /*
+   * If no group which contains the slot was full, no lookup has passed through the slot,
+   * so it can be marked as empty. Otherwise it is marked as deleted to keep the probe sequences.
+   */
+  size_t mask = table->capacity - 1;
+  group_mask_t empty_after = group_match(&table->ctrl[slot], CTRL_EMPTY);
+  group_mask_t empty_before = group_match(&table->ctrl[(slot - GROUP_WIDTH) & mask], CTRL_EMPTY);
+  size_t free_after = (0 == empty_after) ? GROUP_WIDTH : (size_t)__builtin_ctz(empty_after);
+  size_t free_before = (0 == empty_before) ? GROUP_WIDTH : (size_t)__builtin_clz(empty_before) - (32 - GROUP_WIDTH);
+
+  if (free_after + free_before < GROUP_WIDTH)
+  {
+    set_ctrl(table, slot, CTRL_EMPTY);
+  }
+  else
+  {
+    set_ctrl(table, slot, CTRL_DELETED);
+    table->deleted++;
+  }
+
+  table->size--;
+  return true;
+}
+
+/**
+ * \brief Erases all elements from the table.
+ *
+ * Detailed description see in hash_table.h
+ */
+void hash_table_clear(hash_table_t *table)
+{
+  UC_ASSERT(table);
+
+  if (0 != table->capacity)
+  {
+    memset(table->ctrl, CTRL_EMPTY, table->capacity + GROUP_WIDTH);
+  }
+
+  table->size = 0;
+  table->deleted = 0;
+}
+
+/**
+ * \brief Prepares the table for a number of elements.
+ *
+ * Detailed description see in hash_table.h
+ */
+bool hash_table_reserve(hash_table_t *table, size_t count)
+{
+  UC_ASSERT(table);
+
+  size_t capacity = (0 == table->capacity) ? MIN_CAPACITY : table->capacity;
+  while (MAX_LOAD(capacity) < count)
+  {
+    capacity *= 2;
+  }
+
+  return (capacity == table->capacity) ? true : rehash(table, capacity);
+}
+
+/**
+ * \brief Returns the number of elements in the table.
+ *
+ * Detailed description see in hash_table.h
+ */
+size_t hash_table_size(const hash_table_t *table)
+{
+  UC_ASSERT(table);
+
+  return table->size;
+}
+
+/**
+ * \brief Creates a cursor which points to the first element of the table.
+ *
+ * Detailed description see in hash_table.h
+ */
+hash_table_cursor_t hash_table_cursor(const hash_table_t *table)
+{
+  UC_ASSERT(table);
+
+  hash_table_cursor_t cursor = {.table = table, .slot = 0};
+  while (cursor.slot < table->capacity && table->ctrl[cursor.slot] < 0)
+  {
+    cursor.slot++;
+  }
+
+  return cursor;
+}
+
+/**
+ * \brief Checks that the cursor points to an element of the table.
+ *
+ * Detailed description see in hash_table.h
+ */
+bool hash_table_cursor_valid(const hash_table_cursor_t *cursor)
+{
+  UC_ASSERT(cursor);
+  UC_ASSERT(cursor->table);
+
+  return cursor->slot < cursor->table->capacity;
+}
+
+/**
+ * \brief Moves the cursor to the next element of the table.
+ *
+ * Detailed description see in hash_table.h
+ */
+bool hash_table_cursor_next(hash_table_cursor_t *cursor)
+{
+  UC_ASSERT(cursor);
+  UC_ASSERT(cursor->table);
+
+  const hash_table_t *table = cursor->table;
+  if (cursor->slot >= table->capacity)
+  {
+    return false;
+  }
+
+  do
+  {
+    cursor->slot++;
+  } while (cursor->slot < table->capacity && table->ctrl[cursor->slot] < 0);
+
+  return cursor->slot < table->capacity;
+}
+
+/**
+ * \brief Returns a pointer to the key which the cursor points to.
+ *
+ * Detailed description see in hash_table.h
+ */
+const void *hash_table_cursor_key(const hash_table_cursor_t *cursor)
+{
+  UC_ASSERT(cursor);
+  UC_ASSERT(cursor->table);
+
+  return (cursor->slot < cursor->table->capacity) ? SLOT_KEY(cursor->table, cursor->slot) : NULL;
+}
+
+/**
+ * \brief Returns a pointer to the value which the cursor points to.
+ *
+ * Detailed description see in hash_table.h
+ */
+void *hash_table_cursor_value(const hash_table_cursor_t *cursor)
+{
+  UC_ASSERT(cursor);
+  UC_ASSERT(cursor->table);
+
+  const hash_table_t *table = cursor->table;
+  if (cursor->slot >= table->capacity || 0 == table->value_size)
+  {
+    return NULL;
+  }
+
+  return SLOT_KEY(table, cursor->slot) + table->value_offset;
+}
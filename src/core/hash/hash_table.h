@@ -0,0 +1,195 @@
+/**
+ * \file    hash_table.h
+ * \author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * \brief   Open addressing hash table: hash map and hash set with fixed size keys and values.
+ *
+ * The table keeps one control byte per slot: the slot is empty, deleted or stores an element whose hash
+ * has the low 7 bits equal to the control byte. The lookup loads 16 control bytes at once and compares
+ * them with the 7 bits of the searched hash by one SSE2 instruction (the scalar loop is used without SSE2),
+ * so the keys are compared only for the slots which are likely to match. The table grows when it is
+ * filled by 7/8.
+ *
+ * The table with `value_size` equal to 0 is a hash set: it stores the keys only.
+ *
+ * The keys and the values are copied into the table, the memory is allocated through the allocator
+ * interface. Any insertion can move the elements, so the pointers returned by the table and the cursors
+ * are valid until the next insertion or `hash_table_reserve`.
+ *
+ * \date    2023-10-14
+ */
+
+#pragma once
+
+//_____ I N C L U D E S _______________________________________________________
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+//_____ C O N F I G S  ________________________________________________________
+//_____ D E F I N I T I O N S _________________________________________________
+typedef struct HashTable_tag hash_table_t;
+
+/**
+ * \brief Callback function which computes the hash of the key.
+ */
+typedef uint64_t (*hash_fn_t)(const void *key, size_t key_size);
+
+/**
+ * \brief Callback function which compares two keys for equality.
+ */
+typedef bool (*hash_equal_fn_t)(const void *key1, const void *key2, size_t key_size);
+
+/**
+ * \brief Position of the element in the hash table.
+ */
+typedef struct
+{
+  const hash_table_t *table; /**< The table which the cursor walks through. */
+  size_t slot;               /**< Index of the slot or the capacity of the table if the cursor is out of the table. */
+} hash_table_cursor_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/* C++ detection */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+  /**
+   * \brief Creates a new empty hash table.
+   *
+   * \param key_size Size in bytes of the key.
+   * \param value_size Size in bytes of the value or 0 for the hash set.
+   * \param hash Callback function which computes the hash of the key or NULL for the default hash
+   *   of the bytes of the key (CRC32C based).
+   * \param equal Callback function which compares the keys or NULL for `memcmp`.
+   * \return Pointer to the newly created table or NULL if the allocation failed.
+   */
+  hash_table_t *hash_table_create(size_t key_size, size_t value_size, hash_fn_t hash, hash_equal_fn_t equal);
+
+  /**
+   * \brief Frees up the memory associated with the table.
+   *
+   * \param table Double pointer to the table to be deleted.
+   */
+  void hash_table_delete(hash_table_t **table);
+
+  /**
+   * \brief Inserts the key with the value or replaces the value if the key is already in the table.
+   *
+   * \param table Pointer to the table.
+   * \param key Pointer to the key.
+   * \param value Pointer to the value (it is ignored by the hash set).
+   * \return true if the operation was successful, false if the memory allocation failed.
+   */
+  bool hash_table_insert(hash_table_t *table, const void *key, const void *value);
+
+  /**
+   * \brief Finds the key or inserts it with the zero filled value and returns a pointer to the value.
+   *
+   * The value can be updated in place without the second lookup, e.g. to count the keys.
+   *
+   * \param table Pointer to the table.
+   * \param key Pointer to the key.
+   * \param inserted Pointer to the variable which is set to true if the key was inserted (it can be NULL).
+   * \return Pointer to the value (to the key for the hash set) or NULL if the memory allocation failed.
+   */
+  void *hash_table_emplace(hash_table_t *table, const void *key, bool *inserted);
+
+  /**
+   * \brief Finds the key in the table.
+   *
+   * \param table Pointer to the table.
+   * \param key Pointer to the key.
+   * \return Pointer to the value (to the key for the hash set) or NULL if the key isn`t in the table.
+   */
+  void *hash_table_find(const hash_table_t *table, const void *key);
+
+  /**
+   * \brief Checks if the key is in the table.
+   *
+   * \param table Pointer to the table.
+   * \param key Pointer to the key.
+   * \return true if the key is in the table, false otherwise.
+   */
+  bool hash_table_contains(const hash_table_t *table, const void *key);
+
+  /**
+   * \brief Erases the key and its value from the table.
+   *
+   * \param table Pointer to the table.
+   * \param key Pointer to the key.
+   * \return true if the key was erased, false if the key isn`t in the table.
+   */
+  bool hash_table_erase(hash_table_t *table, const void *key);
+
+  /**
+   * \brief Erases all elements from the table. The memory isn`t released.
+   *
+   * \param table Pointer to the table.
+   */
+  void hash_table_clear(hash_table_t *table);
+
+  /**
+   * \brief Prepares the table for a number of elements, so they are inserted without growing.
+   *
+   * \param table Pointer to the table.
+   * \param count The number of elements.
+   * \return true if the operation was successful, false if the memory allocation failed.
+   */
+  bool hash_table_reserve(hash_table_t *table, size_t count);
+
+  /**
+   * \brief Returns the number of elements in the table.
+   *
+   * \param table Pointer to the table.
+   * \return Number of elements in the table.
+   */
+  size_t hash_table_size(const hash_table_t *table);
+
+  /**
+   * \brief Creates a cursor which points to the first element of the table.
+   *
+   * The elements are walked in the order of the slots, which doesn`t depend on the order of insertion.
+   * Erasing the element which the cursor points to doesn`t invalidate the cursor.
+   *
+   * \param table Pointer to the table.
+   * \return The cursor. The cursor is invalid if the table is empty.
+   */
+  hash_table_cursor_t hash_table_cursor(const hash_table_t *table);
+
+  /**
+   * \brief Checks that the cursor points to an element of the table.
+   *
+   * \param cursor Pointer to the cursor.
+   * \return true if the cursor points to an element, false otherwise.
+   */
+  bool hash_table_cursor_valid(const hash_table_cursor_t *cursor);
+
+  /**
+   * \brief Moves the cursor to the next element of the table.
+   *
+   * \param cursor Pointer to the cursor.
+   * \return true if the cursor points to an element after the move, false if the end of the table is reached.
+   */
+  bool hash_table_cursor_next(hash_table_cursor_t *cursor);
+
+  /**
+   * \brief Returns a pointer to the key which the cursor points to. The key must not be changed.
+   *
+   * \param cursor Pointer to the cursor.
+   * \return Pointer to the key or NULL if the cursor is invalid.
+   */
+  const void *hash_table_cursor_key(const hash_table_cursor_t *cursor);
+
+  /**
+   * \brief Returns a pointer to the value which the cursor points to.
+   *
+   * \param cursor Pointer to the cursor.
+   * \return Pointer to the value or NULL if the cursor is invalid or the table is a hash set.
+   */
+  void *hash_table_cursor_value(const hash_table_cursor_t *cursor);
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
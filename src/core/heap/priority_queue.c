@@ -0,0 +1,493 @@
+/**
+ * \file    priority_queue.c
+ * \author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * \brief   Priority queue on the d-ary heap stored in the vector based container.
+ * \date    2023-10-15
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "priority_queue.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "common/uc_assert.h"
+#include "interface/allocator_if.h"
+//_____ C O N F I G S  ________________________________________________________
+/**
+ * \brief Arity of the heap if it isn`t specified.
+ */
+#define DEFAULT_ARITY 2
+
+/**
+ * \brief Number of the handles after the first insertion.
+ */
+#define MIN_HANDLES 16
+//_____ D E F I N I T I O N S _________________________________________________
+/*
+ * The handles of the elements are kept in two arrays:
+ * `handles[i]` is the handle of the element at the position `i` of the heap and
+ * `positions[h]` is the position of the element with the handle `h`.
+ * The released handles are stored in `handles[size .. count)`, so they are reused by the next pushes.
+ */
+struct PriorityQueue_tag
+{
+  container_t *pool;    /// Vector based container with the elements in the heap order
+  pq_handle_t *handles; /// Handle of the element at each position
+  size_t *positions;    /// Position of the element with each handle
+  size_t count;         /// Number of the handles given out and released
+  size_t capacity;      /// Capacity of the arrays of the handles
+  size_t size;          /// Number of the elements
+  size_t esize;         /// Size of the element
+  size_t arity;         /// Number of the children of the node
+  compare_fn_t cmp;
+  cmp_t before;         /// Result of `cmp` for the element which is closer to the top
+  uint8_t *hole;        /// Buffer for the element which is sifted
+};
+//_____ M A C R O S ___________________________________________________________
+/**
+ * \brief Pointer to the element at the position `i` of the heap.
+ */
+#define AT(base, queue, i) ((base) + (i) * (queue)->esize)
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+static cmp_t default_compare(const void *data1, const void *data2, size_t esize)
+{
+  int result = memcmp(data1, data2, esize);
+  return (result > 0) ? GT : ((result < 0) ? LE : EQ);
+}
+
+static inline bool is_before(const priority_queue_t *queue, const void *data1, const void *data2)
+{
+  return queue->before == queue->cmp(data1, data2, queue->esize);
+}
+
+static inline void place(priority_queue_t *queue, uint8_t *base, size_t position, const void *data, pq_handle_t handle)
+{
+  memcpy(AT(base, queue, position), data, queue->esize);
+  queue->handles[position] = handle;
+  queue->positions[handle] = position;
+}
+
+/*
+ * The element is moved through the hole: the parents which are placed after the element are moved down
+ * one by one and the element is written once into the final position.
+ */
+static size_t sift_up(priority_queue_t *queue, size_t position)
+{
+  uint8_t *base = (uint8_t *)container_data(queue->pool);
+  pq_handle_t handle = queue->handles[position];
+
+  memcpy(queue->hole, AT(base, queue, position), queue->esize);
+
+  while (0 != position)
+  {
+    size_t parent = (position - 1) / queue->arity;
+    if (!is_before(queue, queue->hole, AT(base, queue, parent)))
+    {
+      break;
+    }
+
+    place(queue, base, position, AT(base, queue, parent), queue->handles[parent]);
+    position = parent;
+  }
+
+  place(queue, base, position, queue->hole, handle);
+  return position;
+}
+
+static size_t sift_down(priority_queue_t *queue, size_t position)
+{
+  uint8_t *base = (uint8_t *)container_data(queue->pool);
+  pq_handle_t handle = queue->handles[position];
+
+  memcpy(queue->hole, AT(base, queue, position), queue->esize);
+
+  for (;;)
+  {
+    size_t first = position * queue->arity + 1;
+    if (first >= queue->size)
+    {
+      break;
+    }
+
+    size_t last = (queue->size - first > queue->arity) ? first + queue->arity : queue->size;
+    size_t best = first;
+    for (size_t child = first + 1; child < last; child++)
+    {
+      if (is_before(queue, AT(base, queue, child), AT(base, queue, best)))
+      {
+        best = child;
+      }
+    }
+
+    if (!is_before(queue, AT(base, queue, best), queue->hole))
+    {
+      break;
+    }
+
+    place(queue, base, position, AT(base, queue, best), queue->handles[best]);
+    position = best;
+  }
+
+  place(queue, base, position, queue->hole, handle);
+  return position;
+}
+
+static bool reserve_handles(priority_queue_t *queue, size_t count)
+{
+  if (count <= queue->capacity)
+  {
+    return true;
+  }
+
+  size_t capacity = (0 == queue->capacity) ? MIN_HANDLES : queue->capacity;
+  while (capacity < count)
+  {
+    capacity *= 2;
+  }
+
+  allocate_fn_t mem_allocate = get_allocator();
+  free_fn_t mem_free = get_free();
+
+  pq_handle_t *handles = (pq_handle_t *)mem_allocate(capacity * sizeof(pq_handle_t));
+  size_t *positions = (size_t *)mem_allocate(capacity * sizeof(size_t));
+  if (NULL == handles || NULL == positions)
+  {
+    if (NULL != handles)
+    {
+      mem_free(handles);
+    }
+    if (NULL != positions)
+    {
+      mem_free(positions);
+    }
+    return false;
+  }
+
+  if (NULL != queue->handles)
+  {
+    memcpy(handles, queue->handles, queue->count * sizeof(pq_handle_t));
+    memcpy(positions, queue->positions, queue->count * sizeof(size_t));
+    mem_free(queue->handles);
+    mem_free(queue->positions);
+  }
+
+  queue->handles = handles;
+  queue->positions = positions;
+  queue->capacity = capacity;
+
+  return true;
+}
+
+static bool is_valid_handle(const priority_queue_t *queue, pq_handle_t handle)
+{
+  return (handle < queue->count) && (queue->positions[handle] < queue->size) && (queue->handles[queue->positions[handle]] == handle);
+}
+
+/* The last element fills the position and the handle of the removed element goes to the released ones */
+static void remove_at(priority_queue_t *queue, size_t position)
+{
+  uint8_t *base = (uint8_t *)container_data(queue->pool);
+  size_t last = queue->size - 1;
+  pq_handle_t handle = queue->handles[position];
+
+  if (position != last)
+  {
+    place(queue, base, position, AT(base, queue, last), queue->handles[last]);
+  }
+
+  queue->handles[last] = handle;
+  queue->size--;
+  container_pop_back(queue->pool, queue->hole);
+
+  if (position < queue->size && position == sift_up(queue, position))
+  {
+    sift_down(queue, position);
+  }
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * \brief Creates a new empty priority queue.
+ *
+ * Detailed description see in priority_queue.h
+ */
+priority_queue_t *priority_queue_create(size_t esize, compare_fn_t cmp, ContainerSortOrder_e order, size_t arity)
+{
+  UC_ASSERT(0 != esize);
+  UC_ASSERT(1 != arity);
+
+  if (!is_allocator_valid())
+  {
+    return NULL;
+  }
+
+  allocate_fn_t mem_allocate = get_allocator();
+  free_fn_t mem_free = get_free();
+
+  priority_queue_t *queue = (priority_queue_t *)mem_allocate(sizeof *queue);
+  if (NULL == queue)
+  {
+    return NULL;
+  }
+
+  queue->pool = container_create(esize, CONTAINER_VECTOR_BASED);
+  queue->hole = (uint8_t *)mem_allocate(esize);
+  if (NULL == queue->pool || NULL == queue->hole)
+  {
+    if (NULL != queue->pool)
+    {
+      container_delete(&queue->pool);
+    }
+    if (NULL != queue->hole)
+    {
+      mem_free(queue->hole);
+    }
+    mem_free(queue);
+    return NULL;
+  }
+
+  queue->handles = NULL;
+  queue->positions = NULL;
+  queue->count = 0;
+  queue->capacity = 0;
+  queue->size = 0;
+  queue->esize = esize;
+  queue->arity = (0 == arity) ? DEFAULT_ARITY : arity;
+  queue->cmp = (NULL == cmp) ? default_compare : cmp;
+  queue->before = (SORT_ASCENDING == order) ? LE : GT;
+
+  return queue;
+}
+
+/**
+ * \brief Frees up the memory associated with the queue.
+ *
+ * Detailed description see in priority_queue.h
+ */
+void priority_queue_delete(priority_queue_t **queue)
+{
+  UC_ASSERT(queue);
+  UC_ASSERT(*queue);
+  UC_ASSERT(is_allocator_valid());
+
+  free_fn_t mem_free = get_free();
+
+  if (NULL != (*queue)->handles)
+  {
+    mem_free((*queue)->handles);
+    mem_free((*queue)->positions);
+  }
+
+  container_delete(&(*queue)->pool);
+  mem_free((*queue)->hole);
+  mem_free(*queue);
+  (*queue) = NULL;
+}
+
+/**
+ * \brief Replaces the elements of the queue by the elements of the container.
+ *
+ * Detailed description see in priority_queue.h
+ */
+bool priority_queue_heapify(priority_queue_t *queue, const container_t *container)
+{
+  UC_ASSERT(queue);
+  UC_ASSERT(container);
+  UC_ASSERT(container_esize(container) == queue->esize);
+
+  size_t size = container_size(container);
+
+  priority_queue_clear(queue);
+  if (!reserve_handles(queue, size))
+  {
+    return false;
+  }
+
+  for (container_cursor_t cursor = container_cursor(container, 0); container_cursor_valid(&cursor); container_cursor_next(&cursor))
+  {
+    if (!container_push_back(queue->pool, container_cursor_cdata(&cursor)))
+    {
+      container_clear(queue->pool);
+      return false;
+    }
+  }
+
+  for (size_t i = 0; i < size; i++)
+  {
+    queue->handles[i] = i;
+    queue->positions[i] = i;
+  }
+  queue->count = size;
+  queue->size = size;
+
+  /* Floyd`s method: the nodes are sifted down from the last parent to the root, O(N) in total */
+  for (size_t i = (size > 1) ? (size - 2) / queue->arity + 1 : 0; i > 0; i--)
+  {
+    sift_down(queue, i - 1);
+  }
+
+  return true;
+}
+
+/**
+ * \brief Pushes an element into the queue.
+ *
+ * Detailed description see in priority_queue.h
+ */
+bool priority_queue_push(priority_queue_t *queue, const void *data, pq_handle_t *handle)
+{
+  UC_ASSERT(queue);
+  UC_ASSERT(data);
+
+  if (queue->size == queue->count)
+  {
+    if (!reserve_handles(queue, queue->count + 1))
+    {
+      return false;
+    }
+    queue->handles[queue->count] = queue->count;
+    queue->count++;
+  }
+
+  if (!container_push_back(queue->pool, data))
+  {
+    return false;
+  }
+
+  size_t position = queue->size++;
+  queue->positions[queue->handles[position]] = position;
+  if (NULL != handle)
+  {
+    (*handle) = queue->handles[position];
+  }
+
+  sift_up(queue, position);
+
+  return true;
+}
+
+/**
+ * \brief Pops the element from the top of the queue.
+ *
+ * Detailed description see in priority_queue.h
+ */
+bool priority_queue_pop_top(priority_queue_t *queue, void *data)
+{
+  UC_ASSERT(queue);
+
+  if (0 == queue->size)
+  {
+    return false;
+  }
+
+  if (NULL != data)
+  {
+    memcpy(data, container_data(queue->pool), queue->esize);
+  }
+
+  remove_at(queue, 0);
+
+  return true;
+}
+
+/**
+ * \brief Returns a pointer to the element on the top of the queue.
+ *
+ * Detailed description see in priority_queue.h
+ */
+const void *priority_queue_peek_top(const priority_queue_t *queue)
+{
+  UC_ASSERT(queue);
+
+  return (0 == queue->size) ? NULL : container_data(queue->pool);
+}
+
+/**
+ * \brief Replaces the element with the handle and restores the order of the queue.
+ *
+ * Detailed description see in priority_queue.h
+ */
+bool priority_queue_update(priority_queue_t *queue, pq_handle_t handle, const void *data)
+{
+  UC_ASSERT(queue);
+  UC_ASSERT(data);
+
+  if (!is_valid_handle(queue, handle))
+  {
+    return false;
+  }
+
+  size_t position = queue->positions[handle];
+  uint8_t *base = (uint8_t *)container_data(queue->pool);
+  memcpy(AT(base, queue, position), data, queue->esize);
+
+  if (position == sift_up(queue, position))
+  {
+    sift_down(queue, position);
+  }
+
+  return true;
+}
+
+/**
+ * \brief Erases the element with the handle from the queue.
+ *
+ * Detailed description see in priority_queue.h
+ */
+bool priority_queue_erase(priority_queue_t *queue, pq_handle_t handle)
+{
+  UC_ASSERT(queue);
+
+  if (!is_valid_handle(queue, handle))
+  {
+    return false;
+  }
+
+  remove_at(queue, queue->positions[handle]);
+
+  return true;
+}
+
+/**
+ * \brief Returns a pointer to the element with the handle.
+ *
+ * Detailed description see in priority_queue.h
+ */
+const void *priority_queue_peek(const priority_queue_t *queue, pq_handle_t handle)
+{
+  UC_ASSERT(queue);
+
+  if (!is_valid_handle(queue, handle))
+  {
+    return NULL;
+  }
+
+  return AT((const uint8_t *)container_data(queue->pool), queue, queue->positions[handle]);
+}
+
+/**
+ * \brief Returns the number of elements in the queue.
+ *
+ * Detailed description see in priority_queue.h
+ */
+size_t priority_queue_size(const priority_queue_t *queue)
+{
+  UC_ASSERT(queue);
+
+  return queue->size;
+}
+
+/**
+ * \brief Erases all elements from the queue.
+ *
+ * Detailed description see in priority_queue.h
+ */
+void priority_queue_clear(priority_queue_t *queue)
+{
+  UC_ASSERT(queue);
+
+  container_clear(queue->pool);
+  queue->size = 0;
+  queue->count = 0;
+}
@@ -0,0 +1,148 @@
+/**
+ * \file    priority_queue.h
+ * \author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * \brief   Priority queue on the d-ary heap stored in the vector based container.
+ *
+ * The element which is placed first in the sorted order (the smallest one for the ascending order)
+ * is on the top of the queue. The push and the pop of the top take O(log N) comparisons,
+ * the peek of the top takes O(1) and the queue is built from the container in O(N).
+ *
+ * Every pushed element gets a handle which stays valid until the element leaves the queue,
+ * so the priority of the element can be changed (decrease-key) or the element can be erased
+ * in O(log N) without searching it.
+ *
+ * The heap is binary by default. The heap with a larger arity (4 or 8) is lower, so the push is cheaper
+ * and the children of the element which are compared by the pop lie in the same cache lines.
+ *
+ * \date    2023-10-15
+ */
+
+#pragma once
+
+//_____ I N C L U D E S _______________________________________________________
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "algorithms/sort/uc_sort.h"
+#include "core/container.h"
+//_____ C O N F I G S  ________________________________________________________
+//_____ D E F I N I T I O N S _________________________________________________
+typedef struct PriorityQueue_tag priority_queue_t;
+
+/**
+ * \brief Handle of the element in the priority queue.
+ */
+typedef size_t pq_handle_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/* C++ detection */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+  /**
+   * \brief Creates a new empty priority queue.
+   *
+   * \param esize Size in bytes of the single element.
+   * \param cmp Callback function which compares the elements or NULL for `memcmp`.
+   * \param order Order of the elements: with `SORT_ASCENDING` the smallest element is on the top.
+   * \param arity Number of the children of the heap node (2 or more) or 0 for the binary heap.
+   * \return Pointer to the newly created queue or NULL if the allocation failed.
+   */
+  priority_queue_t *priority_queue_create(size_t esize, compare_fn_t cmp, ContainerSortOrder_e order, size_t arity);
+
+  /**
+   * \brief Frees up the memory associated with the queue.
+   *
+   * \param queue Double pointer to the queue to be deleted.
+   */
+  void priority_queue_delete(priority_queue_t **queue);
+
+  /**
+   * \brief Replaces the elements of the queue by the elements of the container in O(N).
+   *
+   * The element with the index `i` in the container gets the handle `i`. The container isn`t changed.
+   *
+   * \param queue Pointer to the queue.
+   * \param container Pointer to the container with the elements of the same size.
+   * \return true if the operation was successful, false if the memory allocation failed.
+   */
+  bool priority_queue_heapify(priority_queue_t *queue, const container_t *container);
+
+  /**
+   * \brief Pushes an element into the queue.
+   *
+   * \param queue Pointer to the queue.
+   * \param data Pointer to the element.
+   * \param handle Pointer to the variable which receives the handle of the element (it can be NULL).
+   * \return true if the operation was successful, false if the memory allocation failed.
+   */
+  bool priority_queue_push(priority_queue_t *queue, const void *data, pq_handle_t *handle);
+
+  /**
+   * \brief Pops the element from the top of the queue.
+   *
+   * \param queue Pointer to the queue.
+   * \param data Pointer to the buffer which receives the element (it can be NULL).
+   * \return true if the operation was successful, false if the queue is empty.
+   */
+  bool priority_queue_pop_top(priority_queue_t *queue, void *data);
+
+  /**
+   * \brief Returns a pointer to the element on the top of the queue. The element must not be changed.
+   *
+   * \param queue Pointer to the queue.
+   * \return Pointer to the element or NULL if the queue is empty.
+   */
+  const void *priority_queue_peek_top(const priority_queue_t *queue);
+
+  /**
+   * \brief Replaces the element with the handle and restores the order of the queue.
+   *
+   * The new element can be placed both before (decrease-key for the ascending order) and after the old one.
+   *
+   * \param queue Pointer to the queue.
+   * \param handle Handle of the element.
+   * \param data Pointer to the new element.
+   * \return true if the operation was successful, false if the handle isn`t in the queue.
+   */
+  bool priority_queue_update(priority_queue_t *queue, pq_handle_t handle, const void *data);
+
+  /**
+   * \brief Erases the element with the handle from the queue.
+   *
+   * \param queue Pointer to the queue.
+   * \param handle Handle of the element.
+   * \return true if the operation was successful, false if the handle isn`t in the queue.
+   */
+  bool priority_queue_erase(priority_queue_t *queue, pq_handle_t handle);
+
+  /**
+   * \brief Returns a pointer to the element with the handle. The element must not be changed.
+   *
+   * \param queue Pointer to the queue.
+   * \param handle Handle of the element.
+   * \return Pointer to the element or NULL if the handle isn`t in the queue.
+   */
+  const void *priority_queue_peek(const priority_queue_t *queue, pq_handle_t handle);
+
+  /**
+   * \brief Returns the number of elements in the queue.
+   *
+   * \param queue Pointer to the queue.
+   * \return Number of elements in the queue.
+   */
+  size_t priority_queue_size(const priority_queue_t *queue);
+
+  /**
+   * \brief Erases all elements from the queue. All handles become invalid.
+   *
+   * \param queue Pointer to the queue.
+   */
+  void priority_queue_clear(priority_queue_t *queue);
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
@@ -32,9 +32,12 @@ struct Private_tag
   size_t size;
   node_t *head;
   node_t *tail;
+  node_t *spare; /// Node detached by `acquire_front`, reused by the next insertion
 };
 
 //_____ M A C R O S ___________________________________________________________
+/// Size of the node header rounded up, so the payload stored right after the header is aligned for any type
+#define NODE_HEADER_SIZE (((sizeof(node_t) + _Alignof(max_align_t) - 1) / _Alignof(max_align_t)) * _Alignof(max_align_t))
 #define IS_NODE_LAST(node)      (NULL == node->next)
 #define IS_NODE_FIRST(node)     (NULL == node->prev)
 #define IS_NODE_NOT_LAST(node)  (NULL != node->next)
@@ -51,20 +54,14 @@ static inline node_t *node_allocate(size_t data_size)
   allocate_fn_t mem_allocate = get_allocator();
   UC_ASSERT(mem_allocate);
 
-  node_t *tmp = (node_t *)mem_allocate(sizeof *tmp);
+  // The payload is stored in the same allocation right after the node header
+  node_t *tmp = (node_t *)mem_allocate(NODE_HEADER_SIZE + data_size);
   if (NULL == tmp)
   {
     return NULL;
   }
 
-  tmp->data = mem_allocate(data_size);
-  if (NULL == tmp->data)
-  {
-    free_fn_t mem_free = get_free();
-    UC_ASSERT(mem_free);
-    mem_free(tmp);
-    return NULL;
-  }
+  tmp->data = (uint8_t *)tmp + NODE_HEADER_SIZE;
 
   return tmp;
 }
@@ -76,7 +73,6 @@ static inline void node_free(node_t *node)
   free_fn_t mem_free = get_free();
   UC_ASSERT(mem_free);
 
-  mem_free(node->data);
   mem_free(node);
 }
 
@@ -87,6 +83,7 @@ static inline void list_free(linked_list_t *linked_list)
   free_fn_t mem_free = get_free();
   UC_ASSERT(mem_free);
 
+  mem_free(linked_list->private);
   mem_free(linked_list);
 }
 
@@ -136,40 +133,202 @@ static bool resize_cb(void *list, size_t new_size)
   return true;
 }
 
-static bool push_front_cb(void *list, const void *data)
+static node_t *node_at(linked_list_t *linked_list, size_t index)
 {
-  UC_ASSERT(list);
-  UC_ASSERT(data);
+  if (index < (linked_list->private->size / 2))
+  {
+    return get_nth(linked_list->private->head, index);
+  }
 
-  linked_list_t *linked_list = (linked_list_t *)list;
+  node_t *node = linked_list->private->tail;
+  for (size_t counter = linked_list->private->size - 1; counter > index && node; counter--)
+  {
+    node = node->prev;
+  }
 
-  node_t *tmp = node_allocate(linked_list->private->esize);
-  if (NULL == tmp)
+  return node;
+}
+
+static node_t *node_take(linked_list_t *linked_list)
+{
+  node_t *node = linked_list->private->spare;
+  if (NULL != node)
   {
-    return false;
+    linked_list->private->spare = NULL;
+    return node;
   }
 
-  // Fill fields of new node
-  memcpy(tmp->data, data, linked_list->private->esize);
-  tmp->next = linked_list->private->head;
-  tmp->prev = NULL;
+  return node_allocate(linked_list->private->esize);
+}
+
+static inline void spare_free(linked_list_t *linked_list)
+{
+  if (NULL != linked_list->private->spare)
+  {
+    node_free(linked_list->private->spare);
+    linked_list->private->spare = NULL;
+  }
+}
+
+static void link_front(linked_list_t *linked_list, node_t *node)
+{
+  node->next = linked_list->private->head;
+  node->prev = NULL;
 
   // If list wasn`t empty then put prev pointer of first node to the new node
   if (linked_list->private->head)
   {
-    linked_list->private->head->prev = tmp;
+    linked_list->private->head->prev = node;
   }
 
   // Put HEAD pointer to new node
-  linked_list->private->head = tmp;
+  linked_list->private->head = node;
 
   // If list was empty then put TAIL pointer to new node
   if (linked_list->private->tail == NULL)
   {
-    linked_list->private->tail = tmp;
+    linked_list->private->tail = node;
+  }
+
+  linked_list->private->size++;
+}
+
+static void link_back(linked_list_t *linked_list, node_t *node)
+{
+  node->next = NULL;
+  node->prev = linked_list->private->tail;
+
+  // If list wasn`t empty then put next pointer of last node to the new node
+  if (linked_list->private->tail)
+  {
+    linked_list->private->tail->next = node;
+  }
+
+  // Put TAIL pointer to new node
+  linked_list->private->tail = node;
+
+  // If list was empty then put HEAD pointer to new node
+  if (linked_list->private->head == NULL)
+  {
+    linked_list->private->head = node;
+  }
+
+  linked_list->private->size++;
+}
+
+static void link_before(linked_list_t *linked_list, node_t *elm, node_t *node)
+{
+  if (IS_NODE_FIRST(elm))
+  {
+    link_front(linked_list, node);
+    return;
   }
 
+  node->prev = elm->prev;
+  node->next = elm;
+  elm->prev->next = node;
+  elm->prev = node;
+
   linked_list->private->size++;
+}
+
+static node_t *link_at(linked_list_t *linked_list, node_t *node, size_t index)
+{
+  if (0 == index)
+  {
+    link_front(linked_list, node);
+  }
+  else if (linked_list->private->size == index)
+  {
+    link_back(linked_list, node);
+  }
+  else
+  {
+    link_before(linked_list, get_nth(linked_list->private->head, index), node);
+  }
+
+  return node;
+}
+
+static void chain_free(node_t *first)
+{
+  while (first)
+  {
+    node_t *next = first->next;
+    node_free(first);
+    first = next;
+  }
+}
+
+static void link_chain(linked_list_t *linked_list, node_t *first, node_t *last, size_t count, size_t index)
+{
+  node_t *after = (index == linked_list->private->size) ? NULL : node_at(linked_list, index);
+  node_t *before = (after) ? after->prev : linked_list->private->tail;
+
+  first->prev = before;
+  last->next = after;
+
+  if (before)
+  {
+    before->next = first;
+  }
+  else
+  {
+    linked_list->private->head = first;
+  }
+
+  if (after)
+  {
+    after->prev = last;
+  }
+  else
+  {
+    linked_list->private->tail = last;
+  }
+
+  linked_list->private->size += count;
+}
+
+static void unlink_node(linked_list_t *linked_list, node_t *elm)
+{
+  // If erase not first node then move NEXT for previous node, otherwise move HEAD
+  if (IS_NODE_NOT_FIRST(elm))
+  {
+    elm->prev->next = elm->next;
+  }
+  else
+  {
+    linked_list->private->head = elm->next;
+  }
+
+  // If erase not last node then move PREV for next node, otherwise move TAIL
+  if (IS_NODE_NOT_LAST(elm))
+  {
+    elm->next->prev = elm->prev;
+  }
+  else
+  {
+    linked_list->private->tail = elm->prev;
+  }
+
+  linked_list->private->size--;
+}
+
+static bool push_front_cb(void *list, const void *data)
+{
+  UC_ASSERT(list);
+  UC_ASSERT(data);
+
+  linked_list_t *linked_list = (linked_list_t *)list;
+
+  node_t *tmp = node_take(linked_list);
+  if (NULL == tmp)
+  {
+    return false;
+  }
+
+  memcpy(tmp->data, data, linked_list->private->esize);
+  link_front(linked_list, tmp);
 
   return true;
 }
@@ -220,33 +379,14 @@ static bool push_back_cb(void *list, const void *data)
 
   linked_list_t *linked_list = (linked_list_t *)list;
 
-  node_t *tmp = node_allocate(linked_list->private->esize);
+  node_t *tmp = node_take(linked_list);
   if (NULL == tmp)
   {
     return false;
   }
 
-  // Fill fields of new node
   memcpy(tmp->data, data, linked_list->private->esize);
-  tmp->next = NULL;
-  tmp->prev = linked_list->private->tail;
-
-  // If list wasn`t empty then put next pointer of last node to the new node
-  if (linked_list->private->tail)
-  {
-    linked_list->private->tail->next = tmp;
-  }
-
-  // Put TAIL pointer to new node
-  linked_list->private->tail = tmp;
-
-  // If list was empty then put HEAD pointer to new node
-  if (linked_list->private->head == NULL)
-  {
-    linked_list->private->head = tmp;
-  }
-
-  linked_list->private->size++;
+  link_back(linked_list, tmp);
 
   return true;
 }
@@ -302,52 +442,210 @@ static bool insert_cb(void *list, const void *data, size_t index)
     return false;
   }
 
-  if (is_empty(linked_list) || index == 0)
+  node_t *tmp = node_take(linked_list);
+  if (NULL == tmp)
   {
-    linked_list->push_front(linked_list, data);
+    return false;
   }
-  else
+
+  memcpy(tmp->data, data, linked_list->private->esize);
+  link_at(linked_list, tmp, index);
+
+  return true;
+}
+
+static bool insert_range_cb(void *list, const void *data, size_t index, size_t count)
+{
+  UC_ASSERT(list);
+  UC_ASSERT(data);
+
+  linked_list_t *linked_list = (linked_list_t *)list;
+
+  if (index > linked_list->private->size)
+  {
+    return false;
+  }
+
+  if (0 == count)
+  {
+    return true;
+  }
+
+  // Build the whole chain first, so the list stays untouched if any allocation fails
+  node_t *first = NULL;
+  node_t *last = NULL;
+  const uint8_t *src = (const uint8_t *)data;
+  for (size_t i = 0; i < count; i++)
   {
-    node_t *tmp = node_allocate(linked_list->private->esize);
+    node_t *tmp = node_take(linked_list);
     if (NULL == tmp)
     {
+      chain_free(first);
       return false;
     }
 
-    node_t *elm = get_nth(linked_list->private->head, index - 1);
-
-    // Fill fields of new node
-    memcpy(tmp->data, data, linked_list->private->esize);
-    tmp->prev = elm;
-    tmp->next = elm->next;
+    memcpy(tmp->data, src, linked_list->private->esize);
+    src += linked_list->private->esize;
 
-    // If elm is not last node then put PREV pointer for next node to new node
-    if (elm->next)
+    tmp->next = NULL;
+    tmp->prev = last;
+    if (last)
     {
-      elm->next->prev = tmp;
+      last->next = tmp;
     }
+    else
+    {
+      first = tmp;
+    }
+    last = tmp;
+  }
+
+  link_chain(linked_list, first, last, count, index);
+
+  return true;
+}
+
+static bool splice_cb(void *list, size_t index, void *other)
+{
+  UC_ASSERT(list);
+  UC_ASSERT(other);
+
+  linked_list_t *linked_list = (linked_list_t *)list;
+  linked_list_t *source = (linked_list_t *)other;
 
-    // Put NEXT pointer for previous node to new node
-    elm->next = tmp;
+  if (index > linked_list->private->size || linked_list->private->esize != source->private->esize)
+  {
+    return false;
+  }
+
+  if (is_empty(source))
+  {
+    return true;
+  }
+
+  // Move the whole chain of nodes, no element is copied or allocated
+  link_chain(linked_list, source->private->head, source->private->tail, source->private->size, index);
+
+  source->private->head = source->private->tail = NULL;
+  source->private->size = 0;
+
+  return true;
+}
+
+static bool copy_cb(void *list, const void *other, void (*copy)(void *dst, const void *src, size_t esize))
+{
+  UC_ASSERT(list);
+  UC_ASSERT(other);
+
+  linked_list_t *linked_list = (linked_list_t *)list;
+  const linked_list_t *source = (const linked_list_t *)other;
+  size_t esize = source->private->esize;
+
+  if (!is_empty(linked_list) || linked_list->private->esize != esize)
+  {
+    return false;
+  }
+
+  if (0 == source->private->size)
+  {
+    return true;
+  }
 
-    // If now new node is first then change HEAD
-    if (NULL == elm->prev)
+  // Build the whole chain first, so the list stays empty if any allocation fails
+  node_t *first = NULL;
+  node_t *last = NULL;
+  for (node_t *elm = source->private->head; elm; elm = elm->next)
+  {
+    node_t *tmp = node_allocate(esize);
+    if (NULL == tmp)
     {
-      linked_list->private->head = elm;
+      chain_free(first);
+      return false;
     }
 
-    // If now new node is last then change TAIL
-    if (NULL == elm->next)
+    tmp->next = NULL;
+    tmp->prev = last;
+    if (last)
+    {
+      last->next = tmp;
+    }
+    else
     {
-      linked_list->private->tail = elm;
+      first = tmp;
     }
+    last = tmp;
+  }
 
-    linked_list->private->size++;
+  // Copy elements only when all nodes are allocated, so the deep copy callback is never called in vain
+  for (node_t *dst = first, *src = source->private->head; src; dst = dst->next, src = src->next)
+  {
+    if (copy)
+    {
+      copy(dst->data, src->data, esize);
+    }
+    else
+    {
+      memcpy(dst->data, src->data, esize);
+    }
   }
 
+  link_chain(linked_list, first, last, source->private->size, 0);
+
   return true;
 }
 
+static void *emplace_cb(void *list, size_t index)
+{
+  UC_ASSERT(list);
+
+  linked_list_t *linked_list = (linked_list_t *)list;
+
+  if (index > linked_list->private->size)
+  {
+    return NULL;
+  }
+
+  node_t *tmp = node_take(linked_list);
+  if (NULL == tmp)
+  {
+    return NULL;
+  }
+
+  return link_at(linked_list, tmp, index)->data;
+}
+
+static void *acquire_front_cb(void *list)
+{
+  UC_ASSERT(list);
+
+  linked_list_t *linked_list = (linked_list_t *)list;
+
+  if (is_empty(linked_list))
+  {
+    return NULL;
+  }
+
+  node_t *head = linked_list->private->head;
+
+  linked_list->private->head = head->next;
+  if (linked_list->private->head)
+  {
+    linked_list->private->head->prev = NULL;
+  }
+  else
+  {
+    linked_list->private->tail = NULL;
+  }
+
+  linked_list->private->size--;
+
+  // The detached node stays alive until the next insertion so the caller can read its payload in place
+  spare_free(linked_list);
+  linked_list->private->spare = head;
+
+  return head->data;
+}
+
 static bool extract_cb(void *list, void *data, size_t index)
 {
   UC_ASSERT(list);
@@ -373,6 +671,65 @@ static bool extract_cb(void *list, void *data, size_t index)
   return true;
 }
 
+static bool extract_range_cb(void *list, void *data, size_t index, size_t count)
+{
+  UC_ASSERT(list);
+
+  linked_list_t *linked_list = (linked_list_t *)list;
+
+  if (index > linked_list->private->size || count > (linked_list->private->size - index))
+  {
+    return false;
+  }
+
+  if (0 == count)
+  {
+    return true;
+  }
+
+  node_t *first = node_at(linked_list, index);
+  node_t *before = first->prev;
+  node_t *node = first;
+
+  // Copy payloads and release nodes of the range in a single pass
+  uint8_t *dst = (uint8_t *)data;
+  for (size_t i = 0; i < count; i++)
+  {
+    node_t *next = node->next;
+    if (NULL != dst)
+    {
+      memcpy(dst, node->data, linked_list->private->esize);
+      dst += linked_list->private->esize;
+    }
+
+    node_free(node);
+    node = next;
+  }
+
+  // Link the nodes around the removed range with each other
+  if (before)
+  {
+    before->next = node;
+  }
+  else
+  {
+    linked_list->private->head = node;
+  }
+
+  if (node)
+  {
+    node->prev = before;
+  }
+  else
+  {
+    linked_list->private->tail = before;
+  }
+
+  linked_list->private->size -= count;
+
+  return true;
+}
+
 static bool replace_cb(void *list, const void *data, size_t index)
 {
   UC_ASSERT(list);
@@ -462,6 +819,52 @@ static bool erase_cb(void *list, size_t index)
   return true;
 }
 
+static size_t erase_if_cb(void *list, bool (*predicate)(const void *data, size_t esize))
+{
+  UC_ASSERT(list);
+  UC_ASSERT(predicate);
+
+  linked_list_t *linked_list = (linked_list_t *)list;
+
+  size_t erased = 0;
+  node_t *elm = linked_list->private->head;
+
+  while (elm)
+  {
+    node_t *next = elm->next;
+
+    if (predicate(elm->data, linked_list->private->esize))
+    {
+      unlink_node(linked_list, elm);
+      node_free(elm);
+      erased++;
+    }
+
+    elm = next;
+  }
+
+  return erased;
+}
+
+static bool erase_unordered_cb(void *list, size_t index)
+{
+  UC_ASSERT(list);
+
+  linked_list_t *linked_list = (linked_list_t *)list;
+
+  if (index >= linked_list->private->size)
+  {
+    return false;
+  }
+
+  // Unlinking of a node doesn`t move other elements, so the order is kept for free
+  node_t *elm = node_at(linked_list, index);
+  unlink_node(linked_list, elm);
+  node_free(elm);
+
+  return true;
+}
+
 static void *peek_cb(void *list, size_t index)
 {
   UC_ASSERT(list);
@@ -482,6 +885,130 @@ static void *peek_cb(void *list, size_t index)
   return elm->data;
 }
 
+static void *data_cb(const void *list)
+{
+  UC_ASSERT(list);
+
+  //\warning: The linked list core struct doesn`t store the elements contiguously
+  return NULL;
+}
+
+static void *cursor_cb(const void *list, size_t index)
+{
+  UC_ASSERT(list);
+
+  linked_list_t *linked_list = (linked_list_t *)list;
+
+  if (index >= linked_list->private->size)
+  {
+    return NULL;
+  }
+
+  return node_at(linked_list, index);
+}
+
+static void *cursor_next_cb(const void *list, void *position)
+{
+  UC_ASSERT(list);
+  UC_ASSERT(position);
+
+  return ((node_t *)position)->next;
+}
+
+static void *cursor_data_cb(const void *list, void *position)
+{
+  UC_ASSERT(list);
+  UC_ASSERT(position);
+
+  return ((node_t *)position)->data;
+}
+
+static void *erase_cursor_cb(void *list, void *position)
+{
+  UC_ASSERT(list);
+  UC_ASSERT(position);
+
+  linked_list_t *linked_list = (linked_list_t *)list;
+  node_t *elm = (node_t *)position;
+  node_t *next = elm->next;
+
+  unlink_node(linked_list, elm);
+  node_free(elm);
+
+  return next;
+}
+
+static bool reverse_cb(void *list)
+{
+  UC_ASSERT(list);
+
+  linked_list_t *linked_list = (linked_list_t *)list;
+
+  // Only the links are flipped, the payloads stay in their nodes
+  node_t *node = linked_list->private->head;
+  while (node)
+  {
+    node_t *next = node->next;
+    node->next = node->prev;
+    node->prev = next;
+    node = next;
+  }
+
+  node = linked_list->private->head;
+  linked_list->private->head = linked_list->private->tail;
+  linked_list->private->tail = node;
+
+  return true;
+}
+
+static bool rotate_cb(void *list, size_t count)
+{
+  UC_ASSERT(list);
+
+  linked_list_t *linked_list = (linked_list_t *)list;
+  size_t size = linked_list->private->size;
+
+  if (size < 2 || 0 == (count %= size))
+  {
+    return true;
+  }
+
+  // The list is closed into the ring and opened before the new head, so only four links are changed
+  node_t *head = node_at(linked_list, count);
+  node_t *tail = head->prev;
+
+  linked_list->private->tail->next = linked_list->private->head;
+  linked_list->private->head->prev = linked_list->private->tail;
+  tail->next = NULL;
+  head->prev = NULL;
+
+  linked_list->private->head = head;
+  linked_list->private->tail = tail;
+
+  return true;
+}
+
+static bool fill_cb(void *list, size_t first, size_t count, const void *data)
+{
+  UC_ASSERT(list);
+  UC_ASSERT(data);
+
+  linked_list_t *linked_list = (linked_list_t *)list;
+
+  if (first > linked_list->private->size || count > linked_list->private->size - first)
+  {
+    return false;
+  }
+
+  node_t *node = (0 == count) ? NULL : node_at(linked_list, first);
+  for (size_t i = 0; i < count; i++, node = node->next)
+  {
+    memcpy(node->data, data, linked_list->private->esize);
+  }
+
+  return true;
+}
+
 static bool clear_cb(void *list)
 {
   UC_ASSERT(list);
@@ -497,6 +1024,8 @@ static bool clear_cb(void *list)
     tmp = next;
   }
 
+  spare_free(linked_list);
+
   linked_list->private->head = linked_list->private->tail = NULL;
   linked_list->private->size = 0;
   linked_list->private->esize = linked_list->private->esize;
@@ -534,6 +1063,7 @@ linked_list_t *linked_list_create(size_t esize)
   }
 
   linked_list->private->head = linked_list->private->tail = NULL;
+  linked_list->private->spare = NULL;
   linked_list->private->size = 0;
   linked_list->private->esize = esize;
 
@@ -551,6 +1081,22 @@ linked_list_t *linked_list_create(size_t esize)
   linked_list->clear = clear_cb;
   linked_list->size = size_cb;
   linked_list->esize = esize_cb;
+  linked_list->emplace = emplace_cb;
+  linked_list->acquire_front = acquire_front_cb;
+  linked_list->extract_range = extract_range_cb;
+  linked_list->insert_range = insert_range_cb;
+  linked_list->erase_if = erase_if_cb;
+  linked_list->erase_unordered = erase_unordered_cb;
+  linked_list->cursor = cursor_cb;
+  linked_list->cursor_next = cursor_next_cb;
+  linked_list->cursor_data = cursor_data_cb;
+  linked_list->erase_cursor = erase_cursor_cb;
+  linked_list->splice = splice_cb;
+  linked_list->copy = copy_cb;
+  linked_list->data = data_cb;
+  linked_list->reverse = reverse_cb;
+  linked_list->rotate = rotate_cb;
+  linked_list->fill = fill_cb;
 
   return linked_list;
 }
@@ -574,6 +1120,7 @@ void linked_list_delete(linked_list_t **list)
     tmp = next;
   }
 
+  spare_free(*list);
   list_free(*list);
   (*list) = NULL;
 }
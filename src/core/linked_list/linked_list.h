@@ -48,6 +48,24 @@ typedef struct
     bool (*clear)(void *this);   /**< Clears all elements from the list. */
     size_t (*size)(const void *this);  /**< Returns the number of elements in the list. */
     size_t (*esize)(const void *this); /**< Get the size of single element (in bytes). */
+    void *(*emplace)(void *this, size_t index); /**< Reserves a node at the specified index and returns its payload. */
+    void *(*acquire_front)(void *this);         /**< Detaches the front element and returns its payload without copying. */
+    bool (*extract_range)(void *this, void *data, size_t index, size_t count); /**< Extracts (or drops) a range of elements. */
+    bool (*insert_range)(void *this, const void *data, size_t index, size_t count); /**< Inserts an array of elements. */
+    size_t (*erase_if)(void *this, bool (*predicate)(const void *data, size_t esize)); /**< Removes matching elements. */
+    bool (*erase_unordered)(void *this, size_t index);      /**< Removes an element, the order may be not kept. */
+    void *(*cursor)(const void *this, size_t index);        /**< Returns a position (node) of the element at the index. */
+    void *(*cursor_next)(const void *this, void *position); /**< Returns a position of the next element. */
+    void *(*cursor_data)(const void *this, void *position); /**< Returns a pointer to the element at the position. */
+    void *(*erase_cursor)(void *this, void *position);      /**< Removes the element at the position in O(1). */
+    bool (*splice)(void *this, size_t index, void *other);  /**< Moves all nodes of other list at the index in O(1). */
+    bool (*copy)(void *this,
+                 const void *other,
+                 void (*copy)(void *dst, const void *src, size_t esize)); /**< Copies all elements of other list. */
+    void *(*data)(const void *this); /**< Returns NULL, the elements aren`t stored contiguously. */
+    bool (*reverse)(void *this);              /**< Reverses the order of the elements by flipping the links. */
+    bool (*rotate)(void *this, size_t count); /**< Rotates the elements to the left by relinking of the ends. */
+    bool (*fill)(void *this, size_t first, size_t count, const void *data); /**< Fills a range of elements by a value. */
   };
 } linked_list_t;
 //_____ M A C R O S ___________________________________________________________
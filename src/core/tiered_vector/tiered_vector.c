@@ -0,0 +1,1030 @@
+/**
+ * \file tiered_vector.c
+ * \author Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * \brief Tiered vector: array of the circular buffers (tiers) of about sqrt(N) elements.
+ * \date 2023-10-18
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "tiered_vector.h"
+
+#include "common/uc_assert.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "interface/allocator_if.h"
+//_____ C O N F I G S  ________________________________________________________
+/**
+ * \brief The width of the tier is a power of two, not less than 2^MIN_SHIFT elements.
+ */
+#define MIN_SHIFT 4
+//_____ D E F I N I T I O N S _________________________________________________
+typedef struct
+{
+  uint8_t *data; /// Circular buffer of the tier width elements
+  size_t head;   /// Slot of the first element of the tier
+} tier_t;
+
+/*
+ * The elements are placed at the physical positions [lead, lead + size) of the tiers, the position p is stored
+ * in the tier p / width at the offset p % width from its head. All tiers between the first and the last
+ * elements are full, so the element is found by the index in O(1) and the shift of the elements by a few
+ * positions rotates the heads of the full tiers instead of moving their elements.
+ *
+ * The position of the cursor is the index of the element plus one, so the positions survive the moves of
+ * the elements.
+ */
+struct Private_tag
+{
+  size_t esize;     /// Single element size
+  size_t size;      /// Number of the elements
+  size_t shift;     /// Log2 of the tier width
+  size_t lead;      /// Number of the free positions before the first element
+  tier_t *tiers;    /// Array of the tiers
+  size_t count;     /// Number of the tiers
+  size_t capacity;  /// Number of the tiers the array can hold
+  uint8_t *scratch; /// Buffer of a single element: the element acquired from the front and the swaps
+};
+//_____ M A C R O S ___________________________________________________________
+/// Private data of the vector
+#define PRIVATE(vector) (((tiered_vector_t *)(vector))->private)
+
+#define WIDTH(vector) ((size_t)1 << (vector)->shift)
+#define MASK(vector)  (WIDTH(vector) - 1)
+
+/// Position of the cursor and the index of the element it points to
+#define POSITION(index) ((void *)(uintptr_t)((index) + 1))
+#define INDEX(position)  ((size_t)(uintptr_t)(position) - 1)
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+static inline size_t min_size(size_t a, size_t b)
+{
+  return (a < b) ? a : b;
+}
+
+static inline size_t max_size(size_t a, size_t b)
+{
+  return (a > b) ? a : b;
+}
+
+static inline uint8_t *slot(const private_t *vector, size_t position)
+{
+  const tier_t *tier = &vector->tiers[position >> vector->shift];
+
+  return &tier->data[((tier->head + position) & MASK(vector)) * vector->esize];
+}
+
+/*
+ * Moves `n` elements from the offset of one tier to the offset of other (or the same) tier by the runs
+ * which are contiguous in both circular buffers.
+ */
+static void tier_move(const private_t *vector, tier_t *dst, size_t dst_offset, const tier_t *src, size_t src_offset, size_t n)
+{
+  size_t width = WIDTH(vector);
+  size_t mask = MASK(vector);
+  size_t esize = vector->esize;
+
+  if (dst == src && dst_offset > src_offset)
+  {
+    // Overlapped move to the back of the same tier goes from the last element
+    while (n > 0)
+    {
+      size_t s = (src->head + src_offset + n - 1) & mask;
+      size_t d = (dst->head + dst_offset + n - 1) & mask;
+      size_t run = min_size(n, min_size(s, d) + 1);
+
+      memmove(&dst->data[(d + 1 - run) * esize], &src->data[(s + 1 - run) * esize], run * esize);
+      n -= run;
+    }
+    return;
+  }
+
+  while (n > 0)
+  {
+    size_t s = (src->head + src_offset) & mask;
+    size_t d = (dst->head + dst_offset) & mask;
+    size_t run = min_size(n, width - max_size(s, d));
+
+    memmove(&dst->data[d * esize], &src->data[s * esize], run * esize);
+    src_offset += run;
+    dst_offset += run;
+    n -= run;
+  }
+}
+
+/* The physical positions [first, last) of the tier `k` are moved by `by` positions */
+static void tier_shift(const private_t *vector, size_t k, size_t first, size_t last, size_t by, bool back)
+{
+  if (first >= last)
+  {
+    return;
+  }
+
+  size_t base = k << vector->shift;
+  size_t target = (back) ? first + by : first - by;
+  tier_t *src = &vector->tiers[k];
+  tier_t *dst = &vector->tiers[target >> vector->shift];
+
+  tier_move(vector, dst, target - (((target >> vector->shift) << vector->shift)), src, first - base, last - first);
+}
+
+/*
+ * Moves the elements of the physical positions [first, last) by `by` positions to the back. The full tiers
+ * inside of the range are rotated, only the tiers at the ends of the range move their elements,
+ * so the shift by one position takes O(width + number of tiers).
+ */
+static void shift_back(private_t *vector, size_t first, size_t last, size_t by)
+{
+  size_t width = WIDTH(vector);
+
+  if (first >= last || 0 == by)
+  {
+    return;
+  }
+
+  if (by >= width)
+  {
+    for (size_t i = last; i-- > first;)
+    {
+      memcpy(slot(vector, i + by), slot(vector, i), vector->esize);
+    }
+    return;
+  }
+
+  size_t tp = first >> vector->shift;
+  size_t tq = (last + by - 1) >> vector->shift;
+
+  for (size_t k = tq + 1; k-- > tp;)
+  {
+    size_t base = k << vector->shift;
+
+    if (k > tp && k < tq)
+    {
+      vector->tiers[k].head = (vector->tiers[k].head - by) & MASK(vector);
+    }
+    else
+    {
+      tier_shift(vector, k, max_size(first, base), min_size(last, base + width - by), by, true);
+    }
+
+    if (k > tp)
+    {
+      // The last elements of the previous tier come to the front of this tier
+      tier_shift(vector, k - 1, max_size(first, base - by), min_size(last, base), by, true);
+    }
+  }
+}
+
+/* Moves the elements of the physical positions [first, last) by `by` positions to the front */
+static void shift_front(private_t *vector, size_t first, size_t last, size_t by)
+{
+  size_t width = WIDTH(vector);
+
+  if (first >= last || 0 == by)
+  {
+    return;
+  }
+
+  if (by >= width)
+  {
+    for (size_t i = first; i < last; i++)
+    {
+      memcpy(slot(vector, i - by), slot(vector, i), vector->esize);
+    }
+    return;
+  }
+
+  size_t tp = (first - by) >> vector->shift;
+  size_t tq = (last - 1) >> vector->shift;
+
+  for (size_t k = tp; k <= tq; k++)
+  {
+    size_t base = k << vector->shift;
+
+    if (k > tp && k < tq)
+    {
+      vector->tiers[k].head = (vector->tiers[k].head + by) & MASK(vector);
+    }
+    else
+    {
+      tier_shift(vector, k, max_size(first, base + by), min_size(last, base + width), by, false);
+    }
+
+    if (k < tq)
+    {
+      // The first elements of the next tier come to the back of this tier
+      tier_shift(vector, k + 1, max_size(first, base + width), min_size(last, base + width + by), by, false);
+    }
+  }
+}
+
+static bool tiers_reserve(private_t *vector, size_t count)
+{
+  if (count <= vector->capacity)
+  {
+    return true;
+  }
+
+  allocate_fn_t mem_allocate = get_allocator();
+  free_fn_t mem_free = get_free();
+
+  size_t capacity = max_size(count, 2 * vector->capacity);
+  tier_t *tiers = (tier_t *)mem_allocate(capacity * sizeof(tier_t));
+  if (NULL == tiers)
+  {
+    return false;
+  }
+
+  if (vector->tiers)
+  {
+    memcpy(tiers, vector->tiers, vector->count * sizeof(tier_t));
+    mem_free(vector->tiers);
+  }
+
+  vector->tiers = tiers;
+  vector->capacity = capacity;
+
+  return true;
+}
+
+/* The tiers are allocated into the unused entries of the array [first, first + n) */
+static bool tiers_allocate(private_t *vector, size_t first, size_t n)
+{
+  allocate_fn_t mem_allocate = get_allocator();
+  free_fn_t mem_free = get_free();
+
+  for (size_t i = 0; i < n; i++)
+  {
+    vector->tiers[first + i].head = 0;
+    vector->tiers[first + i].data = (uint8_t *)mem_allocate(WIDTH(vector) * vector->esize);
+    if (NULL == vector->tiers[first + i].data)
+    {
+      while (i-- > 0)
+      {
+        mem_free(vector->tiers[first + i].data);
+      }
+      return false;
+    }
+  }
+
+  return true;
+}
+
+static bool tiers_append(private_t *vector, size_t n)
+{
+  if (!tiers_reserve(vector, vector->count + n) || !tiers_allocate(vector, vector->count, n))
+  {
+    return false;
+  }
+
+  vector->count += n;
+
+  return true;
+}
+
+static bool tiers_prepend(private_t *vector, size_t n)
+{
+  // The new tiers are allocated behind the spare entries, so the failure leaves the array untouched
+  if (!tiers_reserve(vector, vector->count + 2 * n) || !tiers_allocate(vector, vector->count + n, n))
+  {
+    return false;
+  }
+
+  memmove(&vector->tiers[n], vector->tiers, vector->count * sizeof(tier_t));
+  memcpy(vector->tiers, &vector->tiers[vector->count + n], n * sizeof(tier_t));
+  vector->count += n;
+  vector->lead += n << vector->shift;
+
+  return true;
+}
+
+static void tiers_free(private_t *vector)
+{
+  free_fn_t mem_free = get_free();
+
+  for (size_t i = 0; i < vector->count; i++)
+  {
+    mem_free(vector->tiers[i].data);
+  }
+
+  if (vector->tiers)
+  {
+    mem_free(vector->tiers);
+  }
+
+  vector->tiers = NULL;
+  vector->count = 0;
+  vector->capacity = 0;
+  vector->lead = 0;
+}
+
+/* The spare tiers are released, up to one spare tier is kept at each end */
+static void trim(private_t *vector)
+{
+  free_fn_t mem_free = get_free();
+  size_t width = WIDTH(vector);
+
+  if (0 == vector->size)
+  {
+    vector->lead = 0;
+  }
+
+  size_t spare = 0;
+  while (vector->lead >= 2 * width)
+  {
+    mem_free(vector->tiers[spare++].data);
+    vector->lead -= width;
+  }
+
+  if (0 != spare)
+  {
+    vector->count -= spare;
+    memmove(vector->tiers, &vector->tiers[spare], vector->count * sizeof(tier_t));
+  }
+
+  while ((vector->count << vector->shift) - (vector->lead + vector->size) >= 2 * width)
+  {
+    mem_free(vector->tiers[--vector->count].data);
+  }
+}
+
+static size_t shift_for(size_t size)
+{
+  size_t shift = MIN_SHIFT;
+  while (((size_t)1 << (2 * shift)) < size)
+  {
+    shift++;
+  }
+
+  return shift;
+}
+
+/*
+ * The elements are copied into the tiers of the new width. The width is changed when the number of the elements
+ * differs from the square of the width by more than four times, so the copy is amortized by the insertions
+ * and erasures. If the memory isn`t enough, the vector keeps the current width.
+ */
+static void rebalance(private_t *vector)
+{
+  size_t square = (size_t)1 << (2 * vector->shift);
+  if (vector->size <= 4 * square && (vector->size >= square / 4 || MIN_SHIFT == vector->shift))
+  {
+    return;
+  }
+
+  if (0 == vector->size)
+  {
+    tiers_free(vector);
+    vector->shift = MIN_SHIFT;
+    return;
+  }
+
+  allocate_fn_t mem_allocate = get_allocator();
+  free_fn_t mem_free = get_free();
+
+  private_t tmp = *vector;
+  tmp.shift = shift_for(vector->size);
+  tmp.lead = 0;
+  tmp.count = ((vector->size - 1) >> tmp.shift) + 1;
+  tmp.capacity = tmp.count;
+  tmp.tiers = (tier_t *)mem_allocate(tmp.capacity * sizeof(tier_t));
+  if (NULL == tmp.tiers)
+  {
+    return;
+  }
+
+  if (!tiers_allocate(&tmp, 0, tmp.count))
+  {
+    mem_free(tmp.tiers);
+    return;
+  }
+
+  for (size_t i = 0; i < vector->size; i++)
+  {
+    memcpy(slot(&tmp, i), slot(vector, vector->lead + i), vector->esize);
+  }
+
+  tiers_free(vector);
+  *vector = tmp;
+}
+
+/*
+ * Opens `count` slots at the index. The smaller part of the elements is moved: the elements before the index
+ * to the front or the elements after the index to the back. Returns false without any change
+ * if the memory for the new tiers isn`t available.
+ */
+static bool make_room(private_t *vector, size_t index, size_t count)
+{
+  size_t width = WIDTH(vector);
+
+  if (index < vector->size - index)
+  {
+    if (vector->lead < count && !tiers_prepend(vector, (count - vector->lead + width - 1) >> vector->shift))
+    {
+      return false;
+    }
+
+    shift_front(vector, vector->lead, vector->lead + index, count);
+    vector->lead -= count;
+  }
+  else
+  {
+    size_t end = vector->lead + vector->size;
+    size_t available = (vector->count << vector->shift) - end;
+    if (available < count && !tiers_append(vector, (count - available + width - 1) >> vector->shift))
+    {
+      return false;
+    }
+
+    shift_back(vector, vector->lead + index, end, count);
+  }
+
+  vector->size += count;
+
+  return true;
+}
+
+/* Closes `count` slots at the index by the move of the smaller part of the elements */
+static void remove_range(private_t *vector, size_t index, size_t count)
+{
+  if (index < vector->size - index - count)
+  {
+    shift_back(vector, vector->lead, vector->lead + index, count);
+    vector->lead += count;
+  }
+  else
+  {
+    shift_front(vector, vector->lead + index + count, vector->lead + vector->size, count);
+  }
+
+  vector->size -= count;
+}
+
+static void *emplace_at(private_t *vector, size_t index)
+{
+  if (index > vector->size || !make_room(vector, index, 1))
+  {
+    return NULL;
+  }
+
+  rebalance(vector);
+
+  return slot(vector, vector->lead + index);
+}
+
+static void erase_at(private_t *vector, size_t index)
+{
+  remove_range(vector, index, 1);
+  trim(vector);
+  rebalance(vector);
+}
+
+static void swap(private_t *vector, size_t i, size_t j)
+{
+  uint8_t *a = slot(vector, vector->lead + i);
+  uint8_t *b = slot(vector, vector->lead + j);
+
+  memcpy(vector->scratch, a, vector->esize);
+  memcpy(a, b, vector->esize);
+  memcpy(b, vector->scratch, vector->esize);
+}
+
+static void reverse_range(private_t *vector, size_t first, size_t last)
+{
+  while (first + 1 < last)
+  {
+    swap(vector, first++, --last);
+  }
+}
+
+static bool resize_cb(void *vector, size_t new_size)
+{
+  UC_ASSERT(vector);
+  (void)new_size;
+
+  //\warning: The tiers are allocated on demand, nothing to reserve
+  return true;
+}
+
+static bool insert_cb(void *vector, const void *data, size_t index)
+{
+  UC_ASSERT(vector);
+  UC_ASSERT(data);
+
+  private_t *_vector = PRIVATE(vector);
+
+  void *element = emplace_at(_vector, index);
+  if (NULL == element)
+  {
+    return false;
+  }
+
+  memcpy(element, data, _vector->esize);
+
+  return true;
+}
+
+static bool push_front_cb(void *vector, const void *data)
+{
+  UC_ASSERT(vector);
+  UC_ASSERT(data);
+
+  return insert_cb(vector, data, 0);
+}
+
+static bool push_back_cb(void *vector, const void *data)
+{
+  UC_ASSERT(vector);
+  UC_ASSERT(data);
+
+  return insert_cb(vector, data, PRIVATE(vector)->size);
+}
+
+static bool extract_cb(void *vector, void *data, size_t index)
+{
+  UC_ASSERT(vector);
+  UC_ASSERT(data);
+
+  private_t *_vector = PRIVATE(vector);
+
+  if (index >= _vector->size)
+  {
+    return false;
+  }
+
+  memcpy(data, slot(_vector, _vector->lead + index), _vector->esize);
+  erase_at(_vector, index);
+
+  return true;
+}
+
+static bool pop_front_cb(void *vector, void *data)
+{
+  UC_ASSERT(vector);
+  UC_ASSERT(data);
+
+  return extract_cb(vector, data, 0);
+}
+
+static bool pop_back_cb(void *vector, void *data)
+{
+  UC_ASSERT(vector);
+  UC_ASSERT(data);
+
+  private_t *_vector = PRIVATE(vector);
+
+  return (0 != _vector->size) && extract_cb(vector, data, _vector->size - 1);
+}
+
+static bool replace_cb(void *vector, const void *data, size_t index)
+{
+  UC_ASSERT(vector);
+  UC_ASSERT(data);
+
+  private_t *_vector = PRIVATE(vector);
+
+  if (index >= _vector->size)
+  {
+    return false;
+  }
+
+  memcpy(slot(_vector, _vector->lead + index), data, _vector->esize);
+
+  return true;
+}
+
+static bool at_cb(const void *vector, void *data, size_t index)
+{
+  UC_ASSERT(vector);
+  UC_ASSERT(data);
+
+  const private_t *_vector = PRIVATE(vector);
+
+  if (index >= _vector->size)
+  {
+    return false;
+  }
+
+  memcpy(data, slot(_vector, _vector->lead + index), _vector->esize);
+
+  return true;
+}
+
+static bool erase_cb(void *vector, size_t index)
+{
+  UC_ASSERT(vector);
+
+  private_t *_vector = PRIVATE(vector);
+
+  if (index >= _vector->size)
+  {
+    return false;
+  }
+
+  erase_at(_vector, index);
+
+  return true;
+}
+
+static void *peek_cb(void *vector, size_t index)
+{
+  UC_ASSERT(vector);
+
+  private_t *_vector = PRIVATE(vector);
+
+  return (index < _vector->size) ? slot(_vector, _vector->lead + index) : NULL;
+}
+
+static bool clear_cb(void *vector)
+{
+  UC_ASSERT(vector);
+
+  private_t *_vector = PRIVATE(vector);
+
+  tiers_free(_vector);
+  _vector->size = 0;
+  _vector->shift = MIN_SHIFT;
+
+  return true;
+}
+
+static size_t size_cb(const void *vector)
+{
+  UC_ASSERT(vector);
+
+  return PRIVATE(vector)->size;
+}
+
+static size_t esize_cb(const void *vector)
+{
+  UC_ASSERT(vector);
+
+  return PRIVATE(vector)->esize;
+}
+
+static void *emplace_cb(void *vector, size_t index)
+{
+  UC_ASSERT(vector);
+
+  return emplace_at(PRIVATE(vector), index);
+}
+
+static void *acquire_front_cb(void *vector)
+{
+  UC_ASSERT(vector);
+
+  private_t *_vector = PRIVATE(vector);
+
+  // The element is moved by the erasure, so its copy is returned instead
+  return extract_cb(vector, _vector->scratch, 0) ? _vector->scratch : NULL;
+}
+
+static bool extract_range_cb(void *vector, void *data, size_t index, size_t count)
+{
+  UC_ASSERT(vector);
+
+  private_t *_vector = PRIVATE(vector);
+
+  if (index > _vector->size || count > (_vector->size - index))
+  {
+    return false;
+  }
+
+  if (NULL != data)
+  {
+    for (size_t i = 0; i < count; i++)
+    {
+      memcpy(&((uint8_t *)data)[i * _vector->esize], slot(_vector, _vector->lead + index + i), _vector->esize);
+    }
+  }
+
+  remove_range(_vector, index, count);
+  trim(_vector);
+  rebalance(_vector);
+
+  return true;
+}
+
+static bool insert_range_cb(void *vector, const void *data, size_t index, size_t count)
+{
+  UC_ASSERT(vector);
+  UC_ASSERT(data);
+
+  private_t *_vector = PRIVATE(vector);
+
+  if (index > _vector->size || !make_room(_vector, index, count))
+  {
+    return false;
+  }
+
+  for (size_t i = 0; i < count; i++)
+  {
+    memcpy(slot(_vector, _vector->lead + index + i), &((const uint8_t *)data)[i * _vector->esize], _vector->esize);
+  }
+
+  rebalance(_vector);
+
+  return true;
+}
+
+static size_t erase_if_cb(void *vector, bool (*predicate)(const void *data, size_t esize))
+{
+  UC_ASSERT(vector);
+  UC_ASSERT(predicate);
+
+  private_t *_vector = PRIVATE(vector);
+  size_t kept = 0;
+
+  for (size_t i = 0; i < _vector->size; i++)
+  {
+    uint8_t *element = slot(_vector, _vector->lead + i);
+    if (predicate(element, _vector->esize))
+    {
+      continue;
+    }
+
+    if (kept != i)
+    {
+      memcpy(slot(_vector, _vector->lead + kept), element, _vector->esize);
+    }
+    kept++;
+  }
+
+  size_t erased = _vector->size - kept;
+  _vector->size = kept;
+  trim(_vector);
+  rebalance(_vector);
+
+  return erased;
+}
+
+static void *cursor_cb(const void *vector, size_t index)
+{
+  UC_ASSERT(vector);
+
+  return (index < PRIVATE(vector)->size) ? POSITION(index) : NULL;
+}
+
+static void *cursor_next_cb(const void *vector, void *position)
+{
+  UC_ASSERT(vector);
+  UC_ASSERT(position);
+
+  size_t index = INDEX(position) + 1;
+
+  return (index < PRIVATE(vector)->size) ? POSITION(index) : NULL;
+}
+
+static void *cursor_data_cb(const void *vector, void *position)
+{
+  UC_ASSERT(vector);
+  UC_ASSERT(position);
+
+  const private_t *_vector = PRIVATE(vector);
+
+  return slot(_vector, _vector->lead + INDEX(position));
+}
+
+static void *erase_cursor_cb(void *vector, void *position)
+{
+  UC_ASSERT(vector);
+  UC_ASSERT(position);
+
+  private_t *_vector = PRIVATE(vector);
+  size_t index = INDEX(position);
+
+  // Only the elements after the cursor are moved and the width isn`t changed, so the pointers
+  // to the visited elements stay valid during the walk
+  shift_front(_vector, _vector->lead + index + 1, _vector->lead + _vector->size, 1);
+  _vector->size--;
+  trim(_vector);
+
+  return (index < _vector->size) ? position : NULL;
+}
+
+static bool splice_cb(void *vector, size_t index, void *other)
+{
+  UC_ASSERT(vector);
+  UC_ASSERT(other);
+
+  private_t *_vector = PRIVATE(vector);
+  private_t *source = PRIVATE(other);
+
+  if (index > _vector->size || _vector->esize != source->esize || !make_room(_vector, index, source->size))
+  {
+    return false;
+  }
+
+  for (size_t i = 0; i < source->size; i++)
+  {
+    memcpy(slot(_vector, _vector->lead + index + i), slot(source, source->lead + i), _vector->esize);
+  }
+
+  clear_cb(other);
+  rebalance(_vector);
+
+  return true;
+}
+
+static bool copy_cb(void *vector, const void *other, void (*copy)(void *dst, const void *src, size_t esize))
+{
+  UC_ASSERT(vector);
+  UC_ASSERT(other);
+
+  private_t *_vector = PRIVATE(vector);
+  const private_t *source = PRIVATE(other);
+  size_t esize = source->esize;
+
+  if (0 != _vector->size || _vector->esize != esize)
+  {
+    return false;
+  }
+
+  // The empty vector takes the width for the number of the elements at once
+  tiers_free(_vector);
+  _vector->shift = shift_for(source->size);
+
+  if (!make_room(_vector, 0, source->size))
+  {
+    return false;
+  }
+
+  // Copy elements only when all tiers are allocated, so the deep copy callback is never called in vain
+  for (size_t i = 0; i < source->size; i++)
+  {
+    if (copy)
+    {
+      copy(slot(_vector, i), slot(source, source->lead + i), esize);
+    }
+    else
+    {
+      memcpy(slot(_vector, i), slot(source, source->lead + i), esize);
+    }
+  }
+
+  return true;
+}
+
+static void *data_cb(const void *vector)
+{
+  UC_ASSERT(vector);
+
+  //\warning: The tiered vector core struct doesn`t store the elements contiguously
+  return NULL;
+}
+
+static bool reverse_cb(void *vector)
+{
+  UC_ASSERT(vector);
+
+  private_t *_vector = PRIVATE(vector);
+
+  reverse_range(_vector, 0, _vector->size);
+
+  return true;
+}
+
+static bool rotate_cb(void *vector, size_t count)
+{
+  UC_ASSERT(vector);
+
+  private_t *_vector = PRIVATE(vector);
+  size_t size = _vector->size;
+
+  if (size < 2 || 0 == (count %= size))
+  {
+    return true;
+  }
+
+  // Rotation by three reversals doesn`t need the additional memory
+  reverse_range(_vector, 0, count);
+  reverse_range(_vector, count, size);
+  reverse_range(_vector, 0, size);
+
+  return true;
+}
+
+static bool fill_cb(void *vector, size_t first, size_t count, const void *data)
+{
+  UC_ASSERT(vector);
+  UC_ASSERT(data);
+
+  private_t *_vector = PRIVATE(vector);
+
+  if (first > _vector->size || count > _vector->size - first)
+  {
+    return false;
+  }
+
+  for (size_t i = 0; i < count; i++)
+  {
+    memcpy(slot(_vector, _vector->lead + first + i), data, _vector->esize);
+  }
+
+  return true;
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * \brief Creates a new tiered vector with a specified element size.
+ *
+ * Detailed description see in tiered_vector.h
+ */
+tiered_vector_t *tiered_vector_create(size_t esize)
+{
+  UC_ASSERT(0 != esize);
+
+  if (!is_allocator_valid())
+  {
+    return NULL;
+  }
+
+  allocate_fn_t mem_allocate = get_allocator();
+  free_fn_t mem_free = get_free();
+
+  tiered_vector_t *tiered_vector = (tiered_vector_t *)mem_allocate(sizeof *tiered_vector);
+  if (NULL == tiered_vector)
+  {
+    return NULL;
+  }
+
+  private_t *_vector = (private_t *)mem_allocate(sizeof(private_t));
+  uint8_t *scratch = (uint8_t *)mem_allocate(esize);
+  if (NULL == _vector || NULL == scratch)
+  {
+    if (_vector)
+    {
+      mem_free(_vector);
+    }
+    if (scratch)
+    {
+      mem_free(scratch);
+    }
+    mem_free(tiered_vector);
+    return NULL;
+  }
+
+  _vector->esize = esize;
+  _vector->size = 0;
+  _vector->shift = MIN_SHIFT;
+  _vector->lead = 0;
+  _vector->tiers = NULL;
+  _vector->count = 0;
+  _vector->capacity = 0;
+  _vector->scratch = scratch;
+  tiered_vector->private = _vector;
+
+  tiered_vector->resize = resize_cb;
+  tiered_vector->push_front = push_front_cb;
+  tiered_vector->pop_front = pop_front_cb;
+  tiered_vector->push_back = push_back_cb;
+  tiered_vector->pop_back = pop_back_cb;
+  tiered_vector->insert = insert_cb;
+  tiered_vector->extract = extract_cb;
+  tiered_vector->replace = replace_cb;
+  tiered_vector->at = at_cb;
+  tiered_vector->erase = erase_cb;
+  tiered_vector->peek = peek_cb;
+  tiered_vector->clear = clear_cb;
+  tiered_vector->size = size_cb;
+  tiered_vector->esize = esize_cb;
+  tiered_vector->emplace = emplace_cb;
+  tiered_vector->acquire_front = acquire_front_cb;
+  tiered_vector->extract_range = extract_range_cb;
+  tiered_vector->insert_range = insert_range_cb;
+  tiered_vector->erase_if = erase_if_cb;
+  tiered_vector->erase_unordered = erase_cb;
+  tiered_vector->cursor = cursor_cb;
+  tiered_vector->cursor_next = cursor_next_cb;
+  tiered_vector->cursor_data = cursor_data_cb;
+  tiered_vector->erase_cursor = erase_cursor_cb;
+  tiered_vector->splice = splice_cb;
+  tiered_vector->copy = copy_cb;
+  tiered_vector->data = data_cb;
+  tiered_vector->reverse = reverse_cb;
+  tiered_vector->rotate = rotate_cb;
+  tiered_vector->fill = fill_cb;
+
+  return tiered_vector;
+}
+
+/**
+ * \brief Frees up the memory associated with the tiered vector.
+ *
+ * Detailed description see in tiered_vector.h
+ */
+void tiered_vector_delete(tiered_vector_t **vector)
+{
+  UC_ASSERT(vector);
+  UC_ASSERT(*vector);
+
+  free_fn_t mem_free = get_free();
+  private_t *_vector = (*vector)->private;
+
+  tiers_free(_vector);
+  mem_free(_vector->scratch);
+  mem_free(_vector);
+  mem_free(*vector);
+  (*vector) = NULL;
+}
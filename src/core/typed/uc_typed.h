@@ -0,0 +1,324 @@
+/**
+ * \file    uc_typed.h
+ * \author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * \brief   Type-specialized containers generated by macros.
+ *
+ * The macros of this file generate a family of static inline functions which work with the elements
+ * of the specific type `T` instead of `void *` and runtime element size. The element is moved as a value
+ * of known size, so the compiler emits plain register moves instead of `memcpy` calls, and the typed
+ * algorithms (sort, find) compile to straight-line code with constant element size and inlined comparison.
+ *
+ * The generated type is only a typed view of the `container_t`, so any typed container can be passed to
+ * the generic functions and algorithms via `<name>_container` and back via `<name>_from_container`.
+ *
+ * \example
+ *
+ * ```code
+ * UC_DEFINE_VECTOR(u32vec, uint32_t)
+ *
+ * u32vec_t *vec = u32vec_create();
+ * u32vec_push_back(vec, 42);
+ * u32vec_sort(vec);
+ * uint32_t *found = u32vec_find(vec, 42);
+ * uc_equal(.container1 = u32vec_container(vec), .container2 = other);
+ * u32vec_delete(&vec);
+ * ```
+ *
+ * For the types which can`t be compared by `<` and `==` operators (structures) use the extended
+ * macros with own comparison macros:
+ *
+ * ```code
+ * #define RECORD_LESS(a, b)  ((a).id < (b).id)
+ * #define RECORD_EQUAL(a, b) ((a).id == (b).id)
+ * UC_DEFINE_LIST_EX(records, record_t, RECORD_LESS, RECORD_EQUAL)
+ * ```
+ *
+ * \date    2023-10-05
+ */
+
+#pragma once
+
+//_____ I N C L U D E S _______________________________________________________
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "common/uc_assert.h"
+#include "core/container.h"
+#include "interface/allocator_if.h"
+//_____ C O N F I G S  ________________________________________________________
+//_____ D E F I N I T I O N S _________________________________________________
+//_____ M A C R O S ___________________________________________________________
+/**
+ * \brief Default comparison macros for the arithmetic types.
+ */
+#define UC_TYPED_LESS(a, b)  ((a) < (b))
+#define UC_TYPED_EQUAL(a, b) ((a) == (b))
+
+/**
+ * \brief Generates typed algorithms over an array of `T`: `<name>_sort_array` and `<name>_find_array`.
+ *
+ * \param NAME prefix of the generated functions.
+ * \param T type of the elements.
+ * \param LESS function-like macro `LESS(a, b)` which returns true if `a` must be placed before `b`.
+ * \param EQUAL function-like macro `EQUAL(a, b)` which returns true if `a` is equal to `b`.
+ */
+#define UC_DEFINE_TYPED_ALGORITHMS(NAME, T, LESS, EQUAL) \
+  static inline void NAME##_sift_down(T *arr, size_t root, size_t size) \
+  { \
+    T value = arr[root]; \
+    size_t child; \
+    while ((child = 2 * root + 1) < size) \
+    { \
+      if (child + 1 < size && LESS(arr[child], arr[child + 1])) \
+      { \
+        child++; \
+      } \
+      if (!LESS(value, arr[child])) \
+      { \
+        break; \
+      } \
+      arr[root] = arr[child]; \
+      root = child; \
+    } \
+    arr[root] = value; \
+  } \
+\
+  /* In-place heap sort: O(N*log(N)) without additional memory */ \
+  static inline void NAME##_sort_array(T *arr, size_t size) \
+  { \
+    if (size < 2) \
+    { \
+      return; \
+    } \
+    for (size_t i = size / 2; i-- > 0;) \
+    { \
+      NAME##_sift_down(arr, i, size); \
+    } \
+    for (size_t last = size - 1; last > 0; last--) \
+    { \
+      T tmp = arr[0]; \
+      arr[0] = arr[last]; \
+      arr[last] = tmp; \
+      NAME##_sift_down(arr, 0, last); \
+    } \
+  } \
+\
+  static inline T *NAME##_find_array(T *arr, size_t size, T value) \
+  { \
+    for (size_t i = 0; i < size; i++) \
+    { \
+      if (EQUAL(arr[i], value)) \
+      { \
+        return &arr[i]; \
+      } \
+    } \
+    return NULL; \
+  }
+
+/**
+ * \brief Generates functions common for all typed containers.
+ */
+#define UC_DEFINE_TYPED_COMMON(NAME, T, TYPE) \
+  typedef struct NAME##_tag NAME##_t; \
+\
+  static inline NAME##_t *NAME##_create(void) \
+  { \
+    return (NAME##_t *)container_create(sizeof(T), TYPE); \
+  } \
+\
+  static inline void NAME##_delete(NAME##_t **self) \
+  { \
+    UC_ASSERT(self); \
+    container_t *container = (container_t *)(*self); \
+    container_delete(&container); \
+    (*self) = NULL; \
+  } \
+\
+  static inline container_t *NAME##_container(NAME##_t *self) \
+  { \
+    return (container_t *)self; \
+  } \
+\
+  static inline size_t NAME##_size(const NAME##_t *self) \
+  { \
+    return container_size((const container_t *)self); \
+  } \
+\
+  static inline bool NAME##_push_back(NAME##_t *self, T value) \
+  { \
+    T *slot = (T *)container_emplace_back((container_t *)self); \
+    if (NULL == slot) \
+    { \
+      return false; \
+    } \
+    *slot = value; \
+    return true; \
+  } \
+\
+  static inline bool NAME##_push_front(NAME##_t *self, T value) \
+  { \
+    T *slot = (T *)container_emplace_front((container_t *)self); \
+    if (NULL == slot) \
+    { \
+      return false; \
+    } \
+    *slot = value; \
+    return true; \
+  } \
+\
+  static inline bool NAME##_pop_front(NAME##_t *self, T *value) \
+  { \
+    UC_ASSERT(value); \
+    T *front = (T *)container_acquire_front((container_t *)self); \
+    if (NULL == front) \
+    { \
+      return false; \
+    } \
+    *value = *front; \
+    return true; \
+  }
+
+/**
+ * \brief Generates vector based container of `T` with user comparison macros.
+ *
+ * Besides the common functions the vector provides O(1) typed access to the elements by index
+ * and typed sort/find running directly over the storage of the container.
+ *
+ * \param NAME prefix of the generated type `<name>_t` and functions.
+ * \param T type of the elements.
+ * \param LESS function-like macro `LESS(a, b)` which returns true if `a` must be placed before `b`.
+ * \param EQUAL function-like macro `EQUAL(a, b)` which returns true if `a` is equal to `b`.
+ */
+#define UC_DEFINE_VECTOR_EX(NAME, T, LESS, EQUAL) \
+  UC_DEFINE_TYPED_COMMON(NAME, T, CONTAINER_VECTOR_BASED) \
+  UC_DEFINE_TYPED_ALGORITHMS(NAME, T, LESS, EQUAL) \
+\
+  static inline NAME##_t *NAME##_from_container(container_t *container) \
+  { \
+    UC_ASSERT(container); \
+    /* The storage is tested by the read-only accessor, so the tracked hash of the container stays valid */ \
+    bool valid = (sizeof(T) == container_esize(container)) && (NULL != container_cdata(container)); \
+    /* The read-only view is contiguous too, but it gives no writable storage */ \
+    valid = valid && (!container_is_view(container) || NULL != container_data(container)); \
+    return (valid) ? (NAME##_t *)container : NULL; \
+  } \
+\
+  static inline T *NAME##_data(NAME##_t *self) \
+  { \
+    return (T *)container_data((container_t *)self); \
+  } \
+\
+  static inline T *NAME##_at(NAME##_t *self, size_t index) \
+  { \
+    return (index < NAME##_size(self)) ? &NAME##_data(self)[index] : NULL; \
+  } \
+\
+  static inline bool NAME##_pop_back(NAME##_t *self, T *value) \
+  { \
+    UC_ASSERT(value); \
+    size_t size = NAME##_size(self); \
+    if (0 == size) \
+    { \
+      return false; \
+    } \
+    *value = NAME##_data(self)[size - 1]; \
+    return container_erase_range((container_t *)self, size - 1, 1); \
+  } \
+\
+  static inline bool NAME##_sort(NAME##_t *self) \
+  { \
+    NAME##_sort_array(NAME##_data(self), NAME##_size(self)); \
+    return true; \
+  } \
+\
+  static inline T *NAME##_find(NAME##_t *self, T value) \
+  { \
+    return NAME##_find_array(NAME##_data(self), NAME##_size(self), value); \
+  }
+
+/**
+ * \brief Generates linked list based container of `T` with user comparison macros.
+ *
+ * The elements are accessed through the container cursors, the sort copies the elements
+ * into a temporary array once, sorts it and writes the elements back.
+ *
+ * \param NAME prefix of the generated type `<name>_t` and functions.
+ * \param T type of the elements.
+ * \param LESS function-like macro `LESS(a, b)` which returns true if `a` must be placed before `b`.
+ * \param EQUAL function-like macro `EQUAL(a, b)` which returns true if `a` is equal to `b`.
+ */
+#define UC_DEFINE_LIST_EX(NAME, T, LESS, EQUAL) \
+  UC_DEFINE_TYPED_COMMON(NAME, T, CONTAINER_LINKED_LIST_BASED) \
+  UC_DEFINE_TYPED_ALGORITHMS(NAME, T, LESS, EQUAL) \
+\
+  static inline NAME##_t *NAME##_from_container(container_t *container) \
+  { \
+    UC_ASSERT(container); \
+    return (sizeof(T) == container_esize(container)) ? (NAME##_t *)container : NULL; \
+  } \
+\
+  static inline T *NAME##_at(NAME##_t *self, size_t index) \
+  { \
+    container_cursor_t cursor = container_cursor((container_t *)self, index); \
+    return (T *)container_cursor_data(&cursor); \
+  } \
+\
+  static inline bool NAME##_pop_back(NAME##_t *self, T *value) \
+  { \
+    UC_ASSERT(value); \
+    return container_pop_back((container_t *)self, value); \
+  } \
+\
+  static inline bool NAME##_sort(NAME##_t *self) \
+  { \
+    size_t size = NAME##_size(self); \
+    if (size < 2) \
+    { \
+      return true; \
+    } \
+    allocate_fn_t mem_allocate = get_allocator(); \
+    free_fn_t mem_free = get_free(); \
+    T *arr = (T *)mem_allocate(size * sizeof(T)); \
+    if (NULL == arr) \
+    { \
+      return false; \
+    } \
+    size_t i = 0; \
+    container_cursor_t cursor = container_cursor((container_t *)self, 0); \
+    for (; container_cursor_valid(&cursor); container_cursor_next(&cursor)) \
+    { \
+      arr[i++] = *(T *)container_cursor_data(&cursor); \
+    } \
+    NAME##_sort_array(arr, size); \
+    i = 0; \
+    cursor = container_cursor((container_t *)self, 0); \
+    for (; container_cursor_valid(&cursor); container_cursor_next(&cursor)) \
+    { \
+      *(T *)container_cursor_data(&cursor) = arr[i++]; \
+    } \
+    mem_free(arr); \
+    return true; \
+  } \
+\
+  static inline T *NAME##_find(NAME##_t *self, T value) \
+  { \
+    container_cursor_t cursor = container_cursor((container_t *)self, 0); \
+    for (; container_cursor_valid(&cursor); container_cursor_next(&cursor)) \
+    { \
+      T *data = (T *)container_cursor_data(&cursor); \
+      if (EQUAL(*data, value)) \
+      { \
+        return data; \
+      } \
+    } \
+    return NULL; \
+  }
+
+/**
+ * \brief Generates vector/linked list based container of arithmetic type `T` compared by `<` and `==` operators.
+ */
+#define UC_DEFINE_VECTOR(NAME, T) UC_DEFINE_VECTOR_EX(NAME, T, UC_TYPED_LESS, UC_TYPED_EQUAL)
+#define UC_DEFINE_LIST(NAME, T)   UC_DEFINE_LIST_EX(NAME, T, UC_TYPED_LESS, UC_TYPED_EQUAL)
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P U B L I C  F U N C T I O N S_________________________________________
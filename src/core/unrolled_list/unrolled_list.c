@@ -0,0 +1,1199 @@
+/**
+ * \file unrolled_list.c
+ * \author Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * \brief Unrolled linked list: double-linked list of the chunks with a small array of the elements.
+ * \date 2023-10-17
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "unrolled_list.h"
+
+#include "common/uc_assert.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "interface/allocator_if.h"
+//_____ C O N F I G S  ________________________________________________________
+/**
+ * \brief Size of the cache line and the number of the cache lines taken by the elements of the chunk.
+ */
+#define CACHE_LINE  64
+#define CHUNK_LINES 4
+
+/**
+ * \brief Minimal number of the elements in the chunk (for the large elements).
+ */
+#define MIN_CHUNK_CAPACITY 4
+//_____ D E F I N I T I O N S _________________________________________________
+typedef struct _Chunk_tag
+{
+  struct _Chunk_tag *next;
+  struct _Chunk_tag *prev;
+  size_t count;  /// Number of the elements in the chunk
+  uint8_t *data; /// Elements of the chunk stored right after the header
+} chunk_t;
+
+/*
+ * The position of the cursor is the pointer to the element. The chunk of the last position given out is kept
+ * in `hint`, so the walk of the cursor finds the chunk of the position in O(1).
+ */
+struct Private_tag
+{
+  size_t esize;     /// Single element size
+  size_t size;      /// Number of the elements
+  size_t capacity;  /// Maximal number of the elements in the chunk
+  chunk_t *head;
+  chunk_t *tail;
+  chunk_t *hint;    /// Chunk of the last position given out to the cursor
+  uint8_t *scratch; /// Buffer of a single element: the element acquired from the front and the swaps
+};
+//_____ M A C R O S ___________________________________________________________
+/// Size of the chunk header rounded up, so the elements stored right after the header are aligned for any type
+#define CHUNK_HEADER_SIZE (((sizeof(chunk_t) + _Alignof(max_align_t) - 1) / _Alignof(max_align_t)) * _Alignof(max_align_t))
+
+/// Private data of the list
+#define PRIVATE(list) (((unrolled_list_t *)(list))->private)
+
+/// Pointer to the element with the index `i` of the chunk
+#define AT(list, chunk, i) ((chunk)->data + (i) * (list)->esize)
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+static inline size_t min_size(size_t a, size_t b)
+{
+  return (a < b) ? a : b;
+}
+
+static chunk_t *chunk_allocate(const private_t *list)
+{
+  allocate_fn_t mem_allocate = get_allocator();
+  UC_ASSERT(mem_allocate);
+
+  chunk_t *chunk = (chunk_t *)mem_allocate(CHUNK_HEADER_SIZE + list->capacity * list->esize);
+  if (NULL == chunk)
+  {
+    return NULL;
+  }
+
+  chunk->next = NULL;
+  chunk->prev = NULL;
+  chunk->count = 0;
+  chunk->data = (uint8_t *)chunk + CHUNK_HEADER_SIZE;
+
+  return chunk;
+}
+
+static void chunk_free(private_t *list, chunk_t *chunk)
+{
+  free_fn_t mem_free = get_free();
+  UC_ASSERT(mem_free);
+
+  if (list->hint == chunk)
+  {
+    list->hint = NULL;
+  }
+
+  mem_free(chunk);
+}
+
+static void chain_free(private_t *list, chunk_t *first)
+{
+  while (first)
+  {
+    chunk_t *next = first->next;
+    chunk_free(list, first);
+    first = next;
+  }
+}
+
+/* The chain [first, last] is linked after the chunk or at the front of the list if the chunk is NULL */
+static void link_chain(private_t *list, chunk_t *after, chunk_t *first, chunk_t *last)
+{
+  chunk_t *before = (after) ? after->next : list->head;
+
+  first->prev = after;
+  last->next = before;
+
+  if (after)
+  {
+    after->next = first;
+  }
+  else
+  {
+    list->head = first;
+  }
+
+  if (before)
+  {
+    before->prev = last;
+  }
+  else
+  {
+    list->tail = last;
+  }
+}
+
+static void unlink_chunk(private_t *list, chunk_t *chunk)
+{
+  if (chunk->prev)
+  {
+    chunk->prev->next = chunk->next;
+  }
+  else
+  {
+    list->head = chunk->next;
+  }
+
+  if (chunk->next)
+  {
+    chunk->next->prev = chunk->prev;
+  }
+  else
+  {
+    list->tail = chunk->prev;
+  }
+}
+
+/* The chunks are walked from the nearest end of the list */
+static chunk_t *locate(const private_t *list, size_t index, size_t *offset)
+{
+  UC_ASSERT(index < list->size);
+
+  chunk_t *chunk = NULL;
+
+  if (index < list->size / 2)
+  {
+    chunk = list->head;
+    while (index >= chunk->count)
+    {
+      index -= chunk->count;
+      chunk = chunk->next;
+    }
+    *offset = index;
+  }
+  else
+  {
+    size_t remaining = list->size - index;
+    chunk = list->tail;
+    while (remaining > chunk->count)
+    {
+      remaining -= chunk->count;
+      chunk = chunk->prev;
+    }
+    *offset = chunk->count - remaining;
+  }
+
+  return chunk;
+}
+
+/* The position from the chunk of the hint or from its neighbours is found in O(1), any other one by the walk */
+static chunk_t *chunk_of(private_t *list, const uint8_t *position)
+{
+  chunk_t *hint = list->hint;
+  chunk_t *candidates[3] = {hint, (hint) ? hint->next : NULL, (hint) ? hint->prev : NULL};
+
+  for (size_t i = 0; i < 3; i++)
+  {
+    chunk_t *chunk = candidates[i];
+    if (chunk && position >= chunk->data && position < AT(list, chunk, chunk->count))
+    {
+      list->hint = chunk;
+      return chunk;
+    }
+  }
+
+  for (chunk_t *chunk = list->head; chunk; chunk = chunk->next)
+  {
+    if (position >= chunk->data && position < AT(list, chunk, chunk->count))
+    {
+      list->hint = chunk;
+      return chunk;
+    }
+  }
+
+  UC_ASSERT(false);
+  return NULL;
+}
+
+static inline void *position_at(private_t *list, chunk_t *chunk, size_t offset)
+{
+  if (chunk && offset >= chunk->count)
+  {
+    chunk = chunk->next;
+    offset = 0;
+  }
+
+  list->hint = chunk;
+
+  return (chunk) ? AT(list, chunk, offset) : NULL;
+}
+
+/* The elements [at, count) of the chunk are moved into the new chunk linked after it */
+static void split(private_t *list, chunk_t *chunk, size_t at, chunk_t *spare)
+{
+  spare->count = chunk->count - at;
+  memcpy(spare->data, AT(list, chunk, at), spare->count * list->esize);
+  chunk->count = at;
+
+  link_chain(list, chunk, spare, spare);
+}
+
+/* The next chunk is appended to the chunk if the elements of both fit into one chunk */
+static bool merge_next(private_t *list, chunk_t *chunk)
+{
+  chunk_t *next = chunk->next;
+  if (NULL == next || chunk->count + next->count > list->capacity)
+  {
+    return false;
+  }
+
+  memcpy(AT(list, chunk, chunk->count), next->data, next->count * list->esize);
+  chunk->count += next->count;
+
+  unlink_chunk(list, next);
+  chunk_free(list, next);
+
+  return true;
+}
+
+/*
+ * The slot is made in the chunk of the index. The full chunk is split in halves or, at its ends,
+ * the new chunk is linked before or after it, so the pushes to the ends fill the chunks completely.
+ */
+static void *emplace_at(private_t *list, size_t index)
+{
+  chunk_t *chunk = NULL;
+  size_t offset = 0;
+
+  if (index > list->size)
+  {
+    return NULL;
+  }
+
+  if (index == list->size)
+  {
+    chunk = list->tail;
+    offset = (chunk) ? chunk->count : 0;
+  }
+  else
+  {
+    chunk = locate(list, index, &offset);
+    if (0 == offset && chunk->prev && chunk->prev->count < list->capacity)
+    {
+      chunk = chunk->prev;
+      offset = chunk->count;
+    }
+  }
+
+  if (NULL == chunk || chunk->count == list->capacity)
+  {
+    chunk_t *spare = chunk_allocate(list);
+    if (NULL == spare)
+    {
+      return NULL;
+    }
+
+    if (NULL == chunk || offset == chunk->count)
+    {
+      link_chain(list, chunk, spare, spare);
+      chunk = spare;
+      offset = 0;
+    }
+    else if (0 == offset)
+    {
+      link_chain(list, chunk->prev, spare, spare);
+      chunk = spare;
+    }
+    else
+    {
+      size_t half = chunk->count / 2;
+      split(list, chunk, half, spare);
+      if (offset > half)
+      {
+        chunk = spare;
+        offset -= half;
+      }
+    }
+  }
+
+  memmove(AT(list, chunk, offset + 1), AT(list, chunk, offset), (chunk->count - offset) * list->esize);
+  chunk->count++;
+  list->size++;
+
+  return AT(list, chunk, offset);
+}
+
+/*
+ * The element is removed by the move of the elements of its chunk. The chunk which is less than half full
+ * takes the elements of the next chunk if they fit, so the elements before the erased one stay in place
+ * and the pointers to them kept by the walk through the list are still valid. Returns the position of the next element.
+ */
+static void *erase_at(private_t *list, chunk_t *chunk, size_t offset)
+{
+  memmove(AT(list, chunk, offset), AT(list, chunk, offset + 1), (chunk->count - offset - 1) * list->esize);
+  chunk->count--;
+  list->size--;
+
+  if (0 == chunk->count)
+  {
+    chunk_t *next = chunk->next;
+    unlink_chunk(list, chunk);
+    chunk_free(list, chunk);
+    return position_at(list, next, 0);
+  }
+
+  if (chunk->count < list->capacity / 2)
+  {
+    merge_next(list, chunk);
+  }
+
+  return position_at(list, chunk, offset);
+}
+
+static bool resize_cb(void *list, size_t new_size)
+{
+  UC_ASSERT(list);
+  (void)new_size;
+
+  //\warning: The chunks are allocated on demand, nothing to reserve
+  return true;
+}
+
+static bool push_front_cb(void *list, const void *data)
+{
+  UC_ASSERT(list);
+  UC_ASSERT(data);
+
+  private_t *_list = PRIVATE(list);
+
+  void *slot = emplace_at(_list, 0);
+  if (NULL == slot)
+  {
+    return false;
+  }
+
+  memcpy(slot, data, _list->esize);
+
+  return true;
+}
+
+static bool pop_front_cb(void *list, void *data)
+{
+  UC_ASSERT(list);
+  UC_ASSERT(data);
+
+  private_t *_list = PRIVATE(list);
+
+  if (0 == _list->size)
+  {
+    return false;
+  }
+
+  memcpy(data, _list->head->data, _list->esize);
+  erase_at(_list, _list->head, 0);
+
+  return true;
+}
+
+static bool push_back_cb(void *list, const void *data)
+{
+  UC_ASSERT(list);
+  UC_ASSERT(data);
+
+  private_t *_list = PRIVATE(list);
+
+  void *slot = emplace_at(_list, _list->size);
+  if (NULL == slot)
+  {
+    return false;
+  }
+
+  memcpy(slot, data, _list->esize);
+
+  return true;
+}
+
+static bool pop_back_cb(void *list, void *data)
+{
+  UC_ASSERT(list);
+  UC_ASSERT(data);
+
+  private_t *_list = PRIVATE(list);
+
+  if (0 == _list->size)
+  {
+    return false;
+  }
+
+  chunk_t *tail = _list->tail;
+  memcpy(data, AT(_list, tail, tail->count - 1), _list->esize);
+  erase_at(_list, tail, tail->count - 1);
+
+  return true;
+}
+
+static bool insert_cb(void *list, const void *data, size_t index)
+{
+  UC_ASSERT(list);
+  UC_ASSERT(data);
+
+  private_t *_list = PRIVATE(list);
+
+  void *slot = emplace_at(_list, index);
+  if (NULL == slot)
+  {
+    return false;
+  }
+
+  memcpy(slot, data, _list->esize);
+
+  return true;
+}
+
+static bool insert_range_cb(void *list, const void *data, size_t index, size_t count)
+{
+  UC_ASSERT(list);
+  UC_ASSERT(data);
+
+  private_t *_list = PRIVATE(list);
+  const uint8_t *src = (const uint8_t *)data;
+
+  if (index > _list->size)
+  {
+    return false;
+  }
+
+  if (0 == count)
+  {
+    return true;
+  }
+
+  chunk_t *chunk = _list->tail;
+  size_t offset = (chunk) ? chunk->count : 0;
+  if (index < _list->size)
+  {
+    chunk = locate(_list, index, &offset);
+  }
+
+  // The range which fits into the chunk is inserted in place
+  if (chunk && chunk->count + count <= _list->capacity)
+  {
+    memmove(AT(_list, chunk, offset + count), AT(_list, chunk, offset), (chunk->count - offset) * _list->esize);
+    memcpy(AT(_list, chunk, offset), src, count * _list->esize);
+    chunk->count += count;
+    _list->size += count;
+    return true;
+  }
+
+  // Build the whole chain of the full chunks first, so the list stays untouched if any allocation fails
+  bool divide = (chunk && 0 != offset && offset != chunk->count);
+  chunk_t *spare = (divide) ? chunk_allocate(_list) : NULL;
+  chunk_t *first = NULL;
+  chunk_t *last = NULL;
+
+  for (size_t done = 0; done < count;)
+  {
+    chunk_t *tmp = chunk_allocate(_list);
+    if (NULL == tmp || (divide && NULL == spare))
+    {
+      if (tmp)
+      {
+        chunk_free(_list, tmp);
+      }
+      if (spare)
+      {
+        chunk_free(_list, spare);
+      }
+      chain_free(_list, first);
+      return false;
+    }
+
+    tmp->count = min_size(count - done, _list->capacity);
+    memcpy(tmp->data, &src[done * _list->esize], tmp->count * _list->esize);
+    done += tmp->count;
+
+    tmp->prev = last;
+    if (last)
+    {
+      last->next = tmp;
+    }
+    else
+    {
+      first = tmp;
+    }
+    last = tmp;
+  }
+
+  chunk_t *after = chunk;
+  if (divide)
+  {
+    split(_list, chunk, offset, spare);
+  }
+  else if (chunk && 0 == offset)
+  {
+    after = chunk->prev;
+  }
+
+  link_chain(_list, after, first, last);
+  _list->size += count;
+
+  // The chunks at the edges of the range are joined with their neighbours if they fit together
+  merge_next(_list, last);
+  if (after)
+  {
+    merge_next(_list, after);
+  }
+
+  return true;
+}
+
+static bool splice_cb(void *list, size_t index, void *other)
+{
+  UC_ASSERT(list);
+  UC_ASSERT(other);
+
+  private_t *_list = PRIVATE(list);
+  private_t *source = PRIVATE(other);
+
+  if (index > _list->size || _list->esize != source->esize)
+  {
+    return false;
+  }
+
+  if (0 == source->size)
+  {
+    return true;
+  }
+
+  chunk_t *after = _list->tail;
+  if (index < _list->size)
+  {
+    size_t offset = 0;
+    chunk_t *chunk = locate(_list, index, &offset);
+    after = chunk->prev;
+
+    if (0 != offset)
+    {
+      chunk_t *spare = chunk_allocate(_list);
+      if (NULL == spare)
+      {
+        return false;
+      }
+
+      split(_list, chunk, offset, spare);
+      after = chunk;
+    }
+  }
+
+  // Move the whole chain of chunks, no element is copied
+  chunk_t *last = source->tail;
+  link_chain(_list, after, source->head, last);
+  _list->size += source->size;
+
+  source->head = source->tail = source->hint = NULL;
+  source->size = 0;
+
+  merge_next(_list, last);
+  if (after)
+  {
+    merge_next(_list, after);
+  }
+
+  return true;
+}
+
+static bool copy_cb(void *list, const void *other, void (*copy)(void *dst, const void *src, size_t esize))
+{
+  UC_ASSERT(list);
+  UC_ASSERT(other);
+
+  private_t *_list = PRIVATE(list);
+  const private_t *source = PRIVATE(other);
+  size_t esize = source->esize;
+
+  if (0 != _list->size || _list->esize != esize)
+  {
+    return false;
+  }
+
+  if (0 == source->size)
+  {
+    return true;
+  }
+
+  // Build the whole chain of full chunks first, so the list stays empty if any allocation fails
+  chunk_t *first = NULL;
+  chunk_t *last = NULL;
+  for (size_t done = 0; done < source->size; done += _list->capacity)
+  {
+    chunk_t *tmp = chunk_allocate(_list);
+    if (NULL == tmp)
+    {
+      chain_free(_list, first);
+      return false;
+    }
+
+    tmp->count = min_size(source->size - done, _list->capacity);
+    tmp->prev = last;
+    if (last)
+    {
+      last->next = tmp;
+    }
+    else
+    {
+      first = tmp;
+    }
+    last = tmp;
+  }
+
+  // Copy elements only when all chunks are allocated, so the deep copy callback is never called in vain
+  chunk_t *dst = first;
+  size_t index = 0;
+  for (chunk_t *src = source->head; src; src = src->next)
+  {
+    for (size_t i = 0; i < src->count; i++)
+    {
+      if (index == dst->count)
+      {
+        dst = dst->next;
+        index = 0;
+      }
+
+      if (copy)
+      {
+        copy(AT(_list, dst, index), AT(source, src, i), esize);
+      }
+      else
+      {
+        memcpy(AT(_list, dst, index), AT(source, src, i), esize);
+      }
+      index++;
+    }
+  }
+
+  link_chain(_list, NULL, first, last);
+  _list->size = source->size;
+
+  return true;
+}
+
+static void *emplace_cb(void *list, size_t index)
+{
+  UC_ASSERT(list);
+
+  return emplace_at(PRIVATE(list), index);
+}
+
+static void *acquire_front_cb(void *list)
+{
+  UC_ASSERT(list);
+
+  private_t *_list = PRIVATE(list);
+
+  if (0 == _list->size)
+  {
+    return NULL;
+  }
+
+  // The element is moved by the erasure, so its copy is returned instead
+  memcpy(_list->scratch, _list->head->data, _list->esize);
+  erase_at(_list, _list->head, 0);
+
+  return _list->scratch;
+}
+
+static bool at_cb(const void *list, void *data, size_t index)
+{
+  UC_ASSERT(list);
+  UC_ASSERT(data);
+
+  private_t *_list = PRIVATE(list);
+
+  if (index >= _list->size)
+  {
+    return false;
+  }
+
+  size_t offset = 0;
+  chunk_t *chunk = locate(_list, index, &offset);
+  memcpy(data, AT(_list, chunk, offset), _list->esize);
+
+  return true;
+}
+
+static bool erase_cb(void *list, size_t index)
+{
+  UC_ASSERT(list);
+
+  private_t *_list = PRIVATE(list);
+
+  if (index >= _list->size)
+  {
+    return false;
+  }
+
+  size_t offset = 0;
+  chunk_t *chunk = locate(_list, index, &offset);
+  erase_at(_list, chunk, offset);
+
+  return true;
+}
+
+static bool extract_cb(void *list, void *data, size_t index)
+{
+  UC_ASSERT(list);
+  UC_ASSERT(data);
+
+  if (!at_cb(list, data, index))
+  {
+    return false;
+  }
+
+  return erase_cb(list, index);
+}
+
+static bool extract_range_cb(void *list, void *data, size_t index, size_t count)
+{
+  UC_ASSERT(list);
+
+  private_t *_list = PRIVATE(list);
+
+  if (index > _list->size || count > (_list->size - index))
+  {
+    return false;
+  }
+
+  if (0 == count)
+  {
+    return true;
+  }
+
+  size_t offset = 0;
+  chunk_t *chunk = locate(_list, index, &offset);
+  chunk_t *before = (0 == offset) ? chunk->prev : chunk;
+
+  // Copy the elements and drop them chunk by chunk
+  uint8_t *dst = (uint8_t *)data;
+  for (size_t remaining = count; 0 != remaining; offset = 0)
+  {
+    size_t taken = min_size(remaining, chunk->count - offset);
+    if (NULL != dst)
+    {
+      memcpy(dst, AT(_list, chunk, offset), taken * _list->esize);
+      dst += taken * _list->esize;
+    }
+
+    memmove(AT(_list, chunk, offset), AT(_list, chunk, offset + taken), (chunk->count - offset - taken) * _list->esize);
+    chunk->count -= taken;
+    remaining -= taken;
+
+    chunk_t *next = chunk->next;
+    if (0 == chunk->count)
+    {
+      unlink_chunk(_list, chunk);
+      chunk_free(_list, chunk);
+    }
+    chunk = next;
+  }
+
+  _list->size -= count;
+
+  // The chunks around the removed range are joined if they fit together
+  if (before)
+  {
+    merge_next(_list, before);
+  }
+
+  return true;
+}
+
+static bool replace_cb(void *list, const void *data, size_t index)
+{
+  UC_ASSERT(list);
+  UC_ASSERT(data);
+
+  private_t *_list = PRIVATE(list);
+
+  if (index >= _list->size)
+  {
+    return false;
+  }
+
+  size_t offset = 0;
+  chunk_t *chunk = locate(_list, index, &offset);
+  memcpy(AT(_list, chunk, offset), data, _list->esize);
+
+  return true;
+}
+
+static size_t erase_if_cb(void *list, bool (*predicate)(const void *data, size_t esize))
+{
+  UC_ASSERT(list);
+  UC_ASSERT(predicate);
+
+  private_t *_list = PRIVATE(list);
+  size_t erased = 0;
+
+  // The kept elements are compacted inside of every chunk, the empty chunks are released
+  chunk_t *chunk = _list->head;
+  while (chunk)
+  {
+    chunk_t *next = chunk->next;
+    size_t kept = 0;
+
+    for (size_t i = 0; i < chunk->count; i++)
+    {
+      if (predicate(AT(_list, chunk, i), _list->esize))
+      {
+        continue;
+      }
+
+      if (kept != i)
+      {
+        memcpy(AT(_list, chunk, kept), AT(_list, chunk, i), _list->esize);
+      }
+      kept++;
+    }
+
+    erased += chunk->count - kept;
+    chunk->count = kept;
+
+    if (0 == kept)
+    {
+      unlink_chunk(_list, chunk);
+      chunk_free(_list, chunk);
+    }
+    chunk = next;
+  }
+
+  _list->size -= erased;
+
+  // The neighbour chunks which fit together are joined
+  for (chunk = _list->head; chunk;)
+  {
+    if (!merge_next(_list, chunk))
+    {
+      chunk = chunk->next;
+    }
+  }
+
+  return erased;
+}
+
+static void *peek_cb(void *list, size_t index)
+{
+  UC_ASSERT(list);
+
+  private_t *_list = PRIVATE(list);
+
+  if (index >= _list->size)
+  {
+    return NULL;
+  }
+
+  size_t offset = 0;
+  chunk_t *chunk = locate(_list, index, &offset);
+
+  return AT(_list, chunk, offset);
+}
+
+static void *data_cb(const void *list)
+{
+  UC_ASSERT(list);
+
+  //\warning: The unrolled list core struct doesn`t store the elements contiguously
+  return NULL;
+}
+
+static void *cursor_cb(const void *list, size_t index)
+{
+  UC_ASSERT(list);
+
+  private_t *_list = PRIVATE(list);
+
+  if (index >= _list->size)
+  {
+    return NULL;
+  }
+
+  size_t offset = 0;
+  chunk_t *chunk = locate(_list, index, &offset);
+
+  return position_at(_list, chunk, offset);
+}
+
+static void *cursor_next_cb(const void *list, void *position)
+{
+  UC_ASSERT(list);
+  UC_ASSERT(position);
+
+  private_t *_list = PRIVATE(list);
+  uint8_t *next = (uint8_t *)position + _list->esize;
+
+  // The step inside of the chunk of the hint doesn`t look for the chunk
+  chunk_t *hint = _list->hint;
+  if (hint && (uint8_t *)position >= hint->data && next < AT(_list, hint, hint->count))
+  {
+    return next;
+  }
+
+  chunk_t *chunk = chunk_of(_list, (const uint8_t *)position);
+  return position_at(_list, chunk, (size_t)(next - chunk->data) / _list->esize);
+}
+
+static void *cursor_data_cb(const void *list, void *position)
+{
+  UC_ASSERT(list);
+  UC_ASSERT(position);
+
+  return position;
+}
+
+static void *erase_cursor_cb(void *list, void *position)
+{
+  UC_ASSERT(list);
+  UC_ASSERT(position);
+
+  private_t *_list = PRIVATE(list);
+  chunk_t *chunk = chunk_of(_list, (const uint8_t *)position);
+
+  return erase_at(_list, chunk, (size_t)((uint8_t *)position - chunk->data) / _list->esize);
+}
+
+static bool reverse_cb(void *list)
+{
+  UC_ASSERT(list);
+
+  private_t *_list = PRIVATE(list);
+
+  // The links of the chunks are flipped and the elements are reversed inside of every chunk
+  chunk_t *chunk = _list->head;
+  while (chunk)
+  {
+    for (size_t i = 0, j = chunk->count - 1; i < j; i++, j--)
+    {
+      memcpy(_list->scratch, AT(_list, chunk, i), _list->esize);
+      memcpy(AT(_list, chunk, i), AT(_list, chunk, j), _list->esize);
+      memcpy(AT(_list, chunk, j), _list->scratch, _list->esize);
+    }
+
+    chunk_t *next = chunk->next;
+    chunk->next = chunk->prev;
+    chunk->prev = next;
+    chunk = next;
+  }
+
+  chunk = _list->head;
+  _list->head = _list->tail;
+  _list->tail = chunk;
+
+  return true;
+}
+
+static bool rotate_cb(void *list, size_t count)
+{
+  UC_ASSERT(list);
+
+  private_t *_list = PRIVATE(list);
+  size_t size = _list->size;
+
+  if (size < 2 || 0 == (count %= size))
+  {
+    return true;
+  }
+
+  size_t offset = 0;
+  chunk_t *head = locate(_list, count, &offset);
+
+  // The chunk of the new first element is split, so the list is only relinked as a ring of chunks
+  if (0 != offset)
+  {
+    chunk_t *spare = chunk_allocate(_list);
+    if (NULL == spare)
+    {
+      return false;
+    }
+
+    split(_list, head, offset, spare);
+    head = spare;
+  }
+
+  chunk_t *tail = head->prev;
+  chunk_t *seam = _list->tail;
+
+  _list->tail->next = _list->head;
+  _list->head->prev = _list->tail;
+  tail->next = NULL;
+  head->prev = NULL;
+
+  _list->head = head;
+  _list->tail = tail;
+
+  merge_next(_list, seam);
+
+  return true;
+}
+
+static bool fill_cb(void *list, size_t first, size_t count, const void *data)
+{
+  UC_ASSERT(list);
+  UC_ASSERT(data);
+
+  private_t *_list = PRIVATE(list);
+
+  if (first > _list->size || count > _list->size - first)
+  {
+    return false;
+  }
+
+  if (0 == count)
+  {
+    return true;
+  }
+
+  size_t offset = 0;
+  chunk_t *chunk = locate(_list, first, &offset);
+  for (size_t i = 0; i < count; i++, offset++)
+  {
+    if (offset == chunk->count)
+    {
+      chunk = chunk->next;
+      offset = 0;
+    }
+
+    memcpy(AT(_list, chunk, offset), data, _list->esize);
+  }
+
+  return true;
+}
+
+static bool clear_cb(void *list)
+{
+  UC_ASSERT(list);
+
+  private_t *_list = PRIVATE(list);
+
+  chain_free(_list, _list->head);
+
+  _list->head = _list->tail = _list->hint = NULL;
+  _list->size = 0;
+
+  return true;
+}
+
+static size_t size_cb(const void *list)
+{
+  UC_ASSERT(list);
+
+  return PRIVATE(list)->size;
+}
+
+static size_t esize_cb(const void *list)
+{
+  UC_ASSERT(list);
+
+  return PRIVATE(list)->esize;
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * \brief Creates a new unrolled list with a specified element size.
+ *
+ * Detailed description see in unrolled_list.h
+ */
+unrolled_list_t *unrolled_list_create(size_t esize)
+{
+  UC_ASSERT(0 != esize);
+
+  if (!is_allocator_valid())
+  {
+    return NULL;
+  }
+
+  allocate_fn_t mem_allocate = get_allocator();
+  free_fn_t mem_free = get_free();
+
+  unrolled_list_t *unrolled_list = (unrolled_list_t *)mem_allocate(sizeof *unrolled_list);
+  if (NULL == unrolled_list)
+  {
+    return NULL;
+  }
+
+  private_t *_list = (private_t *)mem_allocate(sizeof(private_t));
+  uint8_t *scratch = (uint8_t *)mem_allocate(esize);
+  if (NULL == _list || NULL == scratch)
+  {
+    if (_list)
+    {
+      mem_free(_list);
+    }
+    if (scratch)
+    {
+      mem_free(scratch);
+    }
+    mem_free(unrolled_list);
+    return NULL;
+  }
+
+  size_t capacity = CHUNK_LINES * CACHE_LINE / esize;
+
+  _list->esize = esize;
+  _list->size = 0;
+  _list->capacity = (capacity < MIN_CHUNK_CAPACITY) ? MIN_CHUNK_CAPACITY : capacity;
+  _list->head = _list->tail = _list->hint = NULL;
+  _list->scratch = scratch;
+  unrolled_list->private = _list;
+
+  unrolled_list->resize = resize_cb;
+  unrolled_list->push_front = push_front_cb;
+  unrolled_list->pop_front = pop_front_cb;
+  unrolled_list->push_back = push_back_cb;
+  unrolled_list->pop_back = pop_back_cb;
+  unrolled_list->insert = insert_cb;
+  unrolled_list->extract = extract_cb;
+  unrolled_list->replace = replace_cb;
+  unrolled_list->at = at_cb;
+  unrolled_list->erase = erase_cb;
+  unrolled_list->peek = peek_cb;
+  unrolled_list->clear = clear_cb;
+  unrolled_list->size = size_cb;
+  unrolled_list->esize = esize_cb;
+  unrolled_list->emplace = emplace_cb;
+  unrolled_list->acquire_front = acquire_front_cb;
+  unrolled_list->extract_range = extract_range_cb;
+  unrolled_list->insert_range = insert_range_cb;
+  unrolled_list->erase_if = erase_if_cb;
+  unrolled_list->erase_unordered = erase_cb;
+  unrolled_list->cursor = cursor_cb;
+  unrolled_list->cursor_next = cursor_next_cb;
+  unrolled_list->cursor_data = cursor_data_cb;
+  unrolled_list->erase_cursor = erase_cursor_cb;
+  unrolled_list->splice = splice_cb;
+  unrolled_list->copy = copy_cb;
+  unrolled_list->data = data_cb;
+  unrolled_list->reverse = reverse_cb;
+  unrolled_list->rotate = rotate_cb;
+  unrolled_list->fill = fill_cb;
+
+  return unrolled_list;
+}
+
+/**
+ * \brief Frees up the memory associated with the unrolled list.
+ *
+ * Detailed description see in unrolled_list.h
+ */
+void unrolled_list_delete(unrolled_list_t **list)
+{
+  UC_ASSERT(list);
+  UC_ASSERT(*list);
+
+  free_fn_t mem_free = get_free();
+  private_t *_list = (*list)->private;
+
+  chain_free(_list, _list->head);
+  mem_free(_list->scratch);
+  mem_free(_list);
+  mem_free(*list);
+  (*list) = NULL;
+}
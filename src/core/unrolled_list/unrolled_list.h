@@ -0,0 +1,88 @@
+/**
+ * \file unrolled_list.h
+ * \author Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * \brief Unrolled linked list data structure and associated function pointers.
+ *
+ *  The unrolled list is a double-linked list of chunks, every chunk stores a small array of the elements
+ *  which takes a few cache lines. The elements of the chunk are walked without the pointer chasing
+ *  and the list takes less memory than the linked list with a node per element.
+ *  The ends of the list are changed in O(1), the element in the middle is found by the walk through
+ *  the chunks and is inserted or erased by the move of the elements of a single chunk.
+ * \date 2023-10-17
+ */
+
+#pragma once
+
+//_____ I N C L U D E S _______________________________________________________
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+//_____ C O N F I G S  ________________________________________________________
+//_____ D E F I N I T I O N S _________________________________________________
+struct Private_tag;
+typedef struct Private_tag private_t;
+
+/**
+ *  \brief Unrolled linked list data structure.
+ *
+ *  This structure has the same function table as the linked list and the vector.
+ */
+typedef struct
+{
+  private_t *private; /**< Private data, internal to the implementation. */
+
+  struct
+  {
+    bool (*resize)(void *this, size_t new_size);                 /**< Does nothing, the chunks are allocated on demand. */
+    bool (*push_front)(void *this, const void *data);            /**< Adds an element to the front of the list. */
+    bool (*pop_front)(void *this, void *data);                   /**< Removes an element from the front of the list. */
+    bool (*push_back)(void *this, const void *data);             /**< Adds an element to the back of the list. */
+    bool (*pop_back)(void *this, void *data);                    /**< Removes an element from the back of the list. */
+    bool (*insert)(void *this, const void *data, size_t index);  /**< Inserts an element at the specified index. */
+    bool (*extract)(void *this, void *data, size_t index);       /**< Extracts an element from the specified index. */
+    bool (*replace)(void *this, const void *data, size_t index); /**< Replaces an element at the specified index. */
+    bool (*at)(const void *this, void *data, size_t index);      /**< Retrieves an element at the specified index. */
+    bool (*erase)(void *this, size_t index);                     /**< Removes an element at the specified index. */
+    void *(*peek)(void *this, size_t index); /**< Retrieves a pointer to an element at the specified index. */
+    bool (*clear)(void *this);               /**< Clears all elements from the list. */
+    size_t (*size)(const void *this);        /**< Returns the number of elements in the list. */
+    size_t (*esize)(const void *this);       /**< Get the size of single element (in bytes). */
+    void *(*emplace)(void *this, size_t index); /**< Reserves a slot at the specified index and returns a pointer to it. */
+    void *(*acquire_front)(void *this);         /**< Removes the front element and returns a pointer to its copy. */
+    bool (*extract_range)(void *this, void *data, size_t index, size_t count); /**< Extracts (or drops) a range of elements. */
+    bool (*insert_range)(void *this, const void *data, size_t index, size_t count); /**< Inserts an array of elements. */
+    size_t (*erase_if)(void *this, bool (*predicate)(const void *data, size_t esize)); /**< Removes matching elements. */
+    bool (*erase_unordered)(void *this, size_t index);      /**< Removes an element, the order is kept. */
+    void *(*cursor)(const void *this, size_t index);        /**< Returns a position (element) at the index. */
+    void *(*cursor_next)(const void *this, void *position); /**< Returns a position of the next element. */
+    void *(*cursor_data)(const void *this, void *position); /**< Returns a pointer to the element at the position. */
+    void *(*erase_cursor)(void *this, void *position);      /**< Removes the element at the position. */
+    bool (*splice)(void *this, size_t index, void *other);  /**< Moves all chunks of other list at the index. */
+    bool (*copy)(void *this,
+                 const void *other,
+                 void (*copy)(void *dst, const void *src, size_t esize)); /**< Copies all elements of other list. */
+    void *(*data)(const void *this); /**< Returns NULL, the elements aren`t stored contiguously. */
+    bool (*reverse)(void *this);              /**< Reverses the order of the chunks and of the elements in them. */
+    bool (*rotate)(void *this, size_t count); /**< Rotates the elements to the left by relinking of the chunks. */
+    bool (*fill)(void *this, size_t first, size_t count, const void *data); /**< Fills a range of elements by a value. */
+  };
+} unrolled_list_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ *  \brief Creates a new unrolled list with a specified element size.
+ *
+ *  The number of the elements in the chunk is chosen by the element size, so the chunk takes a few cache lines.
+ *
+ *  \param[in] esize Size in bytes of each element that the list will store.
+ *  \return Pointer to the newly created list or NULL if the allocation failed.
+ */
+unrolled_list_t *unrolled_list_create(size_t esize);
+
+/**
+ *  \brief Frees up the memory associated with the unrolled list.
+ *
+ *  \param[in,out] list Double pointer to the list to be deleted.
+ */
+void unrolled_list_delete(unrolled_list_t **list);
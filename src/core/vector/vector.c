@@ -30,6 +30,7 @@ struct Private_tag
   size_t esize;              /// Single element size
   volatile size_t size;      /// Stores elements number
   volatile size_t capacity;  /// Max size of pool in bytes
+  size_t head;               /// Bytes of the removed front elements between the allocated memory and the pool
 };
 //_____ M A C R O S ___________________________________________________________
 //_____ V A R I A B L E S _____________________________________________________
@@ -60,6 +61,7 @@ static inline vector_t *vector_allocate(void)
   vector->private->capacity = 0;
   vector->private->esize = 0;
   vector->private->size = 0;
+  vector->private->head = 0;
   vector->private->pool = NULL;
 
   return vector;
@@ -83,14 +85,44 @@ static inline bool vector_reallocate(vector_t *vector, size_t new_size)
   size_t size_in_bytes = vector->private->size * vector->private->esize;
   memcpy(data, vector->private->pool, size_in_bytes);
 
-  mem_free(vector->private->pool);
+  mem_free(&vector->private->pool[-vector->private->head]);
 
   vector->private->pool = data;
   vector->private->capacity = new_size_in_bytes;
+  vector->private->head = 0;
 
   return true;
 }
 
+/*
+ * Returns the memory of the removed front elements to the pool by moving the elements to the start of the memory.
+ */
+static inline void vector_rewind(vector_t *vector)
+{
+  uint8_t *origin = &vector->private->pool[-vector->private->head];
+  memmove(origin, vector->private->pool, vector->private->size * vector->private->esize);
+
+  vector->private->pool = origin;
+  vector->private->capacity += vector->private->head;
+  vector->private->head = 0;
+}
+
+/*
+ * Removes the front element in O(1) by moving the start of the pool, so the element stays in place
+ * until the next insertion. Returns a pointer to the removed element.
+ */
+static inline void *vector_drop_front(vector_t *vector)
+{
+  uint8_t *front = vector->private->pool;
+
+  vector->private->pool = front + vector->private->esize;
+  vector->private->capacity -= vector->private->esize;
+  vector->private->head += vector->private->esize;
+  vector->private->size--;
+
+  return front;
+}
+
 #if 0
 static inline bool vector_decrease(vector_t *vector)
 {
@@ -134,7 +166,7 @@ static inline void vector_free(vector_t *vector)
   free_fn_t mem_free = get_free();
   UC_ASSERT(mem_free);
 
-  mem_free(vector->private->pool);
+  mem_free(&vector->private->pool[-vector->private->head]);
   mem_free(vector->private);
   mem_free(vector);
 }
@@ -170,12 +202,6 @@ static size_t free_space(const vector_t *vector)
   return (vector->private->capacity - (vector->private->size * vector->private->esize));
 }
 
-static bool is_free_space_for_element(const vector_t *vector)
-{
-  size_t free_space_in_bytes = free_space(vector);
-  return (free_space_in_bytes >= vector->private->esize);
-}
-
 static bool resize_cb(void *vector, size_t new_size)
 {
   UC_ASSERT(vector);
@@ -190,62 +216,72 @@ static bool resize_cb(void *vector, size_t new_size)
   return vector_reallocate(_vector, new_size);
 }
 
-static bool push_front_cb(void *vector, const void *data)
+static void *reserve_range(vector_t *vector, size_t index, size_t count)
 {
-  UC_ASSERT(vector);
-  UC_ASSERT(data);
-
-  allocate_fn_t mem_allocate = get_allocator();
-  UC_ASSERT(mem_allocate);
+  size_t range_in_bytes = count * vector->private->esize;
 
-  vector_t *_vector = (vector_t *)vector;
+  // The memory of the removed front elements is reused before the pool grows
+  if (free_space(vector) < range_in_bytes && free_space(vector) + vector->private->head >= range_in_bytes)
+  {
+    vector_rewind(vector);
+  }
 
-  if (!is_free_space_for_element(_vector))
+  if (free_space(vector) < range_in_bytes)
   {
-    if (!vector_reallocate(_vector, RESIZE_FACTOR))
+    if (!vector_reallocate(vector, (count > RESIZE_FACTOR) ? count : RESIZE_FACTOR))
     {
-      return false;
+      return NULL;
     }
   }
 
-  size_t size_in_bytes = _vector->private->size * _vector->private->esize;
-  uint8_t *dst = &_vector->private->pool[size_in_bytes + _vector->private->esize];
-  uint8_t *src = &_vector->private->pool[size_in_bytes];
-  for (size_t i = 0; i < size_in_bytes; i++)
-  {
-    *(--dst) = *(--src);
-  }
+  size_t offset_in_bytes = index * vector->private->esize;
+  size_t size_in_bytes = vector->private->size * vector->private->esize;
+  uint8_t *slot = &vector->private->pool[offset_in_bytes];
 
-  memcpy(&_vector->private->pool[0], data, _vector->private->esize);
+  // Move tail of the pool to free place for the new elements
+  memmove(slot + range_in_bytes, slot, size_in_bytes - offset_in_bytes);
 
-  _vector->private->size++;
+  vector->private->size += count;
 
-  return true;
+  return slot;
 }
 
-static bool pop_front_cb(void *vector, void *data)
+static inline void *reserve_slot(vector_t *vector, size_t index)
+{
+  return reserve_range(vector, index, 1);
+}
+
+static bool push_front_cb(void *vector, const void *data)
 {
   UC_ASSERT(vector);
   UC_ASSERT(data);
 
   vector_t *_vector = (vector_t *)vector;
 
-  if (is_empty(_vector))
+  void *slot = reserve_slot(_vector, 0);
+  if (NULL == slot)
   {
     return false;
   }
 
-  memcpy(data, &_vector->private->pool[0], _vector->private->esize);
+  memcpy(slot, data, _vector->private->esize);
 
-  size_t size_in_bytes = _vector->private->size * _vector->private->esize;
-  uint8_t *dst = &_vector->private->pool[0];
-  uint8_t *src = &_vector->private->pool[_vector->private->esize];
-  for (size_t i = 0; i < size_in_bytes; i++)
+  return true;
+}
+
+static bool pop_front_cb(void *vector, void *data)
+{
+  UC_ASSERT(vector);
+  UC_ASSERT(data);
+
+  vector_t *_vector = (vector_t *)vector;
+
+  if (is_empty(_vector))
   {
-    dst[i] = src[i];
+    return false;
   }
 
-  _vector->private->size--;
+  memcpy(data, vector_drop_front(_vector), _vector->private->esize);
 
   return true;
 }
@@ -257,18 +293,13 @@ static bool push_back_cb(void *vector, const void *data)
 
   vector_t *_vector = (vector_t *)vector;
 
-  if (!is_free_space_for_element(_vector))
+  void *slot = reserve_slot(_vector, _vector->private->size);
+  if (NULL == slot)
   {
-    if (!vector_reallocate(_vector, RESIZE_FACTOR))
-    {
-      return false;
-    }
+    return false;
   }
 
-  size_t size_in_bytes = _vector->private->size * _vector->private->esize;
-  memcpy(&_vector->private->pool[size_in_bytes], data, _vector->private->esize);
-
-  _vector->private->size++;
+  memcpy(slot, data, _vector->private->esize);
 
   return true;
 }
@@ -306,29 +337,140 @@ static bool insert_cb(void *vector, const void *data, size_t index)
     return false;
   }
 
-  if (!is_free_space_for_element(_vector))
+  void *slot = reserve_slot(_vector, index);
+  if (NULL == slot)
+  {
+    return false;
+  }
+
+  memcpy(slot, data, _vector->private->esize);
+
+  return true;
+}
+
+static bool insert_range_cb(void *vector, const void *data, size_t index, size_t count)
+{
+  UC_ASSERT(vector);
+  UC_ASSERT(data);
+
+  vector_t *_vector = (vector_t *)vector;
+
+  if (index > _vector->private->size)
+  {
+    return false;
+  }
+
+  if (0 == count)
+  {
+    return true;
+  }
+
+  void *slot = reserve_range(_vector, index, count);
+  if (NULL == slot)
+  {
+    return false;
+  }
+
+  memcpy(slot, data, count * _vector->private->esize);
+
+  return true;
+}
+
+static bool splice_cb(void *vector, size_t index, void *other)
+{
+  UC_ASSERT(vector);
+  UC_ASSERT(other);
+
+  vector_t *_vector = (vector_t *)vector;
+  vector_t *source = (vector_t *)other;
+
+  if (index > _vector->private->size || _vector->private->esize != source->private->esize)
+  {
+    return false;
+  }
+
+  if (is_empty(source))
+  {
+    return true;
+  }
+
+  void *slot = reserve_range(_vector, index, source->private->size);
+  if (NULL == slot)
+  {
+    return false;
+  }
+
+  memcpy(slot, source->private->pool, source->private->size * source->private->esize);
+  source->private->size = 0;
+
+  return true;
+}
+
+static bool copy_cb(void *vector, const void *other, void (*copy)(void *dst, const void *src, size_t esize))
+{
+  UC_ASSERT(vector);
+  UC_ASSERT(other);
+
+  vector_t *_vector = (vector_t *)vector;
+  const vector_t *source = (const vector_t *)other;
+  size_t esize = source->private->esize;
+
+  if (!is_empty(_vector) || _vector->private->esize != esize)
+  {
+    return false;
+  }
+
+  size_t size_in_bytes = source->private->size * esize;
+
+  // The clone creates the pool for the source content, otherwise the pool is sized exactly once here
+  if (free_space(_vector) < size_in_bytes && !vector_reallocate(_vector, source->private->size))
+  {
+    return false;
+  }
+
+  if (copy)
   {
-    if (!vector_reallocate(_vector, RESIZE_FACTOR))
+    for (size_t offset = 0; offset < size_in_bytes; offset += esize)
     {
-      return false;
+      copy(&_vector->private->pool[offset], &source->private->pool[offset], esize);
     }
   }
+  else
+  {
+    memcpy(_vector->private->pool, source->private->pool, size_in_bytes);
+  }
 
-  size_t offset_in_bytes = index * _vector->private->esize;
-  size_t size_in_bytes = _vector->private->size * _vector->private->esize;
-  size_t byte_number = size_in_bytes - offset_in_bytes;
-  uint8_t *dst = &_vector->private->pool[size_in_bytes + _vector->private->esize];
-  uint8_t *src = &_vector->private->pool[size_in_bytes];
-  for (size_t i = 0; i < byte_number; i++)
+  _vector->private->size = source->private->size;
+
+  return true;
+}
+
+static void *emplace_cb(void *vector, size_t index)
+{
+  UC_ASSERT(vector);
+
+  vector_t *_vector = (vector_t *)vector;
+
+  if (index > _vector->private->size)
   {
-    *(--dst) = *(--src);
+    return NULL;
   }
 
-  memcpy(&_vector->private->pool[offset_in_bytes], data, _vector->private->esize);
+  return reserve_slot(_vector, index);
+}
 
-  _vector->private->size++;
+static void *acquire_front_cb(void *vector)
+{
+  UC_ASSERT(vector);
 
-  return true;
+  vector_t *_vector = (vector_t *)vector;
+
+  if (is_empty(_vector))
+  {
+    return NULL;
+  }
+
+  return vector_drop_front(_vector);
 }
 
 static bool extract_cb(void *vector, void *data, size_t index)
@@ -356,6 +498,34 @@ static bool extract_cb(void *vector, void *data, size_t index)
   return true;
 }
 
+static bool extract_range_cb(void *vector, void *data, size_t index, size_t count)
+{
+  UC_ASSERT(vector);
+
+  vector_t *_vector = (vector_t *)vector;
+
+  if (index > _vector->private->size || count > (_vector->private->size - index))
+  {
+    return false;
+  }
+
+  size_t esize = _vector->private->esize;
+  size_t offset_in_bytes = index * esize;
+  size_t range_in_bytes = count * esize;
+  size_t tail_in_bytes = (_vector->private->size - index - count) * esize;
+
+  if (NULL != data)
+  {
+    memcpy(data, &_vector->private->pool[offset_in_bytes], range_in_bytes);
+  }
+
+  memmove(&_vector->private->pool[offset_in_bytes], &_vector->private->pool[offset_in_bytes + range_in_bytes], tail_in_bytes);
+
+  _vector->private->size -= count;
+
+  return true;
+}
+
 static bool replace_cb(void *vector, const void *data, size_t index)
 {
   UC_ASSERT(vector);
@@ -405,12 +575,67 @@ static bool erase_cb(void *vector, size_t index)
 
   size_t offset_in_bytes = index * _vector->private->esize;
   size_t size_in_bytes = _vector->private->size * _vector->private->esize;
-  size_t byte_number = size_in_bytes - offset_in_bytes;
+  size_t byte_number = size_in_bytes - offset_in_bytes - _vector->private->esize;
   uint8_t *dst = &_vector->private->pool[offset_in_bytes];
-  uint8_t *src = &_vector->private->pool[offset_in_bytes + _vector->private->esize];
-  for (size_t i = 0; i < byte_number; i++)
+  memmove(dst, dst + _vector->private->esize, byte_number);
+
+  _vector->private->size--;
+
+  return true;
+}
+
+static size_t erase_if_cb(void *vector, bool (*predicate)(const void *data, size_t esize))
+{
+  UC_ASSERT(vector);
+  UC_ASSERT(predicate);
+
+  vector_t *_vector = (vector_t *)vector;
+
+  size_t esize = _vector->private->esize;
+  uint8_t *read = (uint8_t *)_vector->private->pool;
+  uint8_t *write = read;
+  uint8_t *end = read + (_vector->private->size * esize);
+
+  // Stable compaction: every kept element is moved at most once
+  for (; read < end; read += esize)
+  {
+    if (predicate(read, esize))
+    {
+      continue;
+    }
+
+    if (write != read)
+    {
+      memcpy(write, read, esize);
+    }
+
+    write += esize;
+  }
+
+  size_t erased = (size_t)(end - write) / esize;
+  _vector->private->size -= erased;
+
+  return erased;
+}
+
+static bool erase_unordered_cb(void *vector, size_t index)
+{
+  UC_ASSERT(vector);
+
+  vector_t *_vector = (vector_t *)vector;
+
+  if (is_empty(_vector) || index > (_vector->private->size - 1))
+  {
+    return false;
+  }
+
+  size_t esize = _vector->private->esize;
+  size_t last_in_bytes = (_vector->private->size - 1) * esize;
+
+  // Move the last element into the hole instead of shifting the whole tail
+  if (index * esize != last_in_bytes)
   {
-    dst[i] = src[i];
+    memcpy(&_vector->private->pool[index * esize], &_vector->private->pool[last_in_bytes], esize);
   }
 
   _vector->private->size--;
@@ -433,12 +658,207 @@ static void *peek_cb(void *vector, size_t index)
   return &_vector->private->pool[offset_in_bytes];
 }
 
+static void *data_cb(const void *vector)
+{
+  UC_ASSERT(vector);
+
+  return ((vector_t *)vector)->private->pool;
+}
+
+static void *cursor_cb(const void *vector, size_t index)
+{
+  UC_ASSERT(vector);
+
+  vector_t *_vector = (vector_t *)vector;
+
+  if (index >= _vector->private->size)
+  {
+    return NULL;
+  }
+
+  return &_vector->private->pool[index * _vector->private->esize];
+}
+
+static void *cursor_next_cb(const void *vector, void *position)
+{
+  UC_ASSERT(vector);
+  UC_ASSERT(position);
+
+  vector_t *_vector = (vector_t *)vector;
+
+  uint8_t *next = (uint8_t *)position + _vector->private->esize;
+  uint8_t *end = (uint8_t *)_vector->private->pool + (_vector->private->size * _vector->private->esize);
+
+  return (next < end) ? next : NULL;
+}
+
+static void *cursor_data_cb(const void *vector, void *position)
+{
+  UC_ASSERT(vector);
+  UC_ASSERT(position);
+
+  // The position of the vector element is the address of the element itself
+  return position;
+}
+
+static void *erase_cursor_cb(void *vector, void *position)
+{
+  UC_ASSERT(vector);
+  UC_ASSERT(position);
+
+  vector_t *_vector = (vector_t *)vector;
+
+  size_t index = (size_t)((uint8_t *)position - (uint8_t *)_vector->private->pool) / _vector->private->esize;
+  if (!erase_unordered_cb(_vector, index))
+  {
+    return NULL;
+  }
+
+  // The last element has been moved into the erased place, so it is the next element to visit
+  return (index < _vector->private->size) ? position : NULL;
+}
+
+/*
+ * Swaps two non-overlapping ranges by 8 bytes words and the tail by bytes. For the constant `bytes` the loops
+ * are unrolled into the typed swaps, which the compiler can vectorize.
+ */
+static inline __attribute__((always_inline)) void swap_bytes(uint8_t *data1, uint8_t *data2, size_t bytes)
+{
+  for (; bytes >= sizeof(uint64_t); bytes -= sizeof(uint64_t), data1 += sizeof(uint64_t), data2 += sizeof(uint64_t))
+  {
+    uint64_t tmp1;
+    uint64_t tmp2;
+    memcpy(&tmp1, data1, sizeof(tmp1));
+    memcpy(&tmp2, data2, sizeof(tmp2));
+    memcpy(data1, &tmp2, sizeof(tmp2));
+    memcpy(data2, &tmp1, sizeof(tmp1));
+  }
+
+  for (; bytes > 0; bytes--, data1++, data2++)
+  {
+    uint8_t tmp = *data1;
+    *data1 = *data2;
+    *data2 = tmp;
+  }
+}
+
+static inline __attribute__((always_inline)) void reverse_elements(uint8_t *pool, size_t size, size_t esize)
+{
+  uint8_t *low = pool;
+  uint8_t *high = pool + (size - 1) * esize;
+
+  for (; low < high; low += esize, high -= esize)
+  {
+    swap_bytes(low, high, esize);
+  }
+}
+
+static bool reverse_cb(void *vector)
+{
+  UC_ASSERT(vector);
+
+  vector_t *_vector = (vector_t *)vector;
+  uint8_t *pool = (uint8_t *)_vector->private->pool;
+  size_t size = _vector->private->size;
+
+  if (size < 2)
+  {
+    return true;
+  }
+
+  // The element size is passed as a constant for the fixed width elements, so the swaps are inlined as typed moves
+  switch (_vector->private->esize)
+  {
+    case 1: reverse_elements(pool, size, 1); break;
+    case 2: reverse_elements(pool, size, 2); break;
+    case 4: reverse_elements(pool, size, 4); break;
+    case 8: reverse_elements(pool, size, 8); break;
+    default: reverse_elements(pool, size, _vector->private->esize); break;
+  }
+
+  return true;
+}
+
+static bool rotate_cb(void *vector, size_t count)
+{
+  UC_ASSERT(vector);
+
+  vector_t *_vector = (vector_t *)vector;
+  uint8_t *pool = (uint8_t *)_vector->private->pool;
+  size_t esize = _vector->private->esize;
+  size_t size = _vector->private->size;
+
+  if (size < 2 || 0 == (count %= size))
+  {
+    return true;
+  }
+
+  // Block swap (Gries-Mills): the shorter of the blocks [count - i, count) and [count, count + j) is swapped
+  // with the same length part of the other block, which is then at its final place
+  size_t i = count;
+  size_t j = size - count;
+  while (i != j)
+  {
+    if (i < j)
+    {
+      swap_bytes(&pool[(count - i) * esize], &pool[(count + j - i) * esize], i * esize);
+      j -= i;
+    }
+    else
+    {
+      swap_bytes(&pool[(count - i) * esize], &pool[count * esize], j * esize);
+      i -= j;
+    }
+  }
+  swap_bytes(&pool[(count - i) * esize], &pool[count * esize], i * esize);
+
+  return true;
+}
+
+static bool fill_cb(void *vector, size_t first, size_t count, const void *data)
+{
+  UC_ASSERT(vector);
+  UC_ASSERT(data);
+
+  vector_t *_vector = (vector_t *)vector;
+  size_t esize = _vector->private->esize;
+
+  if (first > _vector->private->size || count > _vector->private->size - first)
+  {
+    return false;
+  }
+
+  if (0 == count)
+  {
+    return true;
+  }
+
+  // The filled part is doubled by every copy, so the range is filled by log2(count) memcpy calls
+  uint8_t *dst = &((uint8_t *)_vector->private->pool)[first * esize];
+  size_t filled = 1;
+  memcpy(dst, data, esize);
+
+  while (filled < count)
+  {
+    size_t chunk = (filled < count - filled) ? filled : count - filled;
+    memcpy(&dst[filled * esize], dst, chunk * esize);
+    filled += chunk;
+  }
+
+  return true;
+}
+
 static bool clear_cb(void *vector)
 {
   UC_ASSERT(vector);
 
   vector_t *_vector = (vector_t *)vector;
 
+  // All elements are dropped, so the memory of the removed front elements is returned without moving them
+  _vector->private->pool = &_vector->private->pool[-_vector->private->head];
+  _vector->private->capacity += _vector->private->head;
+  _vector->private->head = 0;
+
   if (is_empty(_vector))
   {
     return true;
@@ -477,6 +897,16 @@ static size_t esize_cb(const void *vector)
  * Detailed description see in vector.h
  */
 vector_t *vector_create(size_t esize)
+{
+  return vector_create_reserved(esize, DEFAULT_CAPACITY);
+}
+
+/**
+ * \brief Creates a new vector with the pool for the specified number of elements.
+ *
+ * Detailed description see in vector.h
+ */
+vector_t *vector_create_reserved(size_t esize, size_t capacity)
 {
   UC_ASSERT(0 != esize);
 
@@ -487,7 +917,8 @@ vector_t *vector_create(size_t esize)
   }
 
   vector->private->size = 0;
-  vector->private->capacity = DEFAULT_CAPACITY * esize;
+  vector->private->head = 0;
+  vector->private->capacity = ((0 == capacity) ? DEFAULT_CAPACITY : capacity) * esize;
   vector->private->esize = esize;
   vector->private->pool = pool_allocate(vector->private->capacity);
   if (NULL == vector->private->pool)
@@ -510,6 +941,22 @@ vector_t *vector_create(size_t esize)
   vector->clear = clear_cb;
   vector->size = size_cb;
   vector->esize = esize_cb;
+  vector->emplace = emplace_cb;
+  vector->acquire_front = acquire_front_cb;
+  vector->extract_range = extract_range_cb;
+  vector->insert_range = insert_range_cb;
+  vector->erase_if = erase_if_cb;
+  vector->erase_unordered = erase_unordered_cb;
+  vector->cursor = cursor_cb;
+  vector->cursor_next = cursor_next_cb;
+  vector->cursor_data = cursor_data_cb;
+  vector->erase_cursor = erase_cursor_cb;
+  vector->splice = splice_cb;
+  vector->copy = copy_cb;
+  vector->data = data_cb;
+  vector->reverse = reverse_cb;
+  vector->rotate = rotate_cb;
+  vector->fill = fill_cb;
 
   return vector;
 }
@@ -47,6 +47,24 @@ typedef struct
     bool (*clear)(void *this);               /**< Clear all elements from the vector. */
     size_t (*size)(const void *this);        /**< Get the number of elements in the vector. */
     size_t (*esize)(const void *this);       /**< Get the size of single element (in bytes). */
+    void *(*emplace)(void *this, size_t index); /**< Reserve a slot at a specific index and get a pointer to it. */
+    void *(*acquire_front)(void *this);         /**< Remove the front element and get a pointer to it without copying. */
+    bool (*extract_range)(void *this, void *data, size_t index, size_t count); /**< Remove (and retrieve) a range of elements. */
+    bool (*insert_range)(void *this, const void *data, size_t index, size_t count); /**< Insert an array of elements. */
+    size_t (*erase_if)(void *this, bool (*predicate)(const void *data, size_t esize)); /**< Remove matching elements. */
+    bool (*erase_unordered)(void *this, size_t index); /**< Remove an element by moving the last element in its place. */
+    void *(*cursor)(const void *this, size_t index);   /**< Get a position of an element at a specific index. */
+    void *(*cursor_next)(const void *this, void *position); /**< Get a position of the next element. */
+    void *(*cursor_data)(const void *this, void *position); /**< Get a pointer to an element at a position. */
+    void *(*erase_cursor)(void *this, void *position); /**< Remove an element at a position without keeping the order. */
+    bool (*splice)(void *this, size_t index, void *other); /**< Move all elements of other vector at a specific index. */
+    bool (*copy)(void *this,
+                 const void *other,
+                 void (*copy)(void *dst, const void *src, size_t esize)); /**< Copy all elements of other vector. */
+    void *(*data)(const void *this); /**< Get a pointer to the contiguous storage of the elements. */
+    bool (*reverse)(void *this);              /**< Reverse the order of the elements in place. */
+    bool (*rotate)(void *this, size_t count); /**< Rotate the elements to the left by a number of positions. */
+    bool (*fill)(void *this, size_t first, size_t count, const void *data); /**< Fill a range of elements by a value. */
   };
 } vector_t;
 //_____ M A C R O S ___________________________________________________________
@@ -63,6 +81,17 @@ typedef struct
  */
 vector_t *vector_create(size_t esize);
 
+/**
+ *  \brief Creates a new vector with the pool for the specified number of elements.
+ *
+ *  The pool isn`t reallocated until the vector grows beyond `capacity` elements.
+ *
+ *  \param[in] esize Size in bytes of each element that the vector will store.
+ *  \param[in] capacity Number of elements the pool is allocated for, the default capacity is used for 0.
+ *  \return Pointer to the newly created vector or NULL if the allocation failed.
+ */
+vector_t *vector_create_reserved(size_t esize, size_t capacity);
+
 /**
  *  \brief Frees up the memory associated with the vector.
  *
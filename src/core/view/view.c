@@ -0,0 +1,659 @@
+/**
+ * \file view.c
+ * \author Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * \brief View core: the window over a range of the elements of other container.
+ * \date 2023-10-15
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "view.h"
+
+#include "common/uc_assert.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "interface/allocator_if.h"
+//_____ C O N F I G S  ________________________________________________________
+//_____ D E F I N I T I O N S _________________________________________________
+struct Private_tag
+{
+  container_t *parent; /// Container which owns the elements
+  size_t esize;        /// Single element size
+  size_t first;        /// Index of the first element of the window in the parent
+  size_t size;         /// Number of the visible elements
+  size_t capacity;     /// Number of the elements in the window
+  void *head;          /// Parent position of the first element of the window
+  void *last;          /// Parent position of the last visible element or NULL if the view is empty
+  bool writable;       /// The elements can be changed through the view
+};
+
+/**
+ * \brief Both core tables have the same prototypes of the callbacks, the first member of both is the private data.
+ */
+typedef struct
+{
+  private_t *private;
+} view_t;
+//_____ M A C R O S ___________________________________________________________
+/// Fills the function table of the core by the view callbacks
+#define VIEW_BIND(core) \
+  do \
+  { \
+    (core)->resize = resize_cb; \
+    (core)->push_front = push_front_cb; \
+    (core)->pop_front = pop_cb; \
+    (core)->push_back = push_back_cb; \
+    (core)->pop_back = pop_cb; \
+    (core)->insert = insert_cb; \
+    (core)->extract = extract_cb; \
+    (core)->replace = replace_cb; \
+    (core)->at = at_cb; \
+    (core)->erase = erase_cb; \
+    (core)->peek = peek_cb; \
+    (core)->clear = clear_cb; \
+    (core)->size = size_cb; \
+    (core)->esize = esize_cb; \
+    (core)->emplace = emplace_cb; \
+    (core)->acquire_front = acquire_front_cb; \
+    (core)->extract_range = extract_range_cb; \
+    (core)->insert_range = insert_range_cb; \
+    (core)->erase_if = erase_if_cb; \
+    (core)->erase_unordered = erase_cb; \
+    (core)->cursor = cursor_cb; \
+    (core)->cursor_next = cursor_next_cb; \
+    (core)->cursor_data = cursor_data_cb; \
+    (core)->erase_cursor = erase_cursor_cb; \
+    (core)->splice = splice_cb; \
+    (core)->copy = copy_cb; \
+    (core)->data = data_cb; \
+    (core)->reverse = reverse_cb; \
+    (core)->rotate = rotate_cb; \
+    (core)->fill = fill_cb; \
+  } while (0)
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+static inline private_t *view_private(const void *view)
+{
+  return ((const view_t *)view)->private;
+}
+
+static inline void *parent_next(const private_t *view, void *position)
+{
+  container_cursor_t cursor = {.container = view->parent, .position = position};
+  container_cursor_next(&cursor);
+
+  return cursor.position;
+}
+
+static inline void *parent_data(const private_t *view, void *position)
+{
+  container_cursor_t cursor = {.container = view->parent, .position = position};
+
+  return container_cursor_data(&cursor);
+}
+
+static private_t *private_create(container_t *parent, size_t first, size_t count, bool writable)
+{
+  UC_ASSERT(parent);
+
+  if (first > container_size(parent) || count > container_size(parent) - first)
+  {
+    return NULL;
+  }
+
+  allocate_fn_t mem_allocate = get_allocator();
+  UC_ASSERT(mem_allocate);
+
+  private_t *view = (private_t *)mem_allocate(sizeof(private_t));
+  if (NULL == view)
+  {
+    return NULL;
+  }
+
+  view->parent = parent;
+  view->esize = container_esize(parent);
+  view->first = first;
+  view->size = count;
+  view->capacity = count;
+  view->writable = writable;
+  view->head = (0 == count) ? NULL : container_cursor(parent, first).position;
+  view->last = (0 == count) ? NULL : container_cursor(parent, first + count - 1).position;
+
+  return view;
+}
+
+/*
+ * The view doesn`t own the elements, so all operations which change the number of the elements of the parent fail.
+ */
+static bool resize_cb(void *view, size_t new_size)
+{
+  UC_ASSERT(view);
+
+  return new_size <= view_private(view)->capacity;
+}
+
+static bool push_front_cb(void *view, const void *data)
+{
+  UC_ASSERT(view);
+  (void)data;
+
+  return false;
+}
+
+static bool pop_cb(void *view, void *data)
+{
+  UC_ASSERT(view);
+  (void)data;
+
+  return false;
+}
+
+static bool insert_cb(void *view, const void *data, size_t index)
+{
+  UC_ASSERT(view);
+  (void)data;
+  (void)index;
+
+  return false;
+}
+
+static bool extract_cb(void *view, void *data, size_t index)
+{
+  UC_ASSERT(view);
+  (void)data;
+  (void)index;
+
+  return false;
+}
+
+static bool erase_cb(void *view, size_t index)
+{
+  UC_ASSERT(view);
+  (void)index;
+
+  return false;
+}
+
+static void *emplace_cb(void *view, size_t index)
+{
+  UC_ASSERT(view);
+  (void)index;
+
+  return NULL;
+}
+
+static void *acquire_front_cb(void *view)
+{
+  UC_ASSERT(view);
+
+  return NULL;
+}
+
+static bool extract_range_cb(void *view, void *data, size_t index, size_t count)
+{
+  UC_ASSERT(view);
+  (void)data;
+  (void)index;
+  (void)count;
+
+  return false;
+}
+
+static bool insert_range_cb(void *view, const void *data, size_t index, size_t count)
+{
+  UC_ASSERT(view);
+  (void)data;
+  (void)index;
+  (void)count;
+
+  return false;
+}
+
+static size_t erase_if_cb(void *view, bool (*predicate)(const void *data, size_t esize))
+{
+  UC_ASSERT(view);
+  (void)predicate;
+
+  return 0;
+}
+
+static void *erase_cursor_cb(void *view, void *position)
+{
+  UC_ASSERT(view);
+  (void)position;
+
+  return NULL;
+}
+
+static bool splice_cb(void *view, size_t index, void *other)
+{
+  UC_ASSERT(view);
+  (void)index;
+  (void)other;
+
+  return false;
+}
+
+static bool copy_cb(void *view, const void *other, void (*copy)(void *dst, const void *src, size_t esize))
+{
+  UC_ASSERT(view);
+  (void)other;
+  (void)copy;
+
+  return false;
+}
+
+static bool reverse_cb(void *view)
+{
+  UC_ASSERT(view);
+
+  return false;
+}
+
+static bool rotate_cb(void *view, size_t count)
+{
+  UC_ASSERT(view);
+  (void)count;
+
+  return false;
+}
+
+/*
+ * The cleared writable view forgets its elements, `push_back` overwrites the next element of the window.
+ * Together they allow the algorithms which rebuild the container (e.g. `uc_sort`) to work on the view.
+ */
+static bool clear_cb(void *view)
+{
+  UC_ASSERT(view);
+
+  private_t *_view = view_private(view);
+  if (!_view->writable)
+  {
+    return false;
+  }
+
+  _view->size = 0;
+  _view->last = NULL;
+
+  return true;
+}
+
+static bool push_back_cb(void *view, const void *data)
+{
+  UC_ASSERT(view);
+  UC_ASSERT(data);
+
+  private_t *_view = view_private(view);
+  if (!_view->writable || _view->size >= _view->capacity)
+  {
+    return false;
+  }
+
+  void *position = (0 == _view->size) ? _view->head : parent_next(_view, _view->last);
+  memcpy(parent_data(_view, position), data, _view->esize);
+
+  _view->last = position;
+  _view->size++;
+
+  return true;
+}
+
+static bool replace_cb(void *view, const void *data, size_t index)
+{
+  UC_ASSERT(view);
+  UC_ASSERT(data);
+
+  private_t *_view = view_private(view);
+  if (!_view->writable || index >= _view->size)
+  {
+    return false;
+  }
+
+  memcpy(container_peek(_view->parent, _view->first + index), data, _view->esize);
+
+  return true;
+}
+
+static bool at_cb(const void *view, void *data, size_t index)
+{
+  UC_ASSERT(view);
+  UC_ASSERT(data);
+
+  private_t *_view = view_private(view);
+  if (index >= _view->size)
+  {
+    return false;
+  }
+
+  memcpy(data, container_cpeek(_view->parent, _view->first + index), _view->esize);
+
+  return true;
+}
+
+static void *peek_cb(void *view, size_t index)
+{
+  UC_ASSERT(view);
+
+  private_t *_view = view_private(view);
+  if (!_view->writable || index >= _view->size)
+  {
+    return NULL;
+  }
+
+  return container_peek(_view->parent, _view->first + index);
+}
+
+static bool fill_cb(void *view, size_t first, size_t count, const void *data)
+{
+  UC_ASSERT(view);
+  UC_ASSERT(data);
+
+  private_t *_view = view_private(view);
+  if (!_view->writable || first > _view->size || count > _view->size - first)
+  {
+    return false;
+  }
+
+  return container_fill(_view->parent, _view->first + first, count, data);
+}
+
+static size_t size_cb(const void *view)
+{
+  UC_ASSERT(view);
+
+  return view_private(view)->size;
+}
+
+static size_t esize_cb(const void *view)
+{
+  UC_ASSERT(view);
+
+  return view_private(view)->esize;
+}
+
+static void *data_cb(const void *view)
+{
+  UC_ASSERT(view);
+
+  private_t *_view = view_private(view);
+  if (!_view->writable)
+  {
+    return NULL;
+  }
+
+  uint8_t *pool = (uint8_t *)container_data(_view->parent);
+
+  // The window of the contiguous parent is contiguous too
+  return (NULL == pool) ? NULL : &pool[_view->first * _view->esize];
+}
+
+static void *cursor_cb(const void *view, size_t index)
+{
+  UC_ASSERT(view);
+
+  private_t *_view = view_private(view);
+  if (index >= _view->size)
+  {
+    return NULL;
+  }
+
+  return (0 == index) ? _view->head : container_cursor(_view->parent, _view->first + index).position;
+}
+
+static void *cursor_next_cb(const void *view, void *position)
+{
+  UC_ASSERT(view);
+  UC_ASSERT(position);
+
+  private_t *_view = view_private(view);
+
+  return (position == _view->last) ? NULL : parent_next(_view, position);
+}
+
+static void *cursor_data_cb(const void *view, void *position)
+{
+  UC_ASSERT(view);
+  UC_ASSERT(position);
+
+  private_t *_view = view_private(view);
+
+  return (_view->writable) ? parent_data(_view, position) : NULL;
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * \brief Creates a view with the vector core function table.
+ *
+ * Detailed description see in view.h
+ */
+vector_t *vector_view_create(container_t *parent, size_t first, size_t count, bool writable)
+{
+  allocate_fn_t mem_allocate = get_allocator();
+  free_fn_t mem_free = get_free();
+
+  vector_t *view = (vector_t *)mem_allocate(sizeof *view);
+  if (NULL == view)
+  {
+    return NULL;
+  }
+
+  view->private = private_create(parent, first, count, writable);
+  if (NULL == view->private)
+  {
+    mem_free(view);
+    return NULL;
+  }
+
+  VIEW_BIND(view);
+
+  return view;
+}
+
+/**
+ * \brief Creates a view with the linked list core function table.
+ *
+ * Detailed description see in view.h
+ */
+linked_list_t *linked_list_view_create(container_t *parent, size_t first, size_t count, bool writable)
+{
+  allocate_fn_t mem_allocate = get_allocator();
+  free_fn_t mem_free = get_free();
+
+  linked_list_t *view = (linked_list_t *)mem_allocate(sizeof *view);
+  if (NULL == view)
+  {
+    return NULL;
+  }
+
+  view->private = private_create(parent, first, count, writable);
+  if (NULL == view->private)
+  {
+    mem_free(view);
+    return NULL;
+  }
+
+  VIEW_BIND(view);
+
+  return view;
+}
+
+/**
+ * \brief Creates a view with the unrolled list core function table.
+ *
+ * Detailed description see in view.h
+ */
+unrolled_list_t *unrolled_list_view_create(container_t *parent, size_t first, size_t count, bool writable)
+{
+  allocate_fn_t mem_allocate = get_allocator();
+  free_fn_t mem_free = get_free();
+
+  unrolled_list_t *view = (unrolled_list_t *)mem_allocate(sizeof *view);
+  if (NULL == view)
+  {
+    return NULL;
+  }
+
+  view->private = private_create(parent, first, count, writable);
+  if (NULL == view->private)
+  {
+    mem_free(view);
+    return NULL;
+  }
+
+  VIEW_BIND(view);
+
+  return view;
+}
+
+/**
+ * \brief Creates a view with the tiered vector core function table.
+ *
+ * Detailed description see in view.h
+ */
+tiered_vector_t *tiered_vector_view_create(container_t *parent, size_t first, size_t count, bool writable)
+{
+  allocate_fn_t mem_allocate = get_allocator();
+  free_fn_t mem_free = get_free();
+
+  tiered_vector_t *view = (tiered_vector_t *)mem_allocate(sizeof *view);
+  if (NULL == view)
+  {
+    return NULL;
+  }
+
+  view->private = private_create(parent, first, count, writable);
+  if (NULL == view->private)
+  {
+    mem_free(view);
+    return NULL;
+  }
+
+  VIEW_BIND(view);
+
+  return view;
+}
+
+/**
+ * \brief Frees up the memory associated with the view core.
+ *
+ * Detailed description see in view.h
+ */
+void vector_view_delete(vector_t **view)
+{
+  UC_ASSERT(view);
+  UC_ASSERT(*view);
+
+  free_fn_t mem_free = get_free();
+  mem_free((*view)->private);
+  mem_free(*view);
+  (*view) = NULL;
+}
+
+/**
+ * \brief Frees up the memory associated with the view core.
+ *
+ * Detailed description see in view.h
+ */
+void linked_list_view_delete(linked_list_t **view)
+{
+  UC_ASSERT(view);
+  UC_ASSERT(*view);
+
+  free_fn_t mem_free = get_free();
+  mem_free((*view)->private);
+  mem_free(*view);
+  (*view) = NULL;
+}
+
+/**
+ * \brief Frees up the memory associated with the view core.
+ *
+ * Detailed description see in view.h
+ */
+void unrolled_list_view_delete(unrolled_list_t **view)
+{
+  UC_ASSERT(view);
+  UC_ASSERT(*view);
+
+  free_fn_t mem_free = get_free();
+  mem_free((*view)->private);
+  mem_free(*view);
+  (*view) = NULL;
+}
+
+/**
+ * \brief Frees up the memory associated with the view core.
+ *
+ * Detailed description see in view.h
+ */
+void tiered_vector_view_delete(tiered_vector_t **view)
+{
+  UC_ASSERT(view);
+  UC_ASSERT(*view);
+
+  free_fn_t mem_free = get_free();
+  mem_free((*view)->private);
+  mem_free(*view);
+  (*view) = NULL;
+}
+
+/**
+ * \brief Checks whether the view can change the elements of its parent.
+ *
+ * Detailed description see in view.h
+ */
+bool view_writable(const void *view)
+{
+  UC_ASSERT(view);
+
+  return view_private(view)->writable;
+}
+
+/**
+ * \brief Returns a read-only pointer to an element of the view.
+ *
+ * Detailed description see in view.h
+ */
+const void *view_cpeek(const void *view, size_t index)
+{
+  UC_ASSERT(view);
+
+  private_t *_view = view_private(view);
+  if (index >= _view->size)
+  {
+    return NULL;
+  }
+
+  return container_cpeek(_view->parent, _view->first + index);
+}
+
+/**
+ * \brief Returns a read-only pointer to the element which the position of the view points to.
+ *
+ * Detailed description see in view.h
+ */
+const void *view_cursor_cdata(const void *view, void *position)
+{
+  UC_ASSERT(view);
+  UC_ASSERT(position);
+
+  container_cursor_t cursor = {.container = view_private(view)->parent, .position = position};
+
+  return container_cursor_cdata(&cursor);
+}
+
+/**
+ * \brief Returns a read-only pointer to the contiguous storage of the elements of the view.
+ *
+ * Detailed description see in view.h
+ */
+const void *view_cdata(const void *view)
+{
+  UC_ASSERT(view);
+
+  private_t *_view = view_private(view);
+  const uint8_t *pool = (const uint8_t *)container_cdata(_view->parent);
+
+  return (NULL == pool) ? NULL : &pool[_view->first * _view->esize];
+}
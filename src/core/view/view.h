@@ -0,0 +1,140 @@
+/**
+ * \file view.h
+ * \author Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * \brief View core: the window over a range of the elements of other container.
+ *
+ *  The view core fills the function table of the vector or linked list core by the callbacks which
+ *  work with the elements of the parent container in place, so the container with the view core is handled
+ *  by the container API and by all algorithms exactly as the container of the parent type.
+ *
+ *  The view doesn`t own the elements: the operations which change the number of the elements of the parent
+ *  (insert, erase, etc.) fail. The writable view can replace the elements and, to make the algorithms
+ *  which rebuild the container work, can be cleared and filled again by `push_back` up to its initial size:
+ *  the cleared view only forgets its elements and `push_back` overwrites the next element of the window.
+ *  The read-only view gives no writable pointers to the elements: `data`, `peek` and `cursor_data` return NULL,
+ *  the elements are read through the `view_cdata`, `view_cpeek` and `view_cursor_cdata` functions.
+ * \date 2023-10-15
+ */
+
+#pragma once
+
+//_____ I N C L U D E S _______________________________________________________
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "core/container.h"
+#include "core/linked_list/linked_list.h"
+#include "core/tiered_vector/tiered_vector.h"
+#include "core/unrolled_list/unrolled_list.h"
+#include "core/vector/vector.h"
+//_____ C O N F I G S  ________________________________________________________
+//_____ D E F I N I T I O N S _________________________________________________
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ *  \brief Creates a view with the vector core function table.
+ *
+ *  \param[in] parent Pointer to the parent container.
+ *  \param[in] first Index of the first element of the window in the parent container.
+ *  \param[in] count Number of the elements in the window.
+ *  \param[in] writable true if the elements can be changed through the view.
+ *  \return Pointer to the newly created view core or NULL if the allocation failed.
+ */
+vector_t *vector_view_create(container_t *parent, size_t first, size_t count, bool writable);
+
+/**
+ *  \brief Creates a view with the linked list core function table.
+ *
+ *  Parameters are the same as for `vector_view_create`.
+ *
+ *  \return Pointer to the newly created view core or NULL if the allocation failed.
+ */
+linked_list_t *linked_list_view_create(container_t *parent, size_t first, size_t count, bool writable);
+
+/**
+ *  \brief Frees up the memory associated with the view core created by `vector_view_create`.
+ *
+ *  The elements of the parent container aren`t changed.
+ *
+ *  \param[in,out] view Double pointer to the view core to be deleted.
+ */
+void vector_view_delete(vector_t **view);
+
+/**
+ *  \brief Frees up the memory associated with the view core created by `linked_list_view_create`.
+ *
+ *  \param[in,out] view Double pointer to the view core to be deleted.
+ */
+void linked_list_view_delete(linked_list_t **view);
+
+/**
+ *  \brief Creates a view with the unrolled list core function table.
+ *
+ *  Parameters are the same as for `vector_view_create`.
+ *
+ *  \return Pointer to the newly created view core or NULL if the allocation failed.
+ */
+unrolled_list_t *unrolled_list_view_create(container_t *parent, size_t first, size_t count, bool writable);
+
+/**
+ *  \brief Frees up the memory associated with the view core created by `unrolled_list_view_create`.
+ *
+ *  \param[in,out] view Double pointer to the view core to be deleted.
+ */
+void unrolled_list_view_delete(unrolled_list_t **view);
+
+/**
+ *  \brief Creates a view with the tiered vector core function table.
+ *
+ *  Parameters are the same as for `vector_view_create`.
+ *
+ *  \return Pointer to the newly created view core or NULL if the allocation failed.
+ */
+tiered_vector_t *tiered_vector_view_create(container_t *parent, size_t first, size_t count, bool writable);
+
+/**
+ *  \brief Frees up the memory associated with the view core created by `tiered_vector_view_create`.
+ *
+ *  \param[in,out] view Double pointer to the view core to be deleted.
+ */
+void tiered_vector_view_delete(tiered_vector_t **view);
+
+/**
+ *  \brief Checks whether the view can change the elements of its parent.
+ *
+ *  \param[in] view Pointer to the view core.
+ *
+ *  \return true for the mutable view, false for the read-only one.
+ */
+bool view_writable(const void *view);
+
+/**
+ *  \brief Returns a read-only pointer to an element of the view, also if the view isn`t writable.
+ *
+ *  \param[in] view  Pointer to the view core.
+ *  \param[in] index Index of the element in the view.
+ *
+ *  \return Pointer to the element or NULL if the index is out of the view.
+ */
+const void *view_cpeek(const void *view, size_t index);
+
+/**
+ *  \brief Returns a read-only pointer to the element the cursor position of the view points to, also if the view isn`t writable.
+ *
+ *  \param[in] view     Pointer to the view core.
+ *  \param[in] position Cursor position of the view.
+ *
+ *  \return Pointer to the element.
+ */
+const void *view_cursor_cdata(const void *view, void *position);
+
+/**
+ *  \brief Returns a read-only pointer to the contiguous storage of the view, also if the view isn`t writable.
+ *
+ *  \param[in] view Pointer to the view core.
+ *
+ *  \return Pointer to the first element of the view or NULL if the parent storage isn`t contiguous.
+ */
+const void *view_cdata(const void *view);
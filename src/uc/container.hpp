@@ -0,0 +1,471 @@
+/**
+ * \file    container.hpp
+ * \author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * \brief   Optional header-only C++ facade over the universal container.
+ *
+ * This file provides `uc::vector<T>`, `uc::list<T>` and `uc::deque<T>` templates which own
+ * the `container_t` and give it RAII lifetime, move semantics, range-for iterators and
+ * typed access to the elements without copies through `void *`:
+ *
+ * - `uc::vector<T>` is vector based. Its iterators are plain pointers to the contiguous storage.
+ * - `uc::list<T>` is linked list based. Its iterators walk the nodes by the container cursors.
+ * - `uc::deque<T>` is linked list based as well, because this core gives O(1) insertion and removal
+ *   at both ends. It also provides indexed access, which walks from the nearest end of the list.
+ *
+ * Move construction and move assignment transfer the ownership of the underlying pool or node chain
+ * without touching the elements. The `sort` method takes any comparator; the comparator is a template
+ * argument, so it is inlined into the sort loop instead of being called through a function pointer.
+ *
+ * The elements are stored by the C cores, which copy them byte by byte, so `T` must be trivially copyable.
+ * An allocation failure is reported by the `std::bad_alloc` exception.
+ *
+ * \example
+ *
+ * ```code
+ * uc::vector<uint32_t> values;
+ * values.push_back(42);
+ * values.sort(std::greater<uint32_t>());
+ * for (uint32_t value : values) { ... }
+ * ```
+ *
+ * \date    2023-10-08
+ */
+
+#pragma once
+
+//_____ I N C L U D E S _______________________________________________________
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "core/container.h"
+//_____ C O N F I G S  ________________________________________________________
+//_____ D E F I N I T I O N S _________________________________________________
+namespace uc
+{
+  namespace detail
+  {
+    /**
+     * \brief Forward iterator over the elements of the container which walks by the container cursor.
+     */
+    template <typename T> class cursor_iterator
+    {
+    public:
+      using iterator_category = std::forward_iterator_tag;
+      using value_type = typename std::remove_const<T>::type;
+      using difference_type = std::ptrdiff_t;
+      using pointer = T *;
+      using reference = T &;
+
+      cursor_iterator() noexcept : cursor_{nullptr, nullptr} {}
+      explicit cursor_iterator(container_cursor_t cursor) noexcept : cursor_(cursor) {}
+
+      reference operator*() const noexcept
+      {
+        return *static_cast<pointer>(element(&cursor_, std::is_const<T>{}));
+      }
+
+      pointer operator->() const noexcept
+      {
+        return static_cast<pointer>(element(&cursor_, std::is_const<T>{}));
+      }
+
+      cursor_iterator &operator++() noexcept
+      {
+        container_cursor_next(&cursor_);
+        return *this;
+      }
+
+      cursor_iterator operator++(int) noexcept
+      {
+        cursor_iterator tmp = *this;
+        ++(*this);
+        return tmp;
+      }
+
+      friend bool operator==(const cursor_iterator &a, const cursor_iterator &b) noexcept
+      {
+        return a.cursor_.position == b.cursor_.position;
+      }
+
+      friend bool operator!=(const cursor_iterator &a, const cursor_iterator &b) noexcept
+      {
+        return !(a == b);
+      }
+
+    private:
+      // The constant iterator reads the elements without invalidating the tracked hash of the container
+      static void *element(const container_cursor_t *cursor, std::false_type) noexcept
+      {
+        return container_cursor_data(cursor);
+      }
+
+      static const void *element(const container_cursor_t *cursor, std::true_type) noexcept
+      {
+        return container_cursor_cdata(cursor);
+      }
+
+      container_cursor_t cursor_;
+    };
+
+    /**
+     * \brief Owner of the `container_t` with functionality common for all container types.
+     */
+    template <typename T, container_type_e Type> class basic_container
+    {
+      static_assert(std::is_trivially_copyable<T>::value, "Elements of the container are copied byte by byte");
+
+    public:
+      using value_type = T;
+      using size_type = std::size_t;
+      using reference = T &;
+      using const_reference = const T &;
+
+      basic_container() : container_(create()) {}
+
+      /**
+       * \brief Takes the ownership of the existing container.
+       */
+      explicit basic_container(container_t *container) noexcept : container_(container) {}
+
+      basic_container(std::initializer_list<T> init) : basic_container()
+      {
+        for (const T &value : init)
+        {
+          push_back(value);
+        }
+      }
+
+      basic_container(const basic_container &other) : container_(nullptr)
+      {
+        if (other.container_)
+        {
+          container_ = container_clone(other.container_, CONTAINER_COPY_SHALLOW, nullptr);
+          if (nullptr == container_)
+          {
+            throw std::bad_alloc();
+          }
+        }
+      }
+
+      basic_container(basic_container &&other) noexcept : container_(std::exchange(other.container_, nullptr)) {}
+
+      basic_container &operator=(const basic_container &other)
+      {
+        if (this != &other)
+        {
+          basic_container tmp(other);
+          swap(tmp);
+        }
+        return *this;
+      }
+
+      basic_container &operator=(basic_container &&other) noexcept
+      {
+        if (this != &other)
+        {
+          reset();
+          container_ = std::exchange(other.container_, nullptr);
+        }
+        return *this;
+      }
+
+      ~basic_container()
+      {
+        reset();
+      }
+
+      /**
+       * \brief Returns the underlying container, so it can be passed to the generic C functions and algorithms.
+       */
+      container_t *native()
+      {
+        return get();
+      }
+
+      /**
+       * \brief Releases the ownership of the underlying container.
+       */
+      container_t *release() noexcept
+      {
+        return std::exchange(container_, nullptr);
+      }
+
+      void swap(basic_container &other) noexcept
+      {
+        std::swap(container_, other.container_);
+      }
+
+      size_type size() const noexcept
+      {
+        return (container_) ? container_size(container_) : 0;
+      }
+
+      bool empty() const noexcept
+      {
+        return 0 == size();
+      }
+
+      void clear() noexcept
+      {
+        if (container_)
+        {
+          container_clear(container_);
+        }
+      }
+
+      void push_back(const T &value)
+      {
+        emplace_back(value);
+      }
+
+      void push_front(const T &value)
+      {
+        emplace_front(value);
+      }
+
+      template <typename... Args> reference emplace_back(Args &&...args)
+      {
+        return construct(container_emplace_back(get()), std::forward<Args>(args)...);
+      }
+
+      template <typename... Args> reference emplace_front(Args &&...args)
+      {
+        return construct(container_emplace_front(get()), std::forward<Args>(args)...);
+      }
+
+      void pop_front() noexcept
+      {
+        container_erase_range(container_, 0, 1);
+      }
+
+      void pop_back() noexcept
+      {
+        container_erase_range(container_, size() - 1, 1);
+      }
+
+      reference front() noexcept
+      {
+        return *static_cast<T *>(container_peek(container_, 0));
+      }
+
+      reference back() noexcept
+      {
+        container_cursor_t cursor = container_cursor(container_, size() - 1);
+        return *static_cast<T *>(container_cursor_data(&cursor));
+      }
+
+      /**
+       * \brief Moves all elements of other container to the end of this one in O(1) for linked list based containers.
+       */
+      template <container_type_e OtherType> void splice_back(basic_container<T, OtherType> &other)
+      {
+        if (!other.empty() && !container_append(get(), other.native()))
+        {
+          throw std::bad_alloc();
+        }
+      }
+
+    protected:
+      container_t *get()
+      {
+        if (nullptr == container_)
+        {
+          container_ = create();
+        }
+        return container_;
+      }
+
+      const container_t *get() const noexcept
+      {
+        return container_;
+      }
+
+    private:
+      static container_t *create()
+      {
+        container_t *container = container_create(sizeof(T), Type);
+        if (nullptr == container)
+        {
+          throw std::bad_alloc();
+        }
+        return container;
+      }
+
+      template <typename... Args> static reference construct(void *slot, Args &&...args)
+      {
+        if (nullptr == slot)
+        {
+          throw std::bad_alloc();
+        }
+        return *::new (slot) T(std::forward<Args>(args)...);
+      }
+
+      void reset() noexcept
+      {
+        if (container_)
+        {
+          container_delete(&container_);
+        }
+      }
+
+      container_t *container_;
+    };
+
+    /**
+     * \brief Linked list based container walked by cursors.
+     */
+    template <typename T> class cursor_container : public basic_container<T, CONTAINER_LINKED_LIST_BASED>
+    {
+      using base = basic_container<T, CONTAINER_LINKED_LIST_BASED>;
+
+    public:
+      using base::base;
+      using iterator = cursor_iterator<T>;
+      using const_iterator = cursor_iterator<const T>;
+
+      iterator begin()
+      {
+        return (this->empty()) ? end() : iterator(container_cursor(this->get(), 0));
+      }
+
+      iterator end() noexcept
+      {
+        return iterator();
+      }
+
+      const_iterator begin() const noexcept
+      {
+        return (this->empty()) ? end() : const_iterator(container_cursor(this->get(), 0));
+      }
+
+      const_iterator end() const noexcept
+      {
+        return const_iterator();
+      }
+
+      /**
+       * \brief Sorts the elements. The elements are gathered into a temporary array once, sorted and written back.
+       */
+      template <typename Compare = std::less<T>> void sort(Compare comp = Compare())
+      {
+        std::size_t size = this->size();
+        if (size < 2)
+        {
+          return;
+        }
+
+        // The elements are copied into the reserved storage, so `T` needn`t be default constructible
+        std::vector<T> tmp;
+        tmp.reserve(size);
+        for (const T &value : *this)
+        {
+          tmp.push_back(value);
+        }
+        std::sort(tmp.begin(), tmp.end(), comp);
+        std::copy(tmp.begin(), tmp.end(), begin());
+      }
+    };
+  } // namespace detail
+
+  /**
+   * \brief Vector based container with contiguous storage.
+   */
+  template <typename T> class vector : public detail::basic_container<T, CONTAINER_VECTOR_BASED>
+  {
+    using base = detail::basic_container<T, CONTAINER_VECTOR_BASED>;
+
+  public:
+    using base::base;
+    using iterator = T *;
+    using const_iterator = const T *;
+
+    T *data()
+    {
+      return static_cast<T *>(container_data(this->get()));
+    }
+
+    const T *data() const noexcept
+    {
+      return (this->get()) ? static_cast<const T *>(container_cdata(this->get())) : nullptr;
+    }
+
+    T &operator[](std::size_t index)
+    {
+      return data()[index];
+    }
+
+    const T &operator[](std::size_t index) const noexcept
+    {
+      return data()[index];
+    }
+
+    iterator begin()
+    {
+      return data();
+    }
+
+    iterator end()
+    {
+      return data() + this->size();
+    }
+
+    const_iterator begin() const noexcept
+    {
+      return data();
+    }
+
+    const_iterator end() const noexcept
+    {
+      return data() + this->size();
+    }
+
+    /**
+     * \brief Sorts the elements in place directly in the storage of the container.
+     */
+    template <typename Compare = std::less<T>> void sort(Compare comp = Compare())
+    {
+      if (this->size() > 1)
+      {
+        std::sort(begin(), end(), comp);
+      }
+    }
+  };
+
+  /**
+   * \brief Linked list based container.
+   */
+  template <typename T> class list : public detail::cursor_container<T>
+  {
+    using base = detail::cursor_container<T>;
+
+  public:
+    using base::base;
+  };
+
+  /**
+   * \brief Double-ended queue: O(1) insertion and removal at both ends, indexed access walks from the nearest end.
+   */
+  template <typename T> class deque : public detail::cursor_container<T>
+  {
+    using base = detail::cursor_container<T>;
+
+  public:
+    using base::base;
+
+    T &operator[](std::size_t index)
+    {
+      container_cursor_t cursor = container_cursor(this->get(), index);
+      return *static_cast<T *>(container_cursor_data(&cursor));
+    }
+  };
+} // namespace uc
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P U B L I C  F U N C T I O N S_________________________________________
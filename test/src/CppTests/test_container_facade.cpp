@@ -0,0 +1,201 @@
+/**
+ * \file    test_container_facade.cpp
+ * \author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * \brief   Tests of the header-only C++ facade `uc/container.hpp`.
+ *
+ * Checks the ownership transfer by the move construction and assignment, the copy through `container_clone`,
+ * the iteration over the constant containers, `splice_back` between the container types and the sort
+ * of the elements which aren`t default constructible.
+ * Ceedling builds only C sources, so the test is a standalone program which returns non-zero on failure.
+ *
+ * Build and run from the root of the repository:
+ *
+ * ```code
+ * gcc -O1 -c -Isrc $(find src -name '*.c') && \
+ * g++ -O1 -std=c++17 -Wall -Wextra -Isrc test/src/CppTests/test_container_facade.cpp *.o -o test_container_facade && \
+ * ./test_container_facade
+ * ```
+ *
+ * \date    2023-10-08
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include <cstdint>
+#include <cstdio>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "uc/container.hpp"
+//_____ C O N F I G S  ________________________________________________________
+//_____ D E F I N I T I O N S _________________________________________________
+/* Trivially copyable, but not default constructible element */
+struct keyed
+{
+  explicit keyed(uint32_t key) : key(key) {}
+  uint32_t key;
+};
+//_____ M A C R O S ___________________________________________________________
+#define CHECK(condition) check((condition), #condition, __LINE__)
+//_____ V A R I A B L E S _____________________________________________________
+static unsigned failures = 0;
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+static void check(bool condition, const char *text, int line)
+{
+  if (!condition)
+  {
+    std::printf("%s:%d: check failed: %s\n", __FILE__, line, text);
+    failures++;
+  }
+}
+
+/* Collects the elements through the constant iterators only */
+template <typename Container> static std::vector<uint32_t> elements(const Container &container)
+{
+  static_assert(std::is_const<typename std::remove_reference<decltype(*container.begin())>::type>::value,
+                "Constant container must give constant elements");
+
+  std::vector<uint32_t> result;
+  for (const uint32_t &value : container)
+  {
+    result.push_back(value);
+  }
+
+  return result;
+}
+
+template <typename Container> static void test_move()
+{
+  Container source = {1, 2, 3};
+  container_t *native = source.native();
+
+  /* The moved container takes the underlying container itself, the source is left empty */
+  Container target(std::move(source));
+  CHECK(target.native() == native);
+  CHECK(source.empty());
+  CHECK(elements(target) == (std::vector<uint32_t>{1, 2, 3}));
+
+  Container other = {7};
+  other = std::move(target);
+  CHECK(other.native() == native);
+  CHECK(target.empty());
+  CHECK(elements(other) == (std::vector<uint32_t>{1, 2, 3}));
+
+  /* The moved-from container is usable again */
+  target.push_back(5);
+  CHECK(elements(target) == (std::vector<uint32_t>{5}));
+
+  other = std::move(other);
+  CHECK(other.size() == 3);
+}
+
+template <typename Container> static void test_copy()
+{
+  Container source = {4, 5, 6};
+
+  /* The copy is cloned into a separate container, so the changes of one aren`t seen by the other */
+  Container copy(source);
+  CHECK(copy.native() != source.native());
+  CHECK(elements(copy) == elements(source));
+
+  copy.push_back(7);
+  source.front() = 40;
+  CHECK(elements(source) == (std::vector<uint32_t>{40, 5, 6}));
+  CHECK(elements(copy) == (std::vector<uint32_t>{4, 5, 6, 7}));
+
+  Container assigned = {9};
+  assigned = copy;
+  CHECK(elements(assigned) == (std::vector<uint32_t>{4, 5, 6, 7}));
+
+  Container empty;
+  assigned = empty;
+  CHECK(assigned.empty());
+}
+
+template <typename Container> static void test_const_iteration()
+{
+  Container container;
+  const Container &view = container;
+  CHECK(view.begin() == view.end());
+
+  for (uint32_t i = 0; i < 100; i++)
+  {
+    container.push_back(i);
+  }
+
+  std::vector<uint32_t> expected(100);
+  std::iota(expected.begin(), expected.end(), 0u);
+  CHECK(elements(view) == expected);
+
+  /* The constant iteration only reads the elements, so the tracked hash stays valid */
+  uint64_t hash = 0;
+  CHECK(container_hash_track(container.native(), true));
+  CHECK(elements(view) == expected);
+  CHECK(container_hash_cached(container.native(), &hash));
+}
+
+template <typename Destination, typename Source> static void test_splice_back()
+{
+  Destination destination = {1, 2};
+  Source source = {3, 4, 5};
+
+  destination.splice_back(source);
+  CHECK(source.empty());
+  CHECK(elements(destination) == (std::vector<uint32_t>{1, 2, 3, 4, 5}));
+
+  /* The empty source changes nothing */
+  destination.splice_back(source);
+  CHECK(destination.size() == 5);
+
+  source.push_back(6);
+  CHECK(elements(source) == (std::vector<uint32_t>{6}));
+}
+
+template <typename Container> static void test_sort_without_default_constructor()
+{
+  Container container;
+  for (uint32_t key : {5u, 1u, 4u, 2u, 3u})
+  {
+    container.emplace_back(key);
+  }
+
+  container.sort([](const keyed &a, const keyed &b) { return a.key > b.key; });
+
+  std::vector<uint32_t> keys;
+  for (const keyed &value : static_cast<const Container &>(container))
+  {
+    keys.push_back(value.key);
+  }
+  CHECK(keys == (std::vector<uint32_t>{5, 4, 3, 2, 1}));
+}
+
+template <typename Container> static void test_all()
+{
+  test_move<Container>();
+  test_copy<Container>();
+  test_const_iteration<Container>();
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+int main()
+{
+  test_all<uc::vector<uint32_t>>();
+  test_all<uc::list<uint32_t>>();
+  test_all<uc::deque<uint32_t>>();
+
+  test_splice_back<uc::list<uint32_t>, uc::list<uint32_t>>();
+  test_splice_back<uc::list<uint32_t>, uc::vector<uint32_t>>();
+  test_splice_back<uc::vector<uint32_t>, uc::list<uint32_t>>();
+  test_splice_back<uc::vector<uint32_t>, uc::vector<uint32_t>>();
+  test_splice_back<uc::deque<uint32_t>, uc::list<uint32_t>>();
+
+  test_sort_without_default_constructor<uc::list<keyed>>();
+  test_sort_without_default_constructor<uc::deque<keyed>>();
+  test_sort_without_default_constructor<uc::vector<keyed>>();
+
+  const uc::vector<uint32_t> constant = {1, 2, 3};
+  CHECK(constant.data() != nullptr && constant[2] == 3);
+
+  std::printf("C++ facade: %s\n", (0 == failures) ? "OK" : "FAILED");
+  return (0 == failures) ? 0 : 1;
+}
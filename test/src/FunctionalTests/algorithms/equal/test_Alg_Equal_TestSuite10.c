@@ -0,0 +1,136 @@
+/**
+ * @file    test_Alg_Equal_TestSuite10.c
+ * @author  Aliaksander Kavalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Tests for the 'equal' function for every pair of the container types.
+ *
+ * This file contains a series of tests to verify that the 'equal' function gives the same result
+ * whether the storages are compared directly or the containers are walked in lockstep:
+ * - Comparing equal containers by `memcmp`, by the callback and by the key.
+ * - Comparing containers which differ in a single element at every position.
+ *
+ * @date 2023-10-12
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "unity.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "algorithms/equal/uc_equal.h"
+#include "algorithms/key/uc_key.h"
+#include "algorithms/transformation/uc_transformation.h"
+#include "core/container.h"
+#include "interface/allocator_if.h"
+//_____ C O N F I G S  ________________________________________________________
+#define INPUT_SIZE 67
+//_____ D E F I N I T I O N S _________________________________________________
+typedef struct
+{
+  uint32_t id;
+  uint16_t revision;
+  uint8_t payload[10];
+} record_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+static const container_type_e types[4] = {
+  CONTAINER_LINKED_LIST_BASED, CONTAINER_VECTOR_BASED, CONTAINER_UNROLLED_LIST_BASED, CONTAINER_TIERED_VECTOR_BASED};
+static record_t input[INPUT_SIZE];
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+static bool id_equal(const void *data1, const void *data2, size_t esize)
+{
+  return ((const record_t *)data1)->id == ((const record_t *)data2)->id;
+}
+
+static container_t *create(container_type_e type)
+{
+  container_t *container = container_create(sizeof(record_t), type);
+  TEST_ASSERT_NOT_NULL(container);
+  TEST_ASSERT_TRUE(uc_from_array(container, input, INPUT_SIZE));
+
+  return container;
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+void setUp(void)
+{
+  for (size_t i = 0; i < INPUT_SIZE; i++)
+  {
+    input[i] = (record_t){.id = (uint32_t)(i * 7919u), .revision = (uint16_t)i, .payload = {(uint8_t)i}};
+  }
+}
+
+void tearDown(void)
+{
+}
+
+void test_init(void)
+{
+  TEST_MESSAGE("Equal Tests for Mixed Containers");
+}
+
+/**
+ * @brief Test for the 'equal' function with equal containers of every pair of types.
+ */
+void test_TestCase_1(void)
+{
+  TEST_MESSAGE("[EQUAL]: Equal containers of every pair of types");
+
+  for (size_t t1 = 0; t1 < 4; t1++)
+  {
+    for (size_t t2 = 0; t2 < 4; t2++)
+    {
+      container_t *container1 = create(types[t1]);
+      container_t *container2 = create(types[t2]);
+
+      TEST_ASSERT_TRUE(uc_equal(.container1 = container1, .container2 = container2));
+      TEST_ASSERT_TRUE(uc_equal(.container1 = container1, .container2 = container2, .cmp = id_equal));
+      TEST_ASSERT_TRUE(uc_equal(.container1 = container1, .container2 = container2, .key = UC_KEY_FIELD(record_t, revision, U16)));
+
+      container_delete(&container1);
+      container_delete(&container2);
+    }
+  }
+}
+
+/**
+ * @brief Test for the 'equal' function with containers which differ in a single element.
+ */
+void test_TestCase_2(void)
+{
+  TEST_MESSAGE("[EQUAL]: Single mismatch at every position");
+
+  for (size_t t1 = 0; t1 < 4; t1++)
+  {
+    for (size_t t2 = 0; t2 < 4; t2++)
+    {
+      container_t *container1 = create(types[t1]);
+      container_t *container2 = create(types[t2]);
+
+      for (size_t i = 0; i < INPUT_SIZE; i++)
+      {
+        /* Only the payload differs, so the key and the callback don`t see the mismatch */
+        record_t record = input[i];
+        record.payload[9] = 0xFF;
+        TEST_ASSERT_TRUE(container_replace(container2, &record, i));
+
+        TEST_ASSERT_FALSE(uc_equal(.container1 = container1, .container2 = container2));
+        TEST_ASSERT_TRUE(uc_equal(.container1 = container1, .container2 = container2, .cmp = id_equal));
+        TEST_ASSERT_TRUE(uc_equal(.container1 = container1, .container2 = container2, .key = UC_KEY_FIELD(record_t, id, U32)));
+
+        /* The key differs */
+        record.id = record.id + 1;
+        TEST_ASSERT_TRUE(container_replace(container2, &record, i));
+
+        TEST_ASSERT_FALSE(uc_equal(.container1 = container1, .container2 = container2, .cmp = id_equal));
+        TEST_ASSERT_FALSE(uc_equal(.container1 = container1, .container2 = container2, .key = UC_KEY_FIELD(record_t, id, U32)));
+        TEST_ASSERT_TRUE(uc_equal(.container1 = container1, .container2 = container2, .key = UC_KEY_FIELD(record_t, revision, U16)));
+
+        TEST_ASSERT_TRUE(container_replace(container2, &input[i], i));
+        TEST_ASSERT_TRUE(uc_equal(.container1 = container1, .container2 = container2));
+      }
+
+      container_delete(&container1);
+      container_delete(&container2);
+    }
+  }
+}
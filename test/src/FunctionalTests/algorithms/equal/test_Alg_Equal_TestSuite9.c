@@ -0,0 +1,112 @@
+/**
+ * @file    test_Alg_Equal_TestSuite9.c
+ * @author  Aliaksander Kavalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Tests for the 'equal' function with key descriptors.
+ *
+ * This file contains a series of tests to verify that the 'equal' function compares
+ * only the typed keys of the elements when the key descriptor is given:
+ * - Comparing structures which differ in fields other than the key.
+ * - Comparing structures which differ in the key field.
+ * - Comparing floating point numbers by value.
+ *
+ * @date 2023-10-02
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "unity.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "algorithms/equal/uc_equal.h"
+#include "algorithms/key/uc_key.h"
+#include "algorithms/transformation/uc_transformation.h"
+#include "core/container.h"
+#include "core/linked_list/linked_list.h"
+#include "core/vector/vector.h"
+#include "interface/allocator_if.h"
+//_____ C O N F I G S  ________________________________________________________
+//_____ D E F I N I T I O N S _________________________________________________
+typedef struct
+{
+  uint32_t id;
+  uint32_t revision;
+} record_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+static container_t *container1 = NULL;
+static container_t *container2 = NULL;
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+void setUp(void)
+{
+  container1 = container_create(sizeof(record_t), CONTAINER_LINKED_LIST_BASED);
+  TEST_ASSERT_NOT_NULL(container1);
+  container2 = container_create(sizeof(record_t), CONTAINER_VECTOR_BASED);
+  TEST_ASSERT_NOT_NULL(container2);
+}
+
+void tearDown(void)
+{
+  container_delete(&container1);
+  container_delete(&container2);
+}
+
+/**
+ * @brief Test for the 'equal' function with structures which differ only in non-key field.
+ */
+void test_TestCase_0(void)
+{
+  record_t input1[] = {{1, 10}, {2, 20}, {3, 30}};
+  record_t input2[] = {{1, 11}, {2, 21}, {3, 31}};
+
+  TEST_MESSAGE("[EQUAL]: Test for the 'equal' function by key with different non-key fields");
+
+  TEST_ASSERT_TRUE(uc_from_array(container1, input1, sizeof(input1) / sizeof(input1[0])));
+  TEST_ASSERT_TRUE(uc_from_array(container2, input2, sizeof(input2) / sizeof(input2[0])));
+
+  TEST_ASSERT_FALSE(uc_equal(.container1 = container1, .container2 = container2));
+  TEST_ASSERT_TRUE(uc_equal(.container1 = container1, .container2 = container2, .key = UC_KEY_FIELD(record_t, id, U32)));
+  TEST_ASSERT_FALSE(uc_equal(.container1 = container1, .container2 = container2, .key = UC_KEY_FIELD(record_t, revision, U32)));
+}
+
+/**
+ * @brief Test for the 'equal' function with structures which differ in the key field.
+ */
+void test_TestCase_1(void)
+{
+  record_t input1[] = {{1, 10}, {2, 20}, {3, 30}};
+  record_t input2[] = {{1, 10}, {2, 20}, {4, 30}};
+
+  TEST_MESSAGE("[EQUAL]: Test for the 'equal' function by key with different key fields");
+
+  TEST_ASSERT_TRUE(uc_from_array(container1, input1, sizeof(input1) / sizeof(input1[0])));
+  TEST_ASSERT_TRUE(uc_from_array(container2, input2, sizeof(input2) / sizeof(input2[0])));
+
+  TEST_ASSERT_FALSE(uc_equal(.container1 = container1, .container2 = container2, .key = UC_KEY_FIELD(record_t, id, U32)));
+  TEST_ASSERT_TRUE(uc_equal(.container1 = container1, .container2 = container2, .key = UC_KEY_FIELD(record_t, revision, U32)));
+}
+
+/**
+ * @brief Test for the 'equal' function with floating point numbers compared by value.
+ */
+void test_TestCase_2(void)
+{
+  double input1[] = {1.0, 0.0, -2.5};
+  double input2[] = {1.0, -0.0, -2.5};
+
+  TEST_MESSAGE("[EQUAL]: Test for the 'equal' function by `double` key");
+
+  container_t *numbers1 = container_create(sizeof(double), CONTAINER_VECTOR_BASED);
+  container_t *numbers2 = container_create(sizeof(double), CONTAINER_LINKED_LIST_BASED);
+
+  TEST_ASSERT_TRUE(uc_from_array(numbers1, input1, sizeof(input1) / sizeof(input1[0])));
+  TEST_ASSERT_TRUE(uc_from_array(numbers2, input2, sizeof(input2) / sizeof(input2[0])));
+
+  /* Positive and negative zeros differ by bytes, but equal by value */
+  TEST_ASSERT_FALSE(uc_equal(.container1 = numbers1, .container2 = numbers2));
+  TEST_ASSERT_TRUE(uc_equal(.container1 = numbers1, .container2 = numbers2, .key = UC_KEY_F64));
+
+  container_delete(&numbers1);
+  container_delete(&numbers2);
+}
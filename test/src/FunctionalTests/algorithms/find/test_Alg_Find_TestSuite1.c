@@ -0,0 +1,231 @@
+/**
+ * @file    test_Alg_Find_TestSuite1.c
+ * @author  Aliaksander Kavalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Tests for the linear search functions: 'find', 'find_if', 'count' and 'contains'.
+ *
+ * This file contains a series of tests to verify that:
+ * - The 'find' function returns the index of the first equal element at any position of the container.
+ * - The 'count' function counts the equal elements in the SIMD blocks and in the tail.
+ * - The parts of the neighbour elements which look like the value aren`t found.
+ * - The 'find_if' and 'count' functions with the predicate select the elements.
+ * Every test is executed for all container types and for element sizes with and without SIMD support.
+ *
+ * @date 2023-10-13
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "unity.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "algorithms/find/uc_find.h"
+#include "algorithms/transformation/uc_transformation.h"
+#include "core/container.h"
+#include "interface/allocator_if.h"
+//_____ C O N F I G S  ________________________________________________________
+#define INPUT_SIZE 100
+#define MAX_ESIZE  16
+//_____ D E F I N I T I O N S _________________________________________________
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+static const container_type_e types[4] = {
+  CONTAINER_LINKED_LIST_BASED, CONTAINER_VECTOR_BASED, CONTAINER_UNROLLED_LIST_BASED, CONTAINER_TIERED_VECTOR_BASED};
+static const size_t esizes[6] = {1, 2, 4, 8, 3, MAX_ESIZE};
+static uint8_t input[INPUT_SIZE * MAX_ESIZE];
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+/* Every element is filled by the byte `fill`, all bytes of the element are equal */
+static void fill_element(uint8_t *element, size_t esize, uint8_t fill)
+{
+  memset(element, fill, esize);
+}
+
+static void prepare(size_t esize)
+{
+  for (size_t i = 0; i < INPUT_SIZE; i++)
+  {
+    fill_element(&input[i * esize], esize, 0x11);
+  }
+}
+
+static bool is_odd(const void *data, size_t esize)
+{
+  (void)esize;
+
+  return 0 != (*(const uint8_t *)data & 1u);
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_init(void)
+{
+  TEST_MESSAGE("Linear Search Tests");
+}
+
+/**
+ * @brief Test for the 'find' and 'contains' functions with the value at every position.
+ */
+void test_TestCase_1(void)
+{
+  uint8_t value[MAX_ESIZE];
+
+  TEST_MESSAGE("[FIND]: Find value at every position");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    for (size_t e = 0; e < sizeof(esizes) / sizeof(esizes[0]); e++)
+    {
+      size_t esize = esizes[e];
+      fill_element(value, esize, 0xA5);
+
+      for (size_t position = 0; position < INPUT_SIZE; position++)
+      {
+        prepare(esize);
+        fill_element(&input[position * esize], esize, 0xA5);
+        /* The second equal element isn`t found */
+        if (position + 1 < INPUT_SIZE)
+        {
+          fill_element(&input[(INPUT_SIZE - 1) * esize], esize, 0xA5);
+        }
+
+        container_t *container = container_create(esize, types[t]);
+        TEST_ASSERT_TRUE(uc_from_array(container, input, INPUT_SIZE));
+
+        TEST_ASSERT_EQUAL_size_t(position, uc_find(.container = container, .value = value));
+        TEST_ASSERT_TRUE(uc_contains(.container = container, .value = value));
+
+        container_delete(&container);
+      }
+
+      /* The value isn`t found */
+      prepare(esize);
+      container_t *container = container_create(esize, types[t]);
+      TEST_ASSERT_EQUAL_size_t(0, uc_find(.container = container, .value = value));
+      TEST_ASSERT_FALSE(uc_contains(.container = container, .value = value));
+
+      TEST_ASSERT_TRUE(uc_from_array(container, input, INPUT_SIZE));
+      TEST_ASSERT_EQUAL_size_t(INPUT_SIZE, uc_find(.container = container, .value = value));
+      TEST_ASSERT_FALSE(uc_contains(.container = container, .value = value));
+
+      container_delete(&container);
+    }
+  }
+}
+
+/**
+ * @brief Test for the 'count' function.
+ */
+void test_TestCase_2(void)
+{
+  uint8_t value[MAX_ESIZE];
+
+  TEST_MESSAGE("[FIND]: Count values");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    for (size_t e = 0; e < sizeof(esizes) / sizeof(esizes[0]); e++)
+    {
+      size_t esize = esizes[e];
+      fill_element(value, esize, 0xA5);
+
+      for (size_t size = 1; size <= INPUT_SIZE; size += 7)
+      {
+        size_t expected = 0;
+        prepare(esize);
+        for (size_t i = 0; i < size; i += 3)
+        {
+          fill_element(&input[i * esize], esize, 0xA5);
+          expected++;
+        }
+
+        container_t *container = container_create(esize, types[t]);
+        TEST_ASSERT_TRUE(uc_from_array(container, input, size));
+        TEST_ASSERT_EQUAL_size_t(expected, uc_count(.container = container, .value = value));
+
+        container_delete(&container);
+      }
+    }
+  }
+}
+
+/**
+ * @brief Test for the value which matches only a part of the element or parts of two neighbour elements.
+ */
+void test_TestCase_3(void)
+{
+  TEST_MESSAGE("[FIND]: Partial matches aren`t found");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    /* Lower half of 8 bytes element is equal */
+    uint64_t elements64[INPUT_SIZE];
+    for (size_t i = 0; i < INPUT_SIZE; i++)
+    {
+      elements64[i] = 0x1111111122222222ull;
+    }
+    elements64[INPUT_SIZE / 2] = 0x3333333322222222ull;
+    uint64_t value64 = 0x4444444422222222ull;
+
+    container_t *container = container_create(sizeof(uint64_t), types[t]);
+    TEST_ASSERT_TRUE(uc_from_array(container, elements64, INPUT_SIZE));
+    TEST_ASSERT_EQUAL_size_t(INPUT_SIZE, uc_find(.container = container, .value = &value64));
+    TEST_ASSERT_EQUAL_size_t(0, uc_count(.container = container, .value = &value64));
+    value64 = 0x3333333322222222ull;
+    TEST_ASSERT_EQUAL_size_t(INPUT_SIZE / 2, uc_find(.container = container, .value = &value64));
+    container_delete(&container);
+
+    /* Bytes of two neighbour elements form the value */
+    uint16_t elements16[INPUT_SIZE];
+    for (size_t i = 0; i < INPUT_SIZE; i++)
+    {
+      elements16[i] = (i & 1) ? 0x00BB : 0xAA00;
+    }
+    uint16_t value16 = 0;
+    memcpy(&value16, (const uint8_t *)elements16 + 1, sizeof(value16));
+
+    container = container_create(sizeof(uint16_t), types[t]);
+    TEST_ASSERT_TRUE(uc_from_array(container, elements16, INPUT_SIZE));
+    TEST_ASSERT_FALSE(uc_contains(.container = container, .value = &value16));
+    TEST_ASSERT_EQUAL_size_t(0, uc_count(.container = container, .value = &value16));
+    container_delete(&container);
+  }
+}
+
+/**
+ * @brief Test for the 'find_if' and 'count' functions with the predicate.
+ */
+void test_TestCase_4(void)
+{
+  uint32_t elements[INPUT_SIZE];
+
+  TEST_MESSAGE("[FIND]: Find and count by predicate");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    for (size_t i = 0; i < INPUT_SIZE; i++)
+    {
+      elements[i] = (uint32_t)(2 * i);
+    }
+
+    container_t *container = container_create(sizeof(uint32_t), types[t]);
+    TEST_ASSERT_TRUE(uc_from_array(container, elements, INPUT_SIZE));
+    TEST_ASSERT_EQUAL_size_t(INPUT_SIZE, uc_find_if(.container = container, .match = is_odd));
+    TEST_ASSERT_EQUAL_size_t(0, uc_count(.container = container, .match = is_odd));
+
+    uint32_t odd = 77;
+    TEST_ASSERT_TRUE(container_replace(container, &odd, 42));
+    TEST_ASSERT_TRUE(container_replace(container, &odd, 61));
+    TEST_ASSERT_EQUAL_size_t(42, uc_find_if(.container = container, .match = is_odd));
+    TEST_ASSERT_EQUAL_size_t(2, uc_count(.container = container, .match = is_odd));
+    TEST_ASSERT_EQUAL_size_t(2, uc_count(.container = container, .value = &odd));
+
+    container_delete(&container);
+  }
+}
@@ -0,0 +1,297 @@
+/**
+ * @file    test_Alg_Search_TestSuite1.c
+ * @author  Aliaksander Kavalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Tests for the binary search family and the 'insert_sorted' function.
+ *
+ * This file contains a series of tests to verify that:
+ * - The 'lower_bound', 'upper_bound' and 'equal_range' functions return the same bounds as the linear scan.
+ * - The 'binary_search' function finds the present values and doesn`t find the absent ones.
+ * - The 'insert_sorted' function keeps the container sorted and equal elements in the insertion order.
+ * - The tiered vector based container is searched by the indexed access in O(log N) comparisons.
+ * Every test is executed for all container types and both orders.
+ *
+ * @date 2023-10-12
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "unity.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "algorithms/key/uc_key.h"
+#include "algorithms/search/uc_search.h"
+#include "algorithms/transformation/uc_transformation.h"
+#include "core/container.h"
+#include "interface/allocator_if.h"
+//_____ C O N F I G S  ________________________________________________________
+#define INPUT_SIZE 300
+//_____ D E F I N I T I O N S _________________________________________________
+typedef struct
+{
+  uint32_t id;
+  int32_t weight;
+} record_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+static const container_type_e types[4] = {
+  CONTAINER_LINKED_LIST_BASED, CONTAINER_VECTOR_BASED, CONTAINER_UNROLLED_LIST_BASED, CONTAINER_TIERED_VECTOR_BASED};
+static const ContainerSortOrder_e orders[2] = {SORT_ASCENDING, SORT_DESCENDING};
+static int32_t input[INPUT_SIZE];
+static record_t records[INPUT_SIZE];
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+static cmp_t compare(const void *data1, const void *data2, size_t esize)
+{
+  int32_t value1 = *(const int32_t *)data1;
+  int32_t value2 = *(const int32_t *)data2;
+
+  return (value1 > value2) ? GT : ((value1 < value2) ? LE : EQ);
+}
+
+static size_t comparisons = 0;
+
+static cmp_t counting_compare(const void *data1, const void *data2, size_t esize)
+{
+  comparisons++;
+  return compare(data1, data2, esize);
+}
+
+static cmp_t weight_compare(const void *data1, const void *data2, size_t esize)
+{
+  int32_t weight1 = ((const record_t *)data1)->weight;
+  int32_t weight2 = ((const record_t *)data2)->weight;
+
+  return (weight1 > weight2) ? GT : ((weight1 < weight2) ? LE : EQ);
+}
+
+static int ascending(const void *data1, const void *data2)
+{
+  return (int)compare(data1, data2, sizeof(int32_t));
+}
+
+static int descending(const void *data1, const void *data2)
+{
+  return -(int)compare(data1, data2, sizeof(int32_t));
+}
+
+/* Even values from -200 with duplicates, sorted in the given order */
+static void prepare(ContainerSortOrder_e order)
+{
+  for (size_t i = 0; i < INPUT_SIZE; i++)
+  {
+    input[i] = 2 * (int32_t)(i / 3) - 200;
+  }
+
+  qsort(input, INPUT_SIZE, sizeof(int32_t), (SORT_ASCENDING == order) ? ascending : descending);
+}
+
+static bool before(int32_t value1, int32_t value2, ContainerSortOrder_e order)
+{
+  return (SORT_ASCENDING == order) ? (value1 < value2) : (value1 > value2);
+}
+
+static size_t linear_lower_bound(int32_t value, ContainerSortOrder_e order)
+{
+  size_t index = 0;
+  while (index < INPUT_SIZE && before(input[index], value, order))
+  {
+    index++;
+  }
+
+  return index;
+}
+
+static size_t linear_upper_bound(int32_t value, ContainerSortOrder_e order)
+{
+  size_t index = 0;
+  while (index < INPUT_SIZE && !before(value, input[index], order))
+  {
+    index++;
+  }
+
+  return index;
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_init(void)
+{
+  TEST_MESSAGE("Binary Search Tests");
+}
+
+/**
+ * @brief Test for the 'lower_bound', 'upper_bound' and 'equal_range' functions.
+ */
+void test_TestCase_1(void)
+{
+  TEST_MESSAGE("[SEARCH]: Bounds of the values");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    for (size_t o = 0; o < 2; o++)
+    {
+      prepare(orders[o]);
+      container_t *container = container_create(sizeof(int32_t), types[t]);
+      TEST_ASSERT_TRUE(uc_from_array(container, input, INPUT_SIZE));
+
+      for (int32_t value = -203; value <= 3; value++)
+      {
+        size_t lower = linear_lower_bound(value, orders[o]);
+        size_t upper = linear_upper_bound(value, orders[o]);
+
+        TEST_ASSERT_EQUAL_size_t(lower, uc_lower_bound(.container = container, .value = &value, .order = orders[o], .cmp = compare));
+        TEST_ASSERT_EQUAL_size_t(lower, uc_lower_bound(.container = container, .value = &value, .order = orders[o], .key = UC_KEY_I32));
+        TEST_ASSERT_EQUAL_size_t(upper, uc_upper_bound(.container = container, .value = &value, .order = orders[o], .cmp = compare));
+        TEST_ASSERT_EQUAL_size_t(upper, uc_upper_bound(.container = container, .value = &value, .order = orders[o], .key = UC_KEY_I32));
+
+        uc_range_t range = uc_equal_range(.container = container, .value = &value, .order = orders[o], .key = UC_KEY_I32);
+        TEST_ASSERT_EQUAL_size_t(lower, range.first);
+        TEST_ASSERT_EQUAL_size_t(upper, range.last);
+      }
+
+      container_delete(&container);
+    }
+  }
+}
+
+/**
+ * @brief Test for the 'binary_search' function.
+ */
+void test_TestCase_2(void)
+{
+  TEST_MESSAGE("[SEARCH]: Binary search of the values");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    for (size_t o = 0; o < 2; o++)
+    {
+      prepare(orders[o]);
+      container_t *container = container_create(sizeof(int32_t), types[t]);
+
+      int32_t value = 0;
+      TEST_ASSERT_FALSE(uc_binary_search(.container = container, .value = &value, .order = orders[o]));
+      TEST_ASSERT_EQUAL_size_t(0, uc_lower_bound(.container = container, .value = &value, .order = orders[o]));
+
+      TEST_ASSERT_TRUE(uc_from_array(container, input, INPUT_SIZE));
+      for (value = -203; value <= 3; value++)
+      {
+        bool present = (value >= -200 && value <= -2 && 0 == (value & 1));
+        TEST_ASSERT_EQUAL(present, uc_binary_search(.container = container, .value = &value, .order = orders[o], .cmp = compare));
+        TEST_ASSERT_EQUAL(present, uc_binary_search(.container = container, .value = &value, .order = orders[o], .key = UC_KEY_I32));
+      }
+
+      container_delete(&container);
+    }
+  }
+}
+
+/**
+ * @brief Test for the 'insert_sorted' function.
+ */
+void test_TestCase_3(void)
+{
+  TEST_MESSAGE("[SEARCH]: Insertion into sorted container");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    container_t *container = container_create(sizeof(record_t), types[t]);
+
+    for (size_t i = 0; i < INPUT_SIZE; i++)
+    {
+      record_t record = {.id = (uint32_t)i, .weight = (int32_t)((i * 7919u) % 41u) - 20};
+      TEST_ASSERT_TRUE(container_insert_sorted(container, &record, weight_compare));
+    }
+
+    TEST_ASSERT_EQUAL_size_t(INPUT_SIZE, container_size(container));
+    TEST_ASSERT_TRUE(uc_to_array(container, records, INPUT_SIZE));
+    for (size_t i = 1; i < INPUT_SIZE; i++)
+    {
+      TEST_ASSERT_TRUE(records[i - 1].weight <= records[i].weight);
+      if (records[i - 1].weight == records[i].weight)
+      {
+        TEST_ASSERT_TRUE(records[i - 1].id < records[i].id);
+      }
+    }
+
+    /* The search by key field finds the inserted records */
+    record_t record = {.id = 0, .weight = 7};
+    uc_range_t range = uc_equal_range(.container = container, .value = &record, .key = UC_KEY_FIELD(record_t, weight, I32));
+    TEST_ASSERT_TRUE(range.first < range.last);
+    for (size_t i = range.first; i < range.last; i++)
+    {
+      TEST_ASSERT_EQUAL_INT32(7, records[i].weight);
+    }
+
+    container_delete(&container);
+  }
+}
+
+/**
+ * @brief Test for the 'insert_sorted' function with the default comparison.
+ */
+void test_TestCase_4(void)
+{
+  const uint8_t values[] = {5, 1, 9, 5, 0, 255, 3};
+  const uint8_t expected[] = {0, 1, 3, 5, 5, 9, 255};
+  uint8_t output[sizeof(values)];
+
+  TEST_MESSAGE("[SEARCH]: Insertion into sorted container by memcmp");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    container_t *container = container_create(sizeof(uint8_t), types[t]);
+
+    for (size_t i = 0; i < sizeof(values); i++)
+    {
+      TEST_ASSERT_TRUE(container_insert_sorted(container, &values[i], NULL));
+    }
+
+    TEST_ASSERT_TRUE(uc_to_array(container, output, sizeof(output)));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, output, sizeof(expected));
+
+    container_delete(&container);
+  }
+}
+
+/**
+ * @brief Test for the binary search by the indexed access to the tiered vector based container.
+ */
+void test_TestCase_5(void)
+{
+  const size_t size = 100000;
+
+  TEST_MESSAGE("[SEARCH]: Binary search in tiered vector");
+
+  container_t *container = container_create(sizeof(int32_t), CONTAINER_TIERED_VECTOR_BASED);
+  for (int32_t i = 0; i < (int32_t)size; i++)
+  {
+    int32_t value = 2 * i;
+    TEST_ASSERT_TRUE(container_push_back(container, &value));
+  }
+
+  for (int32_t value = -1; value < 2 * (int32_t)size; value += 997)
+  {
+    comparisons = 0;
+    size_t lower = uc_lower_bound(.container = container, .value = &value, .cmp = counting_compare);
+    size_t upper = uc_upper_bound(.container = container, .value = &value, .cmp = counting_compare);
+
+    TEST_ASSERT_EQUAL_UINT32((size_t)(value + 1) / 2, lower);
+    TEST_ASSERT_EQUAL_UINT32((size_t)(value + 2) / 2, upper);
+    TEST_ASSERT_TRUE(comparisons <= 2 * 18);
+  }
+
+  int32_t value = 1001;
+  comparisons = 0;
+  TEST_ASSERT_TRUE(container_insert_sorted(container, &value, counting_compare));
+  TEST_ASSERT_TRUE(comparisons <= 18);
+  TEST_ASSERT_EQUAL_INT32(value, *(const int32_t *)container_cpeek(container, 501));
+
+  container_delete(&container);
+}
@@ -0,0 +1,241 @@
+/**
+ * @file    test_Alg_Select_TestSuite1.c
+ * @author  Aliaksander Kavalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Tests for the selection functions: 'nth_element', 'partial_sort' and 'top_k'.
+ *
+ * This file contains a series of tests to verify that:
+ * - The 'nth_element' function places the n-th element and partitions the rest around it.
+ * - The 'partial_sort' function sorts the first elements and keeps the rest of the elements.
+ * - The 'top_k' function copies the best elements into the buffer without changing the container.
+ * Every test is executed for all container types and both orders.
+ *
+ * @date 2023-10-11
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "unity.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "algorithms/key/uc_key.h"
+#include "algorithms/select/uc_select.h"
+#include "algorithms/transformation/uc_transformation.h"
+#include "core/container.h"
+#include "interface/allocator_if.h"
+//_____ C O N F I G S  ________________________________________________________
+#define INPUT_SIZE 500
+#define TOP_SIZE   20
+//_____ D E F I N I T I O N S _________________________________________________
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+static const container_type_e types[4] = {
+  CONTAINER_LINKED_LIST_BASED, CONTAINER_VECTOR_BASED, CONTAINER_UNROLLED_LIST_BASED, CONTAINER_TIERED_VECTOR_BASED};
+static const ContainerSortOrder_e orders[2] = {SORT_ASCENDING, SORT_DESCENDING};
+static int32_t input[INPUT_SIZE];
+static int32_t sorted[INPUT_SIZE];
+static int32_t output[INPUT_SIZE];
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+static cmp_t compare(const void *data1, const void *data2, size_t esize)
+{
+  int32_t value1 = *(const int32_t *)data1;
+  int32_t value2 = *(const int32_t *)data2;
+
+  return (value1 > value2) ? GT : ((value1 < value2) ? LE : EQ);
+}
+
+static int ascending(const void *data1, const void *data2)
+{
+  return (int)compare(data1, data2, sizeof(int32_t));
+}
+
+static int descending(const void *data1, const void *data2)
+{
+  return -(int)compare(data1, data2, sizeof(int32_t));
+}
+
+static void prepare(size_t pattern, ContainerSortOrder_e order)
+{
+  for (size_t i = 0; i < INPUT_SIZE; i++)
+  {
+    switch (pattern)
+    {
+      case 0: input[i] = (int32_t)((i * 7919u) % 1009u) - 500; break;
+      case 1: input[i] = (int32_t)(i % 3); break;
+      case 2: input[i] = (int32_t)i; break;
+      default: input[i] = (int32_t)(INPUT_SIZE - i); break;
+    }
+    sorted[i] = input[i];
+  }
+
+  qsort(sorted, INPUT_SIZE, sizeof(int32_t), (SORT_ASCENDING == order) ? ascending : descending);
+}
+
+static container_t *create(container_type_e type)
+{
+  container_t *container = container_create(sizeof(int32_t), type);
+  TEST_ASSERT_NOT_NULL(container);
+  TEST_ASSERT_TRUE(uc_from_array(container, input, INPUT_SIZE));
+
+  return container;
+}
+
+static bool before_or_equal(int32_t value1, int32_t value2, ContainerSortOrder_e order)
+{
+  return (SORT_ASCENDING == order) ? (value1 <= value2) : (value1 >= value2);
+}
+
+static void check_permutation(void)
+{
+  qsort(output, INPUT_SIZE, sizeof(int32_t), ascending);
+  qsort(input, INPUT_SIZE, sizeof(int32_t), ascending);
+  TEST_ASSERT_EQUAL_INT32_ARRAY(input, output, INPUT_SIZE);
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_init(void)
+{
+  TEST_MESSAGE("Selection Tests");
+}
+
+/**
+ * @brief Test for the 'nth_element' function.
+ */
+void test_TestCase_1(void)
+{
+  const size_t positions[] = {0, 1, INPUT_SIZE / 2, INPUT_SIZE - 2, INPUT_SIZE - 1};
+
+  TEST_MESSAGE("[SELECT]: Placing of n-th element");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    for (size_t o = 0; o < 2; o++)
+    {
+      for (size_t pattern = 0; pattern < 4; pattern++)
+      {
+        for (size_t p = 0; p < sizeof(positions) / sizeof(positions[0]); p++)
+        {
+          size_t nth = positions[p];
+          prepare(pattern, orders[o]);
+          container_t *container = create(types[t]);
+
+          TEST_ASSERT_TRUE(uc_nth_element(.container = container, .nth = nth, .order = orders[o], .cmp = compare));
+          TEST_ASSERT_TRUE(uc_to_array(container, output, INPUT_SIZE));
+
+          TEST_ASSERT_EQUAL_INT32(sorted[nth], output[nth]);
+          for (size_t i = 0; i < INPUT_SIZE; i++)
+          {
+            TEST_ASSERT_TRUE((i < nth) ? before_or_equal(output[i], output[nth], orders[o])
+                                       : before_or_equal(output[nth], output[i], orders[o]));
+          }
+          check_permutation();
+
+          container_delete(&container);
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Test for the 'nth_element' function with the index out of the container.
+ */
+void test_TestCase_2(void)
+{
+  TEST_MESSAGE("[SELECT]: n-th element out of container");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    container_t *container = container_create(sizeof(int32_t), types[t]);
+    TEST_ASSERT_FALSE(uc_nth_element(.container = container, .nth = 0));
+
+    int32_t value = 1;
+    TEST_ASSERT_TRUE(container_push_back(container, &value));
+    TEST_ASSERT_TRUE(uc_nth_element(.container = container, .nth = 0));
+    TEST_ASSERT_FALSE(uc_nth_element(.container = container, .nth = 1));
+
+    container_delete(&container);
+  }
+}
+
+/**
+ * @brief Test for the 'partial_sort' function.
+ */
+void test_TestCase_3(void)
+{
+  TEST_MESSAGE("[SELECT]: Partial sort");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    for (size_t o = 0; o < 2; o++)
+    {
+      for (size_t pattern = 0; pattern < 4; pattern++)
+      {
+        prepare(pattern, orders[o]);
+        container_t *container = create(types[t]);
+
+        TEST_ASSERT_TRUE(uc_partial_sort(.container = container, .count = TOP_SIZE, .order = orders[o], .key = UC_KEY_I32));
+        TEST_ASSERT_TRUE(uc_to_array(container, output, INPUT_SIZE));
+
+        TEST_ASSERT_EQUAL_INT32_ARRAY(sorted, output, TOP_SIZE);
+        for (size_t i = TOP_SIZE; i < INPUT_SIZE; i++)
+        {
+          TEST_ASSERT_TRUE(before_or_equal(output[TOP_SIZE - 1], output[i], orders[o]));
+        }
+        check_permutation();
+
+        /* The count which exceeds the size sorts the whole container */
+        prepare(pattern, orders[o]);
+        TEST_ASSERT_TRUE(uc_partial_sort(.container = container, .count = 2 * INPUT_SIZE, .order = orders[o], .cmp = compare));
+        TEST_ASSERT_TRUE(uc_to_array(container, output, INPUT_SIZE));
+        TEST_ASSERT_EQUAL_INT32_ARRAY(sorted, output, INPUT_SIZE);
+
+        container_delete(&container);
+      }
+    }
+  }
+}
+
+/**
+ * @brief Test for the 'top_k' function.
+ */
+void test_TestCase_4(void)
+{
+  int32_t top[TOP_SIZE];
+
+  TEST_MESSAGE("[SELECT]: Top-k selection");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    for (size_t o = 0; o < 2; o++)
+    {
+      for (size_t pattern = 0; pattern < 4; pattern++)
+      {
+        prepare(pattern, orders[o]);
+        container_t *container = create(types[t]);
+
+        TEST_ASSERT_TRUE(uc_top_k(.container = container, .output = top, .count = TOP_SIZE, .order = orders[o], .cmp = compare));
+        TEST_ASSERT_EQUAL_INT32_ARRAY(sorted, top, TOP_SIZE);
+
+        /* The container isn`t changed */
+        TEST_ASSERT_TRUE(uc_to_array(container, output, INPUT_SIZE));
+        TEST_ASSERT_EQUAL_INT32_ARRAY(input, output, INPUT_SIZE);
+
+        TEST_ASSERT_TRUE(uc_top_k(.container = container, .output = output, .count = INPUT_SIZE, .order = orders[o]));
+        TEST_ASSERT_TRUE(uc_top_k(.container = container, .output = output, .count = INPUT_SIZE, .order = orders[o], .key = UC_KEY_I32));
+        TEST_ASSERT_EQUAL_INT32_ARRAY(sorted, output, INPUT_SIZE);
+        TEST_ASSERT_FALSE(uc_top_k(.container = container, .output = output, .count = INPUT_SIZE + 1));
+
+        container_delete(&container);
+      }
+    }
+  }
+}
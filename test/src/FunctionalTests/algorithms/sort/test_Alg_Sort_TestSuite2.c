@@ -0,0 +1,175 @@
+/**
+ * @file    test_Alg_Sort_TestSuite2.c
+ * @author  Aliaksander Kavalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Tests for the 'sort' function with key descriptors.
+ *
+ * This file contains a series of tests to verify that the 'sort' function orders the elements
+ * by value of the typed key: signed integers, floating point numbers and fields of structures.
+ * Every test is executed for all sort methods and all container types.
+ *
+ * @date 2023-10-02
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "unity.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "algorithms/key/uc_key.h"
+#include "algorithms/sort/uc_sort.h"
+#include "algorithms/transformation/uc_transformation.h"
+#include "core/container.h"
+#include "core/linked_list/linked_list.h"
+#include "core/vector/vector.h"
+#include "interface/allocator_if.h"
+//_____ C O N F I G S  ________________________________________________________
+//_____ D E F I N I T I O N S _________________________________________________
+typedef struct
+{
+  uint8_t tag;
+  int64_t weight;
+  double score;
+} record_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+static const container_type_e types[4] = {
+  CONTAINER_LINKED_LIST_BASED, CONTAINER_VECTOR_BASED, CONTAINER_UNROLLED_LIST_BASED, CONTAINER_TIERED_VECTOR_BASED};
+static const ContainerSortTypes_e sorts[3] = {UC_BUBBLE_SORT, UC_SELECTION_SORT, UC_TIM_SORT};
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+static container_t *create(size_t esize, container_type_e type, const void *input, size_t size)
+{
+  container_t *container = container_create(esize, type);
+  TEST_ASSERT_NOT_NULL(container);
+  TEST_ASSERT_TRUE(uc_from_array(container, input, size));
+
+  return container;
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+/**
+ * @brief Test for sorting of signed 32-bit integers by typed key.
+ */
+void test_TestCase_0(void)
+{
+  int32_t input[] = {93, -111, 67, 0, -33, 66, 2147483647, -2147483647 - 1, 77, -1, 256, 1};
+  int32_t expected[] = {-2147483647 - 1, -111, -33, -1, 0, 1, 66, 67, 77, 93, 256, 2147483647};
+  size_t size = sizeof(input) / sizeof(input[0]);
+
+  TEST_MESSAGE("[SORT]: Sorting of `int32_t` data by key");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    for (size_t s = 0; s < 3; s++)
+    {
+      int32_t output[sizeof(input) / sizeof(input[0])] = {0};
+      container_t *container = create(sizeof(int32_t), types[t], input, size);
+
+      TEST_ASSERT_TRUE(uc_sort(.container = container, .sort = sorts[s], .key = UC_KEY_I32));
+      TEST_ASSERT_TRUE(uc_to_array(container, output, size));
+      TEST_ASSERT_EQUAL_INT32_ARRAY(expected, output, size);
+
+      container_delete(&container);
+    }
+  }
+}
+
+/**
+ * @brief Test for sorting of unsigned integers in descending order by typed key.
+ */
+void test_TestCase_1(void)
+{
+  uint16_t input[] = {0x0100, 0x00FF, 0x0001, 0xFFFF, 0x1000, 0x0010};
+  uint16_t expected[] = {0xFFFF, 0x1000, 0x0100, 0x00FF, 0x0010, 0x0001};
+  size_t size = sizeof(input) / sizeof(input[0]);
+
+  TEST_MESSAGE("[SORT]: Sorting of `uint16_t` data by key in descending order");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    for (size_t s = 0; s < 3; s++)
+    {
+      uint16_t output[sizeof(input) / sizeof(input[0])] = {0};
+      container_t *container = create(sizeof(uint16_t), types[t], input, size);
+
+      TEST_ASSERT_TRUE(uc_sort(.container = container, .sort = sorts[s], .order = SORT_DESCENDING, .key = UC_KEY_U16));
+      TEST_ASSERT_TRUE(uc_to_array(container, output, size));
+      TEST_ASSERT_EQUAL_UINT16_ARRAY(expected, output, size);
+
+      container_delete(&container);
+    }
+  }
+}
+
+/**
+ * @brief Test for sorting of floating point numbers by typed key.
+ */
+void test_TestCase_2(void)
+{
+  double input[] = {2.5, -0.5, 100.0, -1e9, 0.0, 3.25, -7.75};
+  double expected[] = {-1e9, -7.75, -0.5, 0.0, 2.5, 3.25, 100.0};
+  size_t size = sizeof(input) / sizeof(input[0]);
+
+  TEST_MESSAGE("[SORT]: Sorting of `double` data by key");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    for (size_t s = 0; s < 3; s++)
+    {
+      double output[sizeof(input) / sizeof(input[0])] = {0};
+      container_t *container = create(sizeof(double), types[t], input, size);
+
+      TEST_ASSERT_TRUE(uc_sort(.container = container, .sort = sorts[s], .key = UC_KEY_F64));
+      TEST_ASSERT_TRUE(uc_to_array(container, output, size));
+
+      for (size_t i = 0; i < size; i++)
+      {
+        TEST_ASSERT_TRUE(expected[i] == output[i]);
+      }
+
+      container_delete(&container);
+    }
+  }
+}
+
+/**
+ * @brief Test for sorting of structures by the field.
+ */
+void test_TestCase_3(void)
+{
+  record_t input[] = {{1, 40, 0.5}, {2, -10, 9.0}, {3, 300, -1.0}, {4, 0, 2.0}, {5, -500, 1.5}};
+  uint8_t expected_by_weight[] = {5, 2, 4, 1, 3};
+  uint8_t expected_by_score[] = {3, 1, 5, 4, 2};
+  size_t size = sizeof(input) / sizeof(input[0]);
+
+  TEST_MESSAGE("[SORT]: Sorting of structures by field");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    for (size_t s = 0; s < 3; s++)
+    {
+      container_t *container = create(sizeof(record_t), types[t], input, size);
+
+      TEST_ASSERT_TRUE(uc_sort(.container = container, .sort = sorts[s], .key = UC_KEY_FIELD(record_t, weight, I64)));
+      for (size_t i = 0; i < size; i++)
+      {
+        TEST_ASSERT_EQUAL_UINT8(expected_by_weight[i], ((record_t *)container_peek(container, i))->tag);
+      }
+
+      TEST_ASSERT_TRUE(uc_sort(.container = container, .sort = sorts[s], .key = UC_KEY_FIELD(record_t, score, F64)));
+      for (size_t i = 0; i < size; i++)
+      {
+        TEST_ASSERT_EQUAL_UINT8(expected_by_score[i], ((record_t *)container_peek(container, i))->tag);
+      }
+
+      container_delete(&container);
+    }
+  }
+}
@@ -0,0 +1,240 @@
+/**
+ * @file    test_Alg_Sort_TestSuite3.c
+ * @author  Aliaksander Kavalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Tests for the adaptive 'sort' method `UC_TIM_SORT`.
+ *
+ * This file contains a series of tests to verify that the adaptive sort:
+ * - Sorts random data in both orders.
+ * - Sorts already sorted, reverse sorted and nearly sorted data with O(N) comparisons.
+ * - Keeps the relative order of the equal elements (stable sort).
+ * - Merges long interleaved runs correctly (galloping mode).
+ * Every test is executed for all container types.
+ *
+ * @date 2023-10-09
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "unity.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "algorithms/key/uc_key.h"
+#include "algorithms/sort/uc_sort.h"
+#include "algorithms/transformation/uc_transformation.h"
+#include "core/container.h"
+#include "interface/allocator_if.h"
+//_____ C O N F I G S  ________________________________________________________
+#define INPUT_SIZE 1000
+//_____ D E F I N I T I O N S _________________________________________________
+typedef struct
+{
+  uint16_t key;
+  uint16_t seq;
+} record_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+static const container_type_e types[4] = {
+  CONTAINER_LINKED_LIST_BASED, CONTAINER_VECTOR_BASED, CONTAINER_UNROLLED_LIST_BASED, CONTAINER_TIERED_VECTOR_BASED};
+static size_t comparisons = 0;
+static uint32_t input[INPUT_SIZE];
+static uint32_t output[INPUT_SIZE];
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+static cmp_t counting_compare(const void *data1, const void *data2, size_t esize)
+{
+  uint32_t value1 = *(const uint32_t *)data1;
+  uint32_t value2 = *(const uint32_t *)data2;
+
+  comparisons++;
+  return (value1 > value2) ? GT : ((value1 < value2) ? LE : EQ);
+}
+
+static int ascending(const void *data1, const void *data2)
+{
+  uint32_t value1 = *(const uint32_t *)data1;
+  uint32_t value2 = *(const uint32_t *)data2;
+
+  return (value1 > value2) - (value1 < value2);
+}
+
+static uint32_t pseudo_random(size_t i)
+{
+  return (uint32_t)((i * 2654435761u) ^ (i >> 3)) % 10007u;
+}
+
+static void check_sorted(size_t type, ContainerSortOrder_e order)
+{
+  container_t *container = container_create(sizeof(uint32_t), types[type]);
+  TEST_ASSERT_NOT_NULL(container);
+  TEST_ASSERT_TRUE(uc_from_array(container, input, INPUT_SIZE));
+
+  TEST_ASSERT_TRUE(uc_sort(.container = container, .sort = UC_TIM_SORT, .order = order, .cmp = counting_compare));
+  TEST_ASSERT_EQUAL_UINT32(INPUT_SIZE, container_size(container));
+  TEST_ASSERT_TRUE(uc_to_array(container, output, INPUT_SIZE));
+
+  qsort(input, INPUT_SIZE, sizeof(uint32_t), ascending);
+  for (size_t i = 0; i < INPUT_SIZE; i++)
+  {
+    uint32_t expected = (SORT_ASCENDING == order) ? input[i] : input[INPUT_SIZE - 1 - i];
+    TEST_ASSERT_EQUAL_UINT32(expected, output[i]);
+  }
+
+  container_delete(&container);
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+void setUp(void)
+{
+  comparisons = 0;
+}
+
+void tearDown(void)
+{
+}
+
+void test_init(void)
+{
+  TEST_MESSAGE("Adaptive Sort Tests");
+}
+
+/**
+ * @brief Test for sorting of random data in both orders.
+ */
+void test_TestCase_1(void)
+{
+  TEST_MESSAGE("[SORT]: Adaptive sort of random data");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    for (size_t i = 0; i < INPUT_SIZE; i++)
+    {
+      input[i] = pseudo_random(i);
+    }
+    check_sorted(t, SORT_ASCENDING);
+
+    for (size_t i = 0; i < INPUT_SIZE; i++)
+    {
+      input[i] = pseudo_random(i);
+    }
+    check_sorted(t, SORT_DESCENDING);
+  }
+}
+
+/**
+ * @brief Test for sorting of sorted, reverse sorted and nearly sorted data with linear number of comparisons.
+ */
+void test_TestCase_2(void)
+{
+  TEST_MESSAGE("[SORT]: Adaptive sort of presorted data");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    for (size_t i = 0; i < INPUT_SIZE; i++)
+    {
+      input[i] = (uint32_t)i;
+    }
+    comparisons = 0;
+    check_sorted(t, SORT_ASCENDING);
+    TEST_ASSERT_EQUAL_UINT32(INPUT_SIZE - 1, comparisons);
+
+    for (size_t i = 0; i < INPUT_SIZE; i++)
+    {
+      input[i] = (uint32_t)i;
+    }
+    comparisons = 0;
+    check_sorted(t, SORT_DESCENDING);
+    TEST_ASSERT_EQUAL_UINT32(INPUT_SIZE - 1, comparisons);
+
+    /* Appended timestamps with minor reordering */
+    for (size_t i = 0; i < INPUT_SIZE; i++)
+    {
+      input[i] = (uint32_t)i * 10;
+    }
+    for (size_t i = 5; i < INPUT_SIZE; i += 97)
+    {
+      uint32_t tmp = input[i];
+      input[i] = input[i - 3];
+      input[i - 3] = tmp;
+    }
+    comparisons = 0;
+    check_sorted(t, SORT_ASCENDING);
+    TEST_ASSERT_TRUE(comparisons < 4 * INPUT_SIZE);
+  }
+}
+
+/**
+ * @brief Test for stability of the sort with many equal keys in both orders.
+ */
+void test_TestCase_3(void)
+{
+  record_t records[INPUT_SIZE];
+  record_t sorted[INPUT_SIZE];
+
+  TEST_MESSAGE("[SORT]: Adaptive sort is stable");
+
+  for (size_t i = 0; i < INPUT_SIZE; i++)
+  {
+    records[i].key = (uint16_t)(pseudo_random(i) % 17);
+    records[i].seq = (uint16_t)i;
+  }
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    for (size_t o = 0; o < 2; o++)
+    {
+      ContainerSortOrder_e order = (0 == o) ? SORT_ASCENDING : SORT_DESCENDING;
+      container_t *container = container_create(sizeof(record_t), types[t]);
+      TEST_ASSERT_TRUE(uc_from_array(container, records, INPUT_SIZE));
+
+      TEST_ASSERT_TRUE(uc_sort(.container = container, .sort = UC_TIM_SORT, .order = order, .key = UC_KEY_FIELD(record_t, key, U16)));
+      TEST_ASSERT_TRUE(uc_to_array(container, sorted, INPUT_SIZE));
+
+      for (size_t i = 1; i < INPUT_SIZE; i++)
+      {
+        if (sorted[i - 1].key == sorted[i].key)
+        {
+          TEST_ASSERT_TRUE(sorted[i - 1].seq < sorted[i].seq);
+        }
+        else
+        {
+          TEST_ASSERT_TRUE((SORT_ASCENDING == order) ? (sorted[i - 1].key < sorted[i].key) : (sorted[i - 1].key > sorted[i].key));
+        }
+      }
+
+      container_delete(&container);
+    }
+  }
+}
+
+/**
+ * @brief Test for merging of long interleaved runs.
+ */
+void test_TestCase_4(void)
+{
+  TEST_MESSAGE("[SORT]: Adaptive sort of long interleaved runs");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    /* Two long runs: even numbers followed by odd numbers */
+    for (size_t i = 0; i < INPUT_SIZE / 2; i++)
+    {
+      input[i] = (uint32_t)(2 * i);
+      input[INPUT_SIZE / 2 + i] = (uint32_t)(2 * i + 1);
+    }
+    check_sorted(t, SORT_ASCENDING);
+
+    /* Sawtooth: ascending runs of different lengths with overlapping ranges */
+    for (size_t i = 0; i < INPUT_SIZE; i++)
+    {
+      input[i] = (uint32_t)((i % (37 + (i / 200) * 50)) * 3);
+    }
+    check_sorted(t, SORT_ASCENDING);
+
+    /* Blocks which are already in order relative to each other, except few elements */
+    for (size_t i = 0; i < INPUT_SIZE; i++)
+    {
+      input[i] = (uint32_t)((i / 100) * 1000 + (99 - i % 100));
+    }
+    check_sorted(t, SORT_DESCENDING);
+  }
+}
@@ -0,0 +1,243 @@
+/**
+ * @file    test_Alg_Sort_TestSuite4.c
+ * @author  Aliaksander Kavalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Tests for the indirect 'sort' mode and the 'argsort' function.
+ *
+ * This file contains a series of tests to verify that:
+ * - The indirect sort of large elements gives the same result as the direct sort.
+ * - The indirect sort by the stable method keeps the relative order of the equal elements.
+ * - The 'argsort' function returns the sorting permutation and doesn`t change the container.
+ * - The indirect sort permutes the storage of the vector based container in place.
+ * Every test is executed for all container types.
+ *
+ * @date 2023-10-10
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "unity.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "algorithms/key/uc_key.h"
+#include "algorithms/sort/uc_sort.h"
+#include "algorithms/transformation/uc_transformation.h"
+#include "core/container.h"
+#include "interface/allocator_if.h"
+//_____ C O N F I G S  ________________________________________________________
+#define INPUT_SIZE 200
+//_____ D E F I N I T I O N S _________________________________________________
+typedef struct
+{
+  uint32_t id;
+  int32_t weight;
+  uint8_t payload[248];
+} record_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+static const container_type_e types[4] = {
+  CONTAINER_LINKED_LIST_BASED, CONTAINER_VECTOR_BASED, CONTAINER_UNROLLED_LIST_BASED, CONTAINER_TIERED_VECTOR_BASED};
+static const ContainerSortTypes_e sorts[3] = {UC_BUBBLE_SORT, UC_SELECTION_SORT, UC_TIM_SORT};
+static record_t input[INPUT_SIZE];
+static record_t direct[INPUT_SIZE];
+static record_t indirect[INPUT_SIZE];
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+static cmp_t weight_compare(const void *data1, const void *data2, size_t esize)
+{
+  int32_t weight1 = ((const record_t *)data1)->weight;
+  int32_t weight2 = ((const record_t *)data2)->weight;
+
+  return (weight1 > weight2) ? GT : ((weight1 < weight2) ? LE : EQ);
+}
+
+static void fill_input(void)
+{
+  for (size_t i = 0; i < INPUT_SIZE; i++)
+  {
+    input[i].id = (uint32_t)i;
+    input[i].weight = (int32_t)((i * 7919u) % 61u) - 30;
+    memset(input[i].payload, (int)(i & 0xFF), sizeof(input[i].payload));
+  }
+}
+
+static size_t allocated = 0;
+
+static void *counting_allocate(size_t size)
+{
+  allocated += size;
+  return malloc(size);
+}
+
+static container_t *create(container_type_e type)
+{
+  container_t *container = container_create(sizeof(record_t), type);
+  TEST_ASSERT_NOT_NULL(container);
+  TEST_ASSERT_TRUE(uc_from_array(container, input, INPUT_SIZE));
+
+  return container;
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+void setUp(void)
+{
+  fill_input();
+}
+
+void tearDown(void)
+{
+}
+
+void test_init(void)
+{
+  TEST_MESSAGE("Indirect Sort Tests");
+}
+
+/**
+ * @brief Test for equality of the indirect and direct sort results.
+ */
+void test_TestCase_1(void)
+{
+  TEST_MESSAGE("[SORT]: Indirect sort gives the same result as direct sort");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    for (size_t s = 0; s < 3; s++)
+    {
+      container_t *container1 = create(types[t]);
+      container_t *container2 = create(types[t]);
+
+      TEST_ASSERT_TRUE(uc_sort(.container = container1, .sort = sorts[s], .order = SORT_DESCENDING, .cmp = weight_compare));
+      TEST_ASSERT_TRUE(
+        uc_sort(.container = container2, .sort = sorts[s], .order = SORT_DESCENDING, .cmp = weight_compare, .indirect = true));
+
+      TEST_ASSERT_TRUE(uc_to_array(container1, direct, INPUT_SIZE));
+      TEST_ASSERT_TRUE(uc_to_array(container2, indirect, INPUT_SIZE));
+
+      for (size_t i = 0; i < INPUT_SIZE; i++)
+      {
+        TEST_ASSERT_EQUAL_INT32(direct[i].weight, indirect[i].weight);
+        /* Elements are moved as a whole */
+        TEST_ASSERT_EQUAL_UINT8((uint8_t)(indirect[i].id & 0xFF), indirect[i].payload[sizeof(indirect[i].payload) - 1]);
+      }
+
+      container_delete(&container1);
+      container_delete(&container2);
+    }
+  }
+}
+
+/**
+ * @brief Test for stability of the indirect sort by key.
+ */
+void test_TestCase_2(void)
+{
+  TEST_MESSAGE("[SORT]: Indirect stable sort by key");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    container_t *container = create(types[t]);
+
+    TEST_ASSERT_TRUE(
+      uc_sort(.container = container, .sort = UC_TIM_SORT, .key = UC_KEY_FIELD(record_t, weight, I32), .indirect = true));
+    TEST_ASSERT_TRUE(uc_to_array(container, indirect, INPUT_SIZE));
+
+    for (size_t i = 1; i < INPUT_SIZE; i++)
+    {
+      TEST_ASSERT_TRUE(indirect[i - 1].weight <= indirect[i].weight);
+      if (indirect[i - 1].weight == indirect[i].weight)
+      {
+        TEST_ASSERT_TRUE(indirect[i - 1].id < indirect[i].id);
+      }
+    }
+
+    container_delete(&container);
+  }
+}
+
+/**
+ * @brief Test for the 'argsort' function.
+ */
+void test_TestCase_3(void)
+{
+  size_t indices[INPUT_SIZE];
+
+  TEST_MESSAGE("[SORT]: Argsort returns permutation without reordering of container");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    container_t *container = create(types[t]);
+
+    TEST_ASSERT_TRUE(uc_argsort(.container = container, .indices = indices, .order = SORT_DESCENDING, .cmp = weight_compare));
+
+    /* The container isn`t changed */
+    TEST_ASSERT_TRUE(uc_to_array(container, direct, INPUT_SIZE));
+    for (size_t i = 0; i < INPUT_SIZE; i++)
+    {
+      TEST_ASSERT_EQUAL_UINT32(i, direct[i].id);
+    }
+
+    /* The permutation orders the elements, equal elements keep the original order */
+    for (size_t i = 1; i < INPUT_SIZE; i++)
+    {
+      TEST_ASSERT_TRUE(input[indices[i - 1]].weight >= input[indices[i]].weight);
+      if (input[indices[i - 1]].weight == input[indices[i]].weight)
+      {
+        TEST_ASSERT_TRUE(indices[i - 1] < indices[i]);
+      }
+    }
+
+    /* The result is the same as for the sort by key */
+    size_t by_key[INPUT_SIZE];
+    TEST_ASSERT_TRUE(
+      uc_argsort(.container = container, .indices = by_key, .order = SORT_DESCENDING, .key = UC_KEY_FIELD(record_t, weight, I32)));
+    TEST_ASSERT_EQUAL_MEMORY(indices, by_key, sizeof(indices));
+
+    container_delete(&container);
+  }
+}
+
+/**
+ * @brief Test for the 'argsort' function with empty container.
+ */
+void test_TestCase_4(void)
+{
+  size_t indices[1] = {42};
+
+  TEST_MESSAGE("[SORT]: Argsort of empty container");
+
+  container_t *container = container_create(sizeof(record_t), CONTAINER_VECTOR_BASED);
+  TEST_ASSERT_TRUE(uc_argsort(.container = container, .indices = indices));
+  TEST_ASSERT_EQUAL_UINT32(42, indices[0]);
+
+  container_delete(&container);
+}
+
+/**
+ * @brief Test for the indirect sort in place in the storage of the vector based container.
+ */
+void test_TestCase_5(void)
+{
+  TEST_MESSAGE("[SORT]: Indirect sort in the vector storage");
+
+  container_t *container = create(CONTAINER_VECTOR_BASED);
+  const void *storage = container_cdata(container);
+
+  /* Only the indices are allocated, the elements aren`t copied out of the storage */
+  allocated = 0;
+  allocation_cb_register(counting_allocate);
+  TEST_ASSERT_TRUE(uc_sort(.container = container, .sort = UC_TIM_SORT, .cmp = weight_compare, .indirect = true));
+  allocation_cb_register(malloc);
+
+  TEST_ASSERT_TRUE(allocated < INPUT_SIZE * sizeof(record_t) / 4);
+  TEST_ASSERT_TRUE(storage == container_cdata(container));
+
+  TEST_ASSERT_TRUE(uc_to_array(container, indirect, INPUT_SIZE));
+  for (size_t i = 1; i < INPUT_SIZE; i++)
+  {
+    TEST_ASSERT_TRUE(indirect[i - 1].weight <= indirect[i].weight);
+    TEST_ASSERT_EQUAL_UINT8((uint8_t)(indirect[i].id & 0xFF), indirect[i].payload[0]);
+  }
+
+  container_delete(&container);
+}
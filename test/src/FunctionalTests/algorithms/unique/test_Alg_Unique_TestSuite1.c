@@ -0,0 +1,256 @@
+/**
+ * @file    test_Alg_Unique_TestSuite1.c
+ * @author  Aliaksander Kavalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Tests for the 'unique' function.
+ *
+ * This file contains a series of tests to verify that:
+ * - The hash method keeps the first copy of every element in the original order.
+ * - The sort method leaves the sorted distinct elements.
+ * - The adjacent method removes only the adjacent duplicates.
+ * - The containers with less than two elements aren`t changed.
+ * - The views are refused and their parents aren`t changed.
+ * Every test is executed for all container types.
+ *
+ * @date 2023-10-14
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "unity.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "algorithms/transformation/uc_transformation.h"
+#include "algorithms/unique/uc_unique.h"
+#include "core/container.h"
+#include "interface/allocator_if.h"
+//_____ C O N F I G S  ________________________________________________________
+#define INPUT_SIZE 500
+//_____ D E F I N I T I O N S _________________________________________________
+typedef struct
+{
+  uint16_t id;
+  uint8_t tag;
+} record_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+static const container_type_e types[4] = {
+  CONTAINER_LINKED_LIST_BASED, CONTAINER_VECTOR_BASED, CONTAINER_UNROLLED_LIST_BASED, CONTAINER_TIERED_VECTOR_BASED};
+static uint32_t input[INPUT_SIZE];
+static uint32_t expected[INPUT_SIZE];
+static uint32_t output[INPUT_SIZE];
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+static int ascending(const void *data1, const void *data2)
+{
+  return memcmp(data1, data2, sizeof(uint32_t));
+}
+
+static void prepare(void)
+{
+  for (size_t i = 0; i < INPUT_SIZE; i++)
+  {
+    input[i] = (uint32_t)((i * 7919u) % 97u) * 1000003u;
+  }
+}
+
+/* Keeps the first copy of every element of `input`, returns the number of the kept elements */
+static size_t first_copies(void)
+{
+  size_t count = 0;
+  for (size_t i = 0; i < INPUT_SIZE; i++)
+  {
+    bool seen = false;
+    for (size_t j = 0; j < count && !seen; j++)
+    {
+      seen = (expected[j] == input[i]);
+    }
+
+    if (!seen)
+    {
+      expected[count++] = input[i];
+    }
+  }
+
+  return count;
+}
+
+static container_t *create(container_type_e type)
+{
+  container_t *container = container_create(sizeof(uint32_t), type);
+  TEST_ASSERT_NOT_NULL(container);
+  TEST_ASSERT_TRUE(uc_from_array(container, input, INPUT_SIZE));
+
+  return container;
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+void setUp(void)
+{
+  prepare();
+}
+
+void tearDown(void)
+{
+}
+
+void test_init(void)
+{
+  TEST_MESSAGE("Unique Tests");
+}
+
+/**
+ * @brief Test for the hash method.
+ */
+void test_TestCase_1(void)
+{
+  TEST_MESSAGE("[UNIQUE]: Hash method keeps the first copies in order");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    size_t count = first_copies();
+    container_t *container = create(types[t]);
+
+    TEST_ASSERT_TRUE(uc_unique(.container = container));
+    TEST_ASSERT_EQUAL_size_t(count, container_size(container));
+    TEST_ASSERT_TRUE(uc_to_array(container, output, count));
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(expected, output, count);
+
+    /* The second call doesn`t change anything */
+    TEST_ASSERT_TRUE(uc_unique(.container = container, .method = UC_HASH_UNIQUE));
+    TEST_ASSERT_EQUAL_size_t(count, container_size(container));
+
+    container_delete(&container);
+  }
+}
+
+/**
+ * @brief Test for the sort method.
+ */
+void test_TestCase_2(void)
+{
+  TEST_MESSAGE("[UNIQUE]: Sort method leaves sorted distinct elements");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    size_t count = first_copies();
+    qsort(expected, count, sizeof(uint32_t), ascending);
+    container_t *container = create(types[t]);
+
+    TEST_ASSERT_TRUE(uc_unique(.container = container, .method = UC_SORT_UNIQUE));
+    TEST_ASSERT_EQUAL_size_t(count, container_size(container));
+    TEST_ASSERT_TRUE(uc_to_array(container, output, count));
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(expected, output, count);
+
+    container_delete(&container);
+  }
+}
+
+/**
+ * @brief Test for the adjacent method.
+ */
+void test_TestCase_3(void)
+{
+  const uint32_t values[] = {1, 1, 2, 1, 3, 3, 3, 2, 2, 1};
+  const uint32_t adjacent[] = {1, 2, 1, 3, 2, 1};
+
+  TEST_MESSAGE("[UNIQUE]: Adjacent method removes only adjacent duplicates");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    container_t *container = container_create(sizeof(uint32_t), types[t]);
+    TEST_ASSERT_TRUE(uc_from_array(container, values, sizeof(values) / sizeof(values[0])));
+
+    TEST_ASSERT_TRUE(uc_unique(.container = container, .method = UC_ADJACENT_UNIQUE));
+    TEST_ASSERT_EQUAL_size_t(sizeof(adjacent) / sizeof(adjacent[0]), container_size(container));
+    TEST_ASSERT_TRUE(uc_to_array(container, output, sizeof(adjacent) / sizeof(adjacent[0])));
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(adjacent, output, sizeof(adjacent) / sizeof(adjacent[0]));
+
+    container_delete(&container);
+  }
+}
+
+/**
+ * @brief Test for the structures compared byte by byte and for the small containers.
+ */
+void test_TestCase_4(void)
+{
+  TEST_MESSAGE("[UNIQUE]: Structures and small containers");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    container_t *container = container_create(sizeof(record_t), types[t]);
+
+    for (size_t m = 0; m < UC_LAST_TYPE_UNIQUE; m++)
+    {
+      TEST_ASSERT_TRUE(uc_unique(.container = container, .method = (ContainerUniqueTypes_e)m));
+      TEST_ASSERT_EQUAL_size_t(0, container_size(container));
+    }
+
+    record_t record;
+    memset(&record, 0, sizeof(record));
+    record.id = 7;
+    TEST_ASSERT_TRUE(container_push_back(container, &record));
+    TEST_ASSERT_TRUE(uc_unique(.container = container));
+    TEST_ASSERT_EQUAL_size_t(1, container_size(container));
+
+    for (size_t i = 0; i < 20; i++)
+    {
+      record.id = (uint16_t)(i % 4);
+      record.tag = (uint8_t)(i % 2);
+      TEST_ASSERT_TRUE(container_push_back(container, &record));
+    }
+
+    /* {7,0} and the pairs {id, tag}: 0,0 1,1 2,0 3,1 */
+    TEST_ASSERT_TRUE(uc_unique(.container = container, .method = UC_SORT_UNIQUE));
+    TEST_ASSERT_EQUAL_size_t(5, container_size(container));
+
+    container_delete(&container);
+  }
+}
+
+/**
+ * @brief Test for the views: the elements can`t be erased through the view, so the parent isn`t changed.
+ */
+void test_TestCase_5(void)
+{
+  const uint32_t values[] = {1, 9, 8, 7, 6, 5, 4, 3, 4, 3, 2, 1};
+  const size_t size = sizeof(values) / sizeof(values[0]);
+  const container_view_mode_e modes[2] = {CONTAINER_VIEW_READ_ONLY, CONTAINER_VIEW_MUTABLE};
+
+  TEST_MESSAGE("[UNIQUE]: Views are refused");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    container_t *container = container_create(sizeof(uint32_t), types[t]);
+    TEST_ASSERT_TRUE(uc_from_array(container, values, size));
+
+    for (size_t v = 0; v < 2; v++)
+    {
+      for (size_t m = 0; m < UC_LAST_TYPE_UNIQUE; m++)
+      {
+        uc_view_t *view = container_view(container, 1, size - 2, modes[v]);
+        TEST_ASSERT_NOT_NULL(view);
+
+        TEST_ASSERT_FALSE(uc_unique(.container = view, .method = (ContainerUniqueTypes_e)m));
+        TEST_ASSERT_EQUAL_size_t(size - 2, container_size(view));
+
+        container_delete(&view);
+
+        TEST_ASSERT_EQUAL_size_t(size, container_size(container));
+        TEST_ASSERT_TRUE(uc_to_array(container, output, size));
+        TEST_ASSERT_EQUAL_UINT32_ARRAY(values, output, size);
+      }
+    }
+
+    /* The cursor can`t erase the elements through the view either */
+    uc_view_t *view = container_view(container, 0, size, CONTAINER_VIEW_MUTABLE);
+    container_cursor_t cursor = container_cursor(view, 0);
+    TEST_ASSERT_FALSE(container_cursor_erase(&cursor));
+    TEST_ASSERT_TRUE(container_cursor_valid(&cursor));
+    container_delete(&view);
+    TEST_ASSERT_EQUAL_size_t(size, container_size(container));
+
+    container_delete(&container);
+  }
+}
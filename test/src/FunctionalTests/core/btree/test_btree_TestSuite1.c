@@ -0,0 +1,297 @@
+/**
+ * @file    test_btree_TestSuite1.c
+ * @author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Set of tests for the B+ tree: ordered map and ordered set.
+ * @date    2023-10-16
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "unity.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "core/btree/btree.h"
+#include "interface/allocator_if.h"
+
+//_____ C O N F I G S  ________________________________________________________
+#define INPUT_SIZE 10000
+#define KEY_RANGE  3000
+#define STEPS      60000
+//_____ D E F I N I T I O N S _________________________________________________
+/* The large value makes the leaves small, so the tree is high */
+typedef struct
+{
+  uint32_t key;
+  uint8_t payload[200];
+} record_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+static btree_t *tree = NULL;
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+static cmp_t compare(const void *data1, const void *data2, size_t esize)
+{
+  int32_t value1 = *(const int32_t *)data1;
+  int32_t value2 = *(const int32_t *)data2;
+
+  return (value1 > value2) ? GT : ((value1 < value2) ? LE : EQ);
+}
+
+static uint32_t next_random(uint32_t *seed)
+{
+  *seed = *seed * 1103515245u + 12345u;
+  return *seed >> 8;
+}
+
+/* The keys walked by the cursors in both directions are equal to the present keys of the model */
+static void check_order(const bool *present, const int32_t *values, size_t range)
+{
+  size_t count = 0;
+  btree_cursor_t cursor = btree_first(tree);
+
+  for (size_t key = 0; key < range; key++)
+  {
+    if (present[key])
+    {
+      TEST_ASSERT_TRUE(btree_cursor_valid(&cursor));
+      TEST_ASSERT_EQUAL_INT32((int32_t)key, *(const int32_t *)btree_cursor_key(&cursor));
+      TEST_ASSERT_EQUAL_INT32(values[key], *(const int32_t *)btree_cursor_value(&cursor));
+      btree_cursor_next(&cursor);
+      count++;
+    }
+  }
+  TEST_ASSERT_FALSE(btree_cursor_valid(&cursor));
+  TEST_ASSERT_EQUAL_UINT32(count, btree_size(tree));
+
+  cursor = btree_last(tree);
+  for (size_t key = range; key > 0; key--)
+  {
+    if (present[key - 1])
+    {
+      TEST_ASSERT_EQUAL_INT32((int32_t)(key - 1), *(const int32_t *)btree_cursor_key(&cursor));
+      btree_cursor_prev(&cursor);
+    }
+  }
+  TEST_ASSERT_FALSE(btree_cursor_valid(&cursor));
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+  if (NULL != tree)
+  {
+    btree_delete(&tree);
+  }
+}
+
+void test_init(void)
+{
+  TEST_MESSAGE("B+ Tree Tests");
+}
+
+/**
+ * @brief Insertion, lookup and ordered walk of the map.
+ */
+void test_TestCase_1(void)
+{
+  static bool present[INPUT_SIZE];
+  static int32_t values[INPUT_SIZE];
+
+  TEST_MESSAGE("[BTREE]: Insert and find");
+
+  tree = btree_create(sizeof(int32_t), sizeof(int32_t), compare);
+  TEST_ASSERT_NOT_NULL(tree);
+  TEST_ASSERT_FALSE(btree_cursor_valid(&(btree_cursor_t){0}));
+  btree_cursor_t cursor = btree_first(tree);
+  TEST_ASSERT_FALSE(btree_cursor_valid(&cursor));
+
+  for (size_t i = 0; i < INPUT_SIZE; i++)
+  {
+    int32_t key = (int32_t)((i * 7919u) % INPUT_SIZE);
+    int32_t value = -key;
+    bool inserted = false;
+
+    int32_t *slot = (int32_t *)btree_emplace(tree, &key, &inserted);
+    TEST_ASSERT_NOT_NULL(slot);
+    TEST_ASSERT_TRUE(inserted);
+    TEST_ASSERT_EQUAL_INT32(0, *slot);
+    TEST_ASSERT_TRUE(btree_insert(tree, &key, &value));
+    present[key] = true;
+    values[key] = value;
+  }
+  TEST_ASSERT_EQUAL_UINT32(INPUT_SIZE, btree_size(tree));
+
+  for (int32_t key = -1; key <= INPUT_SIZE; key++)
+  {
+    const int32_t *value = (const int32_t *)btree_find(tree, &key);
+    if (key < 0 || key >= INPUT_SIZE)
+    {
+      TEST_ASSERT_NULL(value);
+      TEST_ASSERT_FALSE(btree_contains(tree, &key));
+    }
+    else
+    {
+      TEST_ASSERT_NOT_NULL(value);
+      TEST_ASSERT_EQUAL_INT32(-key, *value);
+    }
+  }
+
+  /* The insertion of the present key replaces the value */
+  int32_t key = 5;
+  int32_t value = 55;
+  bool inserted = true;
+  TEST_ASSERT_TRUE(btree_insert(tree, &key, &value));
+  TEST_ASSERT_EQUAL_INT32(55, *(int32_t *)btree_emplace(tree, &key, &inserted));
+  TEST_ASSERT_FALSE(inserted);
+  values[key] = value;
+  TEST_ASSERT_EQUAL_UINT32(INPUT_SIZE, btree_size(tree));
+
+  check_order(present, values, INPUT_SIZE);
+}
+
+/**
+ * @brief Random insertions and erasures compared with the simple model.
+ */
+void test_TestCase_2(void)
+{
+  static bool present[KEY_RANGE];
+  static int32_t values[KEY_RANGE];
+  const size_t value_sizes[2] = {sizeof(int32_t), sizeof(record_t)};
+
+  TEST_MESSAGE("[BTREE]: Random insert and erase");
+
+  for (size_t v = 0; v < 2; v++)
+  {
+    uint32_t seed = 11 + (uint32_t)v;
+    memset(present, 0, sizeof(present));
+
+    tree = btree_create(sizeof(int32_t), value_sizes[v], compare);
+
+    for (size_t step = 0; step < STEPS; step++)
+    {
+      int32_t key = (int32_t)(next_random(&seed) % KEY_RANGE);
+      record_t record = {.key = (uint32_t)step};
+
+      /* The erasures prevail in the second half, so the tree shrinks down to the empty one */
+      if (next_random(&seed) % 8 < ((step < STEPS / 2) ? 5u : 2u))
+      {
+        TEST_ASSERT_TRUE(btree_insert(tree, &key, &record));
+        present[key] = true;
+        values[key] = (int32_t)step;
+      }
+      else
+      {
+        TEST_ASSERT_EQUAL(present[key], btree_erase(tree, &key));
+        TEST_ASSERT_FALSE(btree_erase(tree, &key));
+        present[key] = false;
+      }
+
+      if (0 == step % 5000)
+      {
+        check_order(present, values, KEY_RANGE);
+      }
+    }
+
+    check_order(present, values, KEY_RANGE);
+
+    for (int32_t key = 0; key < KEY_RANGE; key++)
+    {
+      TEST_ASSERT_EQUAL(present[key], btree_erase(tree, &key));
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, btree_size(tree));
+    btree_cursor_t cursor = btree_last(tree);
+    TEST_ASSERT_FALSE(btree_cursor_valid(&cursor));
+
+    btree_delete(&tree);
+  }
+}
+
+/**
+ * @brief Range queries by the lower and the upper bounds.
+ */
+void test_TestCase_3(void)
+{
+  TEST_MESSAGE("[BTREE]: Range iteration");
+
+  tree = btree_create(sizeof(int32_t), 0, compare);
+
+  /* The set of the even keys [0, 2 * INPUT_SIZE) */
+  for (int32_t i = INPUT_SIZE - 1; i >= 0; i--)
+  {
+    int32_t key = 2 * i;
+    TEST_ASSERT_TRUE(btree_insert(tree, &key, NULL));
+  }
+
+  for (int32_t first = -3; first < 2 * INPUT_SIZE + 3; first += 97)
+  {
+    int32_t last = first + 301;
+    int32_t expected = (first <= 0) ? 0 : ((first + 1) / 2 * 2);
+    btree_cursor_t cursor = btree_lower_bound(tree, &first);
+
+    for (; btree_cursor_valid(&cursor) && *(const int32_t *)btree_cursor_key(&cursor) < last; btree_cursor_next(&cursor))
+    {
+      TEST_ASSERT_EQUAL_INT32(expected, *(const int32_t *)btree_cursor_key(&cursor));
+      TEST_ASSERT_NULL(btree_cursor_value(&cursor));
+      expected += 2;
+    }
+    TEST_ASSERT_TRUE(expected >= last || expected >= 2 * INPUT_SIZE);
+  }
+
+  int32_t key = 10;
+  btree_cursor_t cursor = btree_upper_bound(tree, &key);
+  TEST_ASSERT_EQUAL_INT32(12, *(const int32_t *)btree_cursor_key(&cursor));
+  cursor = btree_lower_bound(tree, &key);
+  TEST_ASSERT_EQUAL_INT32(10, *(const int32_t *)btree_cursor_key(&cursor));
+  key = 11;
+  cursor = btree_upper_bound(tree, &key);
+  TEST_ASSERT_EQUAL_INT32(12, *(const int32_t *)btree_cursor_key(&cursor));
+
+  /* The ordered set returns the key instead of the value */
+  TEST_ASSERT_EQUAL_INT32(12, *(const int32_t *)btree_find(tree, &(int32_t){12}));
+
+  key = 2 * INPUT_SIZE - 2;
+  cursor = btree_upper_bound(tree, &key);
+  TEST_ASSERT_FALSE(btree_cursor_valid(&cursor));
+  TEST_ASSERT_NULL(btree_cursor_key(&cursor));
+  TEST_ASSERT_FALSE(btree_cursor_next(&cursor));
+
+  btree_clear(tree);
+  TEST_ASSERT_EQUAL_UINT32(0, btree_size(tree));
+  cursor = btree_lower_bound(tree, &key);
+  TEST_ASSERT_FALSE(btree_cursor_valid(&cursor));
+  TEST_ASSERT_NULL(btree_find(tree, &key));
+  TEST_ASSERT_FALSE(btree_erase(tree, &key));
+}
+
+/**
+ * @brief Keys compared byte by byte when the comparison callback isn`t set.
+ */
+void test_TestCase_4(void)
+{
+  const char *names[] = {"delta", "alpha", "echo", "charlie", "bravo"};
+  const char *sorted[] = {"alpha", "bravo", "charlie", "delta", "echo"};
+  char key[8];
+
+  TEST_MESSAGE("[BTREE]: Default comparison");
+
+  tree = btree_create(sizeof(key), sizeof(uint32_t), NULL);
+
+  for (uint32_t i = 0; i < 5; i++)
+  {
+    memset(key, 0, sizeof(key));
+    strcpy(key, names[i]);
+    TEST_ASSERT_TRUE(btree_insert(tree, key, &i));
+  }
+
+  btree_cursor_t cursor = btree_first(tree);
+  for (size_t i = 0; i < 5; i++, btree_cursor_next(&cursor))
+  {
+    TEST_ASSERT_EQUAL_STRING(sorted[i], (const char *)btree_cursor_key(&cursor));
+  }
+  TEST_ASSERT_FALSE(btree_cursor_valid(&cursor));
+}
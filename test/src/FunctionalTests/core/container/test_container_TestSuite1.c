@@ -32,7 +32,7 @@ void setUp(void)
 
 void tearDown(void)
 {
-  container_delete((container_t**)container);
+  container_delete(&container);
 }
 
 void test_init(void)
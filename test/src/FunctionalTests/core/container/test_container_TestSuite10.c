@@ -0,0 +1,230 @@
+/**
+ * @file    test_container_TestSuite10.c
+ * @author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Set of tests for the reverse, rotate and fill API of the Container. Each test is executed
+ *          for the Linked List, Vector, Unrolled List and Tiered Vector based containers and for several element sizes.
+ * @date    2023-01-14
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "unity.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "container.h"
+#include "interface/allocator_if.h"
+#include "linked_list.h"
+#include "vector.h"
+
+//_____ C O N F I G S  ________________________________________________________
+#define INPUT_SIZE 37
+#define MAX_ESIZE  24
+//_____ D E F I N I T I O N S _________________________________________________
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+static const container_type_e types[4] = {
+  CONTAINER_LINKED_LIST_BASED, CONTAINER_VECTOR_BASED, CONTAINER_UNROLLED_LIST_BASED, CONTAINER_TIERED_VECTOR_BASED};
+static const size_t esizes[7] = {1, 2, 4, 8, 3, 12, MAX_ESIZE};
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+/* Every byte of the element depends on the index of the element, so any misplaced byte is detected */
+static void make_element(uint8_t *element, size_t esize, size_t index)
+{
+  for (size_t b = 0; b < esize; b++)
+  {
+    element[b] = (uint8_t)(index * 31u + b * 7u + 1u);
+  }
+}
+
+static container_t *create(container_type_e type, size_t esize, size_t size)
+{
+  uint8_t element[MAX_ESIZE];
+  container_t *container = container_create(esize, type);
+  TEST_ASSERT_NOT_NULL(container);
+
+  for (size_t i = 0; i < size; i++)
+  {
+    make_element(element, esize, i);
+    TEST_ASSERT_TRUE(container_push_back(container, element));
+  }
+
+  return container;
+}
+
+/* Checks that the element at the position `i` is the original element with the index `origin(i)` */
+static void check_order(container_t *container, size_t esize, size_t size, size_t (*origin)(size_t i, size_t size, size_t k), size_t k)
+{
+  uint8_t expected[MAX_ESIZE];
+  uint8_t output[MAX_ESIZE];
+
+  TEST_ASSERT_EQUAL_UINT32(size, container_size(container));
+  for (size_t i = 0; i < size; i++)
+  {
+    make_element(expected, esize, origin(i, size, k));
+    TEST_ASSERT_TRUE(container_at(container, output, i));
+    TEST_ASSERT_EQUAL_MEMORY(expected, output, esize);
+  }
+}
+
+static size_t reversed(size_t i, size_t size, size_t k)
+{
+  return size - 1 - i;
+}
+
+static size_t rotated(size_t i, size_t size, size_t k)
+{
+  return (i + k) % size;
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_init(void)
+{
+  TEST_MESSAGE("Container Reverse, Rotate and Fill Tests");
+}
+
+/**
+ * @brief The test verifies reverse of the container.
+ */
+void test_TestCase_1(void)
+{
+  TEST_MESSAGE("[CONTAINER_TEST]: reverse");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    for (size_t e = 0; e < sizeof(esizes) / sizeof(esizes[0]); e++)
+    {
+      for (size_t size = 0; size <= INPUT_SIZE; size++)
+      {
+        container_t *container = create(types[t], esizes[e], size);
+
+        TEST_ASSERT_TRUE(container_reverse(container));
+        check_order(container, esizes[e], size, reversed, 0);
+
+        container_delete(&container);
+      }
+    }
+  }
+}
+
+/**
+ * @brief The test verifies rotate of the container by every number of positions.
+ */
+void test_TestCase_2(void)
+{
+  TEST_MESSAGE("[CONTAINER_TEST]: rotate");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    for (size_t e = 0; e < sizeof(esizes) / sizeof(esizes[0]); e++)
+    {
+      for (size_t size = 1; size <= INPUT_SIZE; size += 4)
+      {
+        for (size_t k = 0; k <= size + 2; k++)
+        {
+          container_t *container = create(types[t], esizes[e], size);
+
+          TEST_ASSERT_TRUE(container_rotate(container, k));
+          check_order(container, esizes[e], size, rotated, k % size);
+
+          container_delete(&container);
+        }
+      }
+    }
+
+    container_t *container = create(types[t], sizeof(uint32_t), 0);
+    TEST_ASSERT_TRUE(container_rotate(container, 3));
+    TEST_ASSERT_EQUAL_UINT32(0, container_size(container));
+    container_delete(&container);
+  }
+}
+
+/**
+ * @brief The test verifies that the linked list based container keeps the nodes and consistent links.
+ */
+void test_TestCase_3(void)
+{
+  TEST_MESSAGE("[CONTAINER_TEST]: reverse and rotate of the list relink nodes");
+
+  container_t *container = create(CONTAINER_LINKED_LIST_BASED, sizeof(uint32_t), INPUT_SIZE);
+  void *first = container_peek(container, 0);
+  void *last = container_peek(container, INPUT_SIZE - 1);
+
+  TEST_ASSERT_TRUE(container_reverse(container));
+  TEST_ASSERT_EQUAL_PTR(last, container_peek(container, 0));
+  TEST_ASSERT_EQUAL_PTR(first, container_peek(container, INPUT_SIZE - 1));
+
+  TEST_ASSERT_TRUE(container_rotate(container, 1));
+  TEST_ASSERT_EQUAL_PTR(last, container_peek(container, INPUT_SIZE - 1));
+
+  /* Both ends are still valid */
+  uint8_t expected[sizeof(uint32_t)];
+  uint32_t output = 0;
+  make_element(expected, sizeof(uint32_t), INPUT_SIZE - 1);
+  TEST_ASSERT_TRUE(container_pop_back(container, &output));
+  TEST_ASSERT_EQUAL_MEMORY(expected, &output, sizeof(output));
+  make_element(expected, sizeof(uint32_t), INPUT_SIZE - 2);
+  TEST_ASSERT_TRUE(container_pop_front(container, &output));
+  TEST_ASSERT_EQUAL_MEMORY(expected, &output, sizeof(output));
+  TEST_ASSERT_TRUE(container_push_back(container, &output));
+  TEST_ASSERT_TRUE(container_push_front(container, &output));
+  TEST_ASSERT_EQUAL_UINT32(INPUT_SIZE, container_size(container));
+
+  container_delete(&container);
+}
+
+/**
+ * @brief The test verifies fill of the ranges of the container.
+ */
+void test_TestCase_4(void)
+{
+  uint8_t value[MAX_ESIZE];
+  uint8_t expected[MAX_ESIZE];
+  uint8_t output[MAX_ESIZE];
+
+  TEST_MESSAGE("[CONTAINER_TEST]: fill");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    for (size_t e = 0; e < sizeof(esizes) / sizeof(esizes[0]); e++)
+    {
+      size_t esize = esizes[e];
+      memset(value, 0xEE, esize);
+
+      for (size_t first = 0; first <= INPUT_SIZE; first += 6)
+      {
+        for (size_t count = 0; first + count <= INPUT_SIZE; count += 5)
+        {
+          container_t *container = create(types[t], esize, INPUT_SIZE);
+
+          TEST_ASSERT_TRUE(container_fill(container, first, count, value));
+          for (size_t i = 0; i < INPUT_SIZE; i++)
+          {
+            make_element(expected, esize, i);
+            TEST_ASSERT_TRUE(container_at(container, output, i));
+            TEST_ASSERT_EQUAL_MEMORY((i >= first && i < first + count) ? value : expected, output, esize);
+          }
+
+          container_delete(&container);
+        }
+      }
+
+      /* The range out of the container */
+      container_t *container = create(types[t], esize, INPUT_SIZE);
+      TEST_ASSERT_FALSE(container_fill(container, INPUT_SIZE - 1, 2, value));
+      TEST_ASSERT_FALSE(container_fill(container, INPUT_SIZE + 1, 0, value));
+      TEST_ASSERT_TRUE(container_fill(container, 0, INPUT_SIZE, value));
+      TEST_ASSERT_TRUE(container_at(container, output, INPUT_SIZE - 1));
+      TEST_ASSERT_EQUAL_MEMORY(value, output, esize);
+      container_delete(&container);
+    }
+  }
+}
@@ -0,0 +1,289 @@
+/**
+ * @file    test_container_TestSuite11.c
+ * @author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Set of tests for the views of the Container. Each test is executed
+ *          for the Linked List, Vector, Unrolled List and Tiered Vector based containers.
+ * @date    2023-01-14
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "unity.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "algorithms/equal/uc_equal.h"
+#include "algorithms/find/uc_find.h"
+#include "algorithms/select/uc_select.h"
+#include "algorithms/sort/uc_sort.h"
+#include "algorithms/transformation/uc_transformation.h"
+#include "algorithms/unique/uc_unique.h"
+#include "container.h"
+#include "interface/allocator_if.h"
+#include "linked_list.h"
+#include "vector.h"
+
+//_____ C O N F I G S  ________________________________________________________
+#define INPUT_SIZE 40
+#define VIEW_FIRST 10
+#define VIEW_SIZE  20
+//_____ D E F I N I T I O N S _________________________________________________
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+static container_t *containers[4] = {NULL, NULL, NULL, NULL};
+static const container_type_e types[4] = {
+  CONTAINER_LINKED_LIST_BASED, CONTAINER_VECTOR_BASED, CONTAINER_UNROLLED_LIST_BASED, CONTAINER_TIERED_VECTOR_BASED};
+static uint32_t input[INPUT_SIZE];
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+static void check_parent(container_t *container)
+{
+  uint32_t output[INPUT_SIZE];
+
+  TEST_ASSERT_EQUAL_UINT32(INPUT_SIZE, container_size(container));
+  TEST_ASSERT_TRUE(uc_to_array(container, output, INPUT_SIZE));
+  TEST_ASSERT_EQUAL_UINT32_ARRAY(input, output, INPUT_SIZE);
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+void setUp(void)
+{
+  for (size_t i = 0; i < INPUT_SIZE; i++)
+  {
+    input[i] = (uint32_t)((i * 7919u) % 101u);
+  }
+
+  for (size_t i = 0; i < 4; i++)
+  {
+    containers[i] = container_create(sizeof(uint32_t), types[i]);
+    TEST_ASSERT_TRUE(uc_from_array(containers[i], input, INPUT_SIZE));
+  }
+}
+
+void tearDown(void)
+{
+  for (size_t i = 0; i < 4; i++)
+  {
+    container_delete(&containers[i]);
+  }
+}
+
+void test_init(void)
+{
+  TEST_MESSAGE("Container View Tests");
+}
+
+/**
+ * @brief The test verifies read access through the read-only view.
+ */
+void test_TestCase_1(void)
+{
+  TEST_MESSAGE("[CONTAINER_TEST]: read-only view");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    uc_view_t *view = container_view(containers[t], VIEW_FIRST, VIEW_SIZE, CONTAINER_VIEW_READ_ONLY);
+    TEST_ASSERT_NOT_NULL(view);
+    TEST_ASSERT_TRUE(container_is_view(view));
+    TEST_ASSERT_FALSE(container_is_view(containers[t]));
+    TEST_ASSERT_EQUAL_UINT32(VIEW_SIZE, container_size(view));
+    TEST_ASSERT_EQUAL_UINT32(sizeof(uint32_t), container_esize(view));
+
+    /* The view references the elements of the parent, but gives no writable pointers to them */
+    TEST_ASSERT_EQUAL_PTR(container_peek(containers[t], VIEW_FIRST), container_cpeek(view, 0));
+    TEST_ASSERT_NULL(container_peek(view, 0));
+    TEST_ASSERT_NULL(container_data(view));
+    if (CONTAINER_VECTOR_BASED == types[t])
+    {
+      TEST_ASSERT_EQUAL_PTR(container_peek(containers[t], VIEW_FIRST), container_cdata(view));
+    }
+    else
+    {
+      TEST_ASSERT_NULL(container_cdata(view));
+    }
+
+    uint32_t output = 0;
+    for (size_t i = 0; i < VIEW_SIZE; i++)
+    {
+      TEST_ASSERT_TRUE(container_at(view, &output, i));
+      TEST_ASSERT_EQUAL_UINT32(input[VIEW_FIRST + i], output);
+    }
+    TEST_ASSERT_FALSE(container_at(view, &output, VIEW_SIZE));
+
+    size_t visited = 0;
+    for (container_cursor_t cursor = container_cursor(view, 0); container_cursor_valid(&cursor); container_cursor_next(&cursor))
+    {
+      TEST_ASSERT_NULL(container_cursor_data(&cursor));
+      TEST_ASSERT_EQUAL_UINT32(input[VIEW_FIRST + visited], *(const uint32_t *)container_cursor_cdata(&cursor));
+      visited++;
+    }
+    TEST_ASSERT_EQUAL_UINT32(VIEW_SIZE, visited);
+
+    /* The view can`t change the parent */
+    uint32_t value = 0xAA;
+    TEST_ASSERT_FALSE(container_push_back(view, &value));
+    TEST_ASSERT_FALSE(container_push_front(view, &value));
+    TEST_ASSERT_FALSE(container_insert(view, &value, 1));
+    TEST_ASSERT_FALSE(container_erase(view, 1));
+    TEST_ASSERT_FALSE(container_pop_back(view, &value));
+    TEST_ASSERT_FALSE(container_replace(view, &value, 1));
+    TEST_ASSERT_FALSE(container_fill(view, 0, 1, &value));
+    TEST_ASSERT_FALSE(container_splice(containers[t], 0, view));
+    TEST_ASSERT_EQUAL_UINT32(VIEW_SIZE, container_size(view));
+    check_parent(containers[t]);
+
+    container_delete(&view);
+    check_parent(containers[t]);
+  }
+}
+
+/**
+ * @brief The test verifies that the algorithms accept the views.
+ */
+void test_TestCase_2(void)
+{
+  TEST_MESSAGE("[CONTAINER_TEST]: algorithms over view");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    uc_view_t *view = container_view(containers[t], VIEW_FIRST, VIEW_SIZE, CONTAINER_VIEW_READ_ONLY);
+    container_t *copy = container_create(sizeof(uint32_t), types[(t + 1) % 4]);
+    TEST_ASSERT_TRUE(uc_from_array(copy, &input[VIEW_FIRST], VIEW_SIZE));
+
+    TEST_ASSERT_TRUE(uc_equal(.container1 = view, .container2 = copy));
+    TEST_ASSERT_FALSE(uc_equal(.container1 = view, .container2 = containers[t]));
+
+    /* The elements out of the window aren`t found */
+    TEST_ASSERT_EQUAL_UINT32(3, uc_find(.container = view, .value = &input[VIEW_FIRST + 3]));
+    TEST_ASSERT_FALSE(uc_contains(.container = view, .value = &input[0]));
+    TEST_ASSERT_EQUAL_UINT32(VIEW_SIZE, uc_find(.container = view, .value = &input[INPUT_SIZE - 1]));
+
+    /* The view of the view */
+    uc_view_t *inner = container_view(view, 2, 5, CONTAINER_VIEW_READ_ONLY);
+    TEST_ASSERT_NOT_NULL(inner);
+    uint32_t output = 0;
+    TEST_ASSERT_TRUE(container_at(inner, &output, 4));
+    TEST_ASSERT_EQUAL_UINT32(input[VIEW_FIRST + 6], output);
+    TEST_ASSERT_NULL(container_view(view, 2, VIEW_SIZE, CONTAINER_VIEW_READ_ONLY));
+    TEST_ASSERT_NULL(container_view(view, 2, 5, CONTAINER_VIEW_MUTABLE));
+
+    /* The clone of the view owns the copy of the elements */
+    container_t *clone = container_clone(inner, CONTAINER_COPY_SHALLOW, NULL);
+    TEST_ASSERT_NOT_NULL(clone);
+    TEST_ASSERT_FALSE(container_is_view(clone));
+    TEST_ASSERT_TRUE(uc_equal(.container1 = clone, .container2 = inner));
+    TEST_ASSERT_TRUE(container_push_back(clone, &output));
+
+    container_delete(&clone);
+    container_delete(&inner);
+    container_delete(&view);
+    container_delete(&copy);
+    check_parent(containers[t]);
+  }
+}
+
+/**
+ * @brief The test verifies changes of the elements through the mutable view.
+ */
+void test_TestCase_3(void)
+{
+  uint32_t output[INPUT_SIZE];
+
+  TEST_MESSAGE("[CONTAINER_TEST]: mutable view");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    uc_view_t *view = container_view(containers[t], VIEW_FIRST, VIEW_SIZE, CONTAINER_VIEW_MUTABLE);
+    TEST_ASSERT_NOT_NULL(view);
+
+    TEST_ASSERT_TRUE(uc_sort(.container = view, .sort = UC_TIM_SORT, .key = UC_KEY_U32));
+    TEST_ASSERT_EQUAL_UINT32(VIEW_SIZE, container_size(view));
+    TEST_ASSERT_FALSE(container_push_back(view, &output[0]));
+
+    /* Only the window of the parent is sorted */
+    TEST_ASSERT_TRUE(uc_to_array(containers[t], output, INPUT_SIZE));
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(input, output, VIEW_FIRST);
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(&input[VIEW_FIRST + VIEW_SIZE], &output[VIEW_FIRST + VIEW_SIZE], INPUT_SIZE - VIEW_FIRST - VIEW_SIZE);
+    for (size_t i = VIEW_FIRST + 1; i < VIEW_FIRST + VIEW_SIZE; i++)
+    {
+      TEST_ASSERT_TRUE(output[i - 1] <= output[i]);
+    }
+
+    uint32_t value = 0xAA;
+    TEST_ASSERT_TRUE(container_replace(view, &value, 0));
+    TEST_ASSERT_TRUE(container_fill(view, VIEW_SIZE - 2, 2, &value));
+    TEST_ASSERT_FALSE(container_fill(view, VIEW_SIZE - 2, 3, &value));
+    TEST_ASSERT_TRUE(uc_to_array(containers[t], output, INPUT_SIZE));
+    TEST_ASSERT_EQUAL_UINT32(value, output[VIEW_FIRST]);
+    TEST_ASSERT_EQUAL_UINT32(value, output[VIEW_FIRST + VIEW_SIZE - 1]);
+    TEST_ASSERT_EQUAL_UINT32(input[VIEW_FIRST + VIEW_SIZE], output[VIEW_FIRST + VIEW_SIZE]);
+    TEST_ASSERT_EQUAL_UINT32(3, uc_count(.container = containers[t], .value = &value));
+
+    container_delete(&view);
+    TEST_ASSERT_EQUAL_UINT32(INPUT_SIZE, container_size(containers[t]));
+  }
+}
+
+/**
+ * @brief The test verifies views of the empty ranges and out of the container.
+ */
+void test_TestCase_4(void)
+{
+  TEST_MESSAGE("[CONTAINER_TEST]: empty view and range out of container");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    TEST_ASSERT_NULL(container_view(containers[t], INPUT_SIZE, 1, CONTAINER_VIEW_READ_ONLY));
+    TEST_ASSERT_NULL(container_view(containers[t], INPUT_SIZE + 1, 0, CONTAINER_VIEW_READ_ONLY));
+
+    uc_view_t *view = container_view(containers[t], INPUT_SIZE, 0, CONTAINER_VIEW_MUTABLE);
+    TEST_ASSERT_NOT_NULL(view);
+    TEST_ASSERT_EQUAL_UINT32(0, container_size(view));
+    container_cursor_t cursor = container_cursor(view, 0);
+    TEST_ASSERT_FALSE(container_cursor_valid(&cursor));
+    TEST_ASSERT_TRUE(uc_sort(.container = view));
+
+    uint32_t value = 0;
+    TEST_ASSERT_FALSE(container_push_back(view, &value));
+
+    container_delete(&view);
+    check_parent(containers[t]);
+  }
+}
+
+/**
+ * @brief The test verifies that the algorithms which reorder the elements fail on the read-only view.
+ */
+void test_TestCase_5(void)
+{
+  uint32_t output[VIEW_SIZE];
+
+  TEST_MESSAGE("[CONTAINER_TEST]: mutating algorithms over read-only view");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    uc_view_t *view = container_view(containers[t], VIEW_FIRST, VIEW_SIZE, CONTAINER_VIEW_READ_ONLY);
+    TEST_ASSERT_NOT_NULL(view);
+
+    TEST_ASSERT_FALSE(uc_nth_element(.container = view, .nth = VIEW_SIZE / 2));
+    TEST_ASSERT_FALSE(uc_partial_sort(.container = view, .count = 5));
+    TEST_ASSERT_FALSE(uc_partial_sort(.container = view, .count = 5, .key = UC_KEY_U32));
+    TEST_ASSERT_FALSE(uc_sort(.container = view));
+    TEST_ASSERT_FALSE(uc_sort(.container = view, .sort = UC_TIM_SORT, .key = UC_KEY_U32));
+    TEST_ASSERT_FALSE(uc_sort(.container = view, .indirect = true));
+    TEST_ASSERT_FALSE(uc_unique(.container = view));
+    TEST_ASSERT_EQUAL_UINT32(VIEW_SIZE, container_size(view));
+    check_parent(containers[t]);
+
+    /* The algorithms which only read the elements still work */
+    TEST_ASSERT_TRUE(uc_top_k(.container = view, .output = output, .count = VIEW_SIZE, .key = UC_KEY_U32));
+    for (size_t i = 1; i < VIEW_SIZE; i++)
+    {
+      TEST_ASSERT_TRUE(output[i - 1] <= output[i]);
+    }
+    TEST_ASSERT_EQUAL_UINT32(2, uc_find(.container = view, .value = &input[VIEW_FIRST + 2]));
+
+    container_delete(&view);
+    check_parent(containers[t]);
+  }
+}
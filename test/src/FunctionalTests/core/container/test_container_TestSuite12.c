@@ -0,0 +1,295 @@
+/**
+ * @file    test_container_TestSuite12.c
+ * @author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Set of tests for the hash API of the Container. Each test is executed
+ *          for all container types.
+ * @date    2023-01-14
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "unity.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "algorithms/equal/uc_equal.h"
+#include "algorithms/transformation/uc_transformation.h"
+#include "common/uc_crc.h"
+#include "container.h"
+#include "interface/allocator_if.h"
+#include "linked_list.h"
+#include "vector.h"
+
+//_____ C O N F I G S  ________________________________________________________
+#define INPUT_SIZE 64
+#define STEPS      2000
+//_____ D E F I N I T I O N S _________________________________________________
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+static const container_type_e types[4] = {
+  CONTAINER_LINKED_LIST_BASED, CONTAINER_VECTOR_BASED, CONTAINER_UNROLLED_LIST_BASED, CONTAINER_TIERED_VECTOR_BASED};
+static uint32_t input[INPUT_SIZE];
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+static container_t *create(container_type_e type, const uint32_t *data, size_t size)
+{
+  container_t *container = container_create(sizeof(uint32_t), type);
+  TEST_ASSERT_NOT_NULL(container);
+
+  for (size_t i = 0; i < size; i++)
+  {
+    TEST_ASSERT_TRUE(container_push_back(container, &data[i]));
+  }
+
+  return container;
+}
+
+/* Hash of the untracked container with the same elements */
+static uint64_t reference_hash(const uint32_t *data, size_t size)
+{
+  container_t *container = create(CONTAINER_VECTOR_BASED, data, size);
+  uint64_t hash = container_hash(container);
+  container_delete(&container);
+
+  return hash;
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+void setUp(void)
+{
+  for (size_t i = 0; i < INPUT_SIZE; i++)
+  {
+    input[i] = (uint32_t)(i * 2654435761u);
+  }
+}
+
+void tearDown(void)
+{
+}
+
+void test_init(void)
+{
+  TEST_MESSAGE("Container Hash Tests");
+}
+
+/**
+ * @brief The test verifies that the hash depends on the elements and their order only.
+ */
+void test_TestCase_1(void)
+{
+  TEST_MESSAGE("[CONTAINER_TEST]: hash of elements");
+
+  uint64_t hash = reference_hash(input, INPUT_SIZE);
+  TEST_ASSERT_TRUE(reference_hash(input, 0) != hash);
+  TEST_ASSERT_TRUE(reference_hash(input, INPUT_SIZE - 1) != hash);
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    container_t *container = create(types[t], input, INPUT_SIZE);
+    TEST_ASSERT_TRUE(hash == container_hash(container));
+
+    /* The swap of two elements changes the hash */
+    uint32_t value = input[0];
+    TEST_ASSERT_TRUE(container_replace(container, &input[1], 0));
+    TEST_ASSERT_TRUE(container_replace(container, &value, 1));
+    TEST_ASSERT_TRUE(hash != container_hash(container));
+
+    TEST_ASSERT_TRUE(container_replace(container, &input[0], 0));
+    TEST_ASSERT_TRUE(container_replace(container, &input[1], 1));
+    TEST_ASSERT_TRUE(hash == container_hash(container));
+
+    container_delete(&container);
+  }
+}
+
+/**
+ * @brief The test verifies the incremental maintenance of the hash by the push and pop at both ends.
+ */
+void test_TestCase_2(void)
+{
+  uint32_t mirror[2 * STEPS + 1];
+  uint64_t hash = 0;
+
+  TEST_MESSAGE("[CONTAINER_TEST]: tracked hash by push and pop");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    container_t *container = container_create(sizeof(uint32_t), types[t]);
+    TEST_ASSERT_TRUE(container_hash_track(container, true));
+
+    size_t head = STEPS;
+    size_t tail = STEPS;
+    uint32_t seed = 12345;
+
+    for (size_t step = 0; step < STEPS; step++)
+    {
+      seed = seed * 1103515245u + 12345u;
+      uint32_t value = seed >> 8;
+      uint32_t output = 0;
+
+      switch ((seed >> 28) % 4)
+      {
+        case 0:
+          TEST_ASSERT_TRUE(container_push_back(container, &value));
+          mirror[tail++] = value;
+          break;
+        case 1:
+          TEST_ASSERT_TRUE(container_push_front(container, &value));
+          mirror[--head] = value;
+          break;
+        case 2:
+          TEST_ASSERT_EQUAL(head != tail, container_pop_back(container, &output));
+          tail = (head != tail) ? tail - 1 : tail;
+          break;
+        default:
+          TEST_ASSERT_EQUAL(head != tail, container_pop_front(container, &output));
+          head = (head != tail) ? head + 1 : head;
+          break;
+      }
+
+      TEST_ASSERT_TRUE(container_hash_cached(container, &hash));
+      if (0 == step % 50)
+      {
+        TEST_ASSERT_TRUE(reference_hash(&mirror[head], tail - head) == hash);
+      }
+    }
+
+    TEST_ASSERT_TRUE(reference_hash(&mirror[head], tail - head) == hash);
+    TEST_ASSERT_TRUE(container_hash(container) == hash);
+
+    container_delete(&container);
+  }
+}
+
+/**
+ * @brief The test verifies the invalidation of the tracked hash.
+ */
+void test_TestCase_3(void)
+{
+  uint64_t hash = 0;
+  uint32_t value = 0xAA;
+
+  TEST_MESSAGE("[CONTAINER_TEST]: invalidation of tracked hash");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    container_t *container = create(types[t], input, INPUT_SIZE);
+    TEST_ASSERT_FALSE(container_hash_cached(container, &hash));
+    TEST_ASSERT_TRUE(container_hash_track(container, true));
+    TEST_ASSERT_TRUE(container_hash_cached(container, &hash));
+    TEST_ASSERT_TRUE(reference_hash(input, INPUT_SIZE) == hash);
+
+    /* The change in the middle invalidates the hash, the next call recomputes it */
+    TEST_ASSERT_TRUE(container_insert(container, &value, 10));
+    TEST_ASSERT_FALSE(container_hash_cached(container, &hash));
+    TEST_ASSERT_TRUE(container_erase(container, 10));
+    TEST_ASSERT_TRUE(reference_hash(input, INPUT_SIZE) == container_hash(container));
+    TEST_ASSERT_TRUE(container_hash_cached(container, &hash));
+
+    /* The write through the pointer is seen */
+    *(uint32_t *)container_peek(container, 5) = value;
+    TEST_ASSERT_FALSE(container_hash_cached(container, &hash));
+    TEST_ASSERT_TRUE(reference_hash(input, INPUT_SIZE) != container_hash(container));
+
+    /* The views can`t be tracked and the writes through the mutable view are seen by the parent */
+    uc_view_t *view = container_view(container, 0, 10, CONTAINER_VIEW_MUTABLE);
+    TEST_ASSERT_FALSE(container_hash_track(view, true));
+    TEST_ASSERT_TRUE(container_replace(view, &input[5], 5));
+    TEST_ASSERT_FALSE(container_hash_cached(container, &hash));
+    TEST_ASSERT_TRUE(reference_hash(input, INPUT_SIZE) == container_hash(container));
+    container_delete(&view);
+
+    /* The cleared container has the hash of the empty container */
+    container_clear(container);
+    TEST_ASSERT_TRUE(container_hash_cached(container, &hash));
+    TEST_ASSERT_TRUE(reference_hash(input, 0) == hash);
+
+    TEST_ASSERT_TRUE(container_hash_track(container, false));
+    TEST_ASSERT_FALSE(container_hash_cached(container, &hash));
+
+    container_delete(&container);
+  }
+}
+
+/**
+ * @brief The test verifies the tracked hashes with swap, move and equality check.
+ */
+void test_TestCase_4(void)
+{
+  uint64_t hash = 0;
+
+  TEST_MESSAGE("[CONTAINER_TEST]: tracked hash with swap, move and equal");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    container_t *container1 = create(types[t], input, INPUT_SIZE);
+    container_t *container2 = create(types[(t + 1) % 4], input, INPUT_SIZE / 2);
+    TEST_ASSERT_TRUE(container_hash_track(container1, true));
+    TEST_ASSERT_TRUE(container_hash_track(container2, true));
+
+    container_swap(container1, container2);
+    TEST_ASSERT_TRUE(container_hash_cached(container1, &hash));
+    TEST_ASSERT_TRUE(reference_hash(input, INPUT_SIZE / 2) == hash);
+    TEST_ASSERT_TRUE(container_hash_cached(container2, &hash));
+    TEST_ASSERT_TRUE(reference_hash(input, INPUT_SIZE) == hash);
+
+    /* The replicas are compared by the hashes first */
+    for (size_t i = INPUT_SIZE / 2; i < INPUT_SIZE; i++)
+    {
+      TEST_ASSERT_FALSE(uc_equal(.container1 = container1, .container2 = container2));
+      TEST_ASSERT_TRUE(container_push_back(container1, &input[i]));
+    }
+    TEST_ASSERT_TRUE(uc_equal(.container1 = container1, .container2 = container2));
+
+    /* The comparison and the read-only accessors only read the elements, so the hashes stay valid */
+    TEST_ASSERT_TRUE(container_hash_cached(container1, &hash));
+    TEST_ASSERT_TRUE(container_hash_cached(container2, &hash));
+    TEST_ASSERT_EQUAL_UINT32(input[3], *(const uint32_t *)container_cpeek(container1, 3));
+    container_cursor_t cursor = container_cursor(container2, 7);
+    TEST_ASSERT_EQUAL_UINT32(input[7], *(const uint32_t *)container_cursor_cdata(&cursor));
+    TEST_ASSERT_TRUE(container_hash_cached(container1, &hash));
+    TEST_ASSERT_TRUE(container_hash_cached(container2, &hash));
+
+    uint32_t value = 0;
+    TEST_ASSERT_TRUE(container_pop_front(container2, &value));
+    TEST_ASSERT_TRUE(container_push_front(container2, &input[1]));
+    TEST_ASSERT_FALSE(uc_equal(.container1 = container1, .container2 = container2));
+
+    TEST_ASSERT_TRUE(container_move(container1, container2));
+    TEST_ASSERT_TRUE(container_hash_cached(container2, &hash));
+    TEST_ASSERT_TRUE(reference_hash(input, 0) == hash);
+    TEST_ASSERT_FALSE(container_hash_cached(container1, &hash));
+    TEST_ASSERT_TRUE(reference_hash(input, INPUT_SIZE) != container_hash(container1));
+
+    container_delete(&container1);
+    container_delete(&container2);
+  }
+}
+
+/**
+ * @brief The test verifies the CRC32C checksum by the check value and by parts.
+ */
+void test_TestCase_5(void)
+{
+  const char check[] = "123456789";
+  uint8_t data[1000];
+
+  TEST_MESSAGE("[CONTAINER_TEST]: CRC32C checksum");
+
+  TEST_ASSERT_EQUAL_UINT32(0xE3069283u, uc_crc32c(0, check, 9));
+  TEST_ASSERT_EQUAL_UINT32(0, uc_crc32c(0, check, 0));
+
+  for (size_t i = 0; i < sizeof(data); i++)
+  {
+    data[i] = (uint8_t)(i * 7u + 3u);
+  }
+
+  uint32_t crc = uc_crc32c(0, data, sizeof(data));
+  for (size_t split = 0; split < 20; split++)
+  {
+    TEST_ASSERT_EQUAL_UINT32(crc, uc_crc32c(uc_crc32c(0, data, split * 37), &data[split * 37], sizeof(data) - split * 37));
+  }
+
+  /* Unaligned data */
+  TEST_ASSERT_EQUAL_UINT32(uc_crc32c(0, &data[1], 9), uc_crc32c(uc_crc32c(0, &data[1], 3), &data[4], 6));
+}
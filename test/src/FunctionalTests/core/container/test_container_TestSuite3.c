@@ -0,0 +1,315 @@
+/**
+ * @file    test_container_TestSuite3.c
+ * @author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Set of tests for the emplace/acquire API of the Container. Each test is executed
+ *          for all container types.
+ * @date    2023-01-14
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "unity.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "container.h"
+#include "interface/allocator_if.h"
+#include "linked_list.h"
+#include "vector.h"
+
+//_____ C O N F I G S  ________________________________________________________
+//_____ D E F I N I T I O N S _________________________________________________
+typedef struct
+{
+  uint32_t id;
+  uint8_t payload[64];
+} record_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+static container_t *containers[4] = {NULL, NULL, NULL, NULL};
+static const container_type_e types[4] = {
+  CONTAINER_LINKED_LIST_BASED, CONTAINER_VECTOR_BASED, CONTAINER_UNROLLED_LIST_BASED, CONTAINER_TIERED_VECTOR_BASED};
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+static void *failing_allocate(size_t size)
+{
+  (void)size;
+  return NULL;
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+void setUp(void)
+{
+  for (size_t i = 0; i < 4; i++)
+  {
+    containers[i] = container_create(sizeof(uint32_t), types[i]);
+  }
+}
+
+void tearDown(void)
+{
+  for (size_t i = 0; i < 4; i++)
+  {
+    container_delete(&containers[i]);
+  }
+}
+
+void test_init(void)
+{
+  TEST_MESSAGE("Container Emplace/Acquire Tests");
+}
+
+/**
+ * @brief The test verifies that emplace back reserves elements in the order of calls.
+ */
+void test_TestCase_1(void)
+{
+  uint32_t expected[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+  size_t size = sizeof(expected) / sizeof(expected[0]);
+
+  TEST_MESSAGE("[CONTAINER_TEST]: emplace back");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    for (size_t i = 0; i < size; i++)
+    {
+      uint32_t *slot = container_emplace_back(containers[t]);
+      TEST_ASSERT_NOT_NULL(slot);
+      *slot = expected[i];
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(size, container_size(containers[t]));
+
+    for (size_t i = 0; i < size; i++)
+    {
+      uint32_t output = 0;
+      TEST_ASSERT_TRUE(container_at(containers[t], &output, i));
+      TEST_ASSERT_EQUAL_UINT32(expected[i], output);
+    }
+  }
+}
+
+/**
+ * @brief The test verifies that emplace front reserves elements in reverse order of calls.
+ */
+void test_TestCase_2(void)
+{
+  uint32_t input[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+  size_t size = sizeof(input) / sizeof(input[0]);
+
+  TEST_MESSAGE("[CONTAINER_TEST]: emplace front");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    for (size_t i = 0; i < size; i++)
+    {
+      uint32_t *slot = container_emplace_front(containers[t]);
+      TEST_ASSERT_NOT_NULL(slot);
+      *slot = input[i];
+    }
+
+    for (size_t i = 0; i < size; i++)
+    {
+      uint32_t output = 0;
+      TEST_ASSERT_TRUE(container_pop_back(containers[t], &output));
+      TEST_ASSERT_EQUAL_UINT32(input[i], output);
+    }
+  }
+}
+
+/**
+ * @brief The test verifies emplace at the beginning, in the middle and at the end of container.
+ */
+void test_TestCase_3(void)
+{
+  uint32_t input[] = {10, 20, 30};
+  uint32_t expected[] = {5, 10, 15, 20, 30, 35};
+  size_t size = sizeof(expected) / sizeof(expected[0]);
+
+  TEST_MESSAGE("[CONTAINER_TEST]: emplace at");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    for (size_t i = 0; i < sizeof(input) / sizeof(input[0]); i++)
+    {
+      container_push_back(containers[t], &input[i]);
+    }
+
+    *(uint32_t *)container_emplace_at(containers[t], 0) = 5;
+    *(uint32_t *)container_emplace_at(containers[t], 2) = 15;
+    *(uint32_t *)container_emplace_at(containers[t], container_size(containers[t])) = 35;
+
+    TEST_ASSERT_EQUAL_UINT32(size, container_size(containers[t]));
+
+    for (size_t i = 0; i < size; i++)
+    {
+      uint32_t output = 0;
+      TEST_ASSERT_TRUE(container_at(containers[t], &output, i));
+      TEST_ASSERT_EQUAL_UINT32(expected[i], output);
+    }
+
+    /* The last element must be reachable from the back as well */
+    uint32_t output = 0;
+    TEST_ASSERT_TRUE(container_pop_back(containers[t], &output));
+    TEST_ASSERT_EQUAL_UINT32(35, output);
+  }
+}
+
+/**
+ * @brief The test verifies that emplace at index out of range fails.
+ */
+void test_TestCase_4(void)
+{
+  uint32_t input = 0x55;
+
+  TEST_MESSAGE("[CONTAINER_TEST]: emplace at out of range");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    container_push_back(containers[t], &input);
+
+    TEST_ASSERT_NULL(container_emplace_at(containers[t], 2));
+    TEST_ASSERT_EQUAL_UINT32(1, container_size(containers[t]));
+  }
+}
+
+/**
+ * @brief The test verifies that acquire front consumes elements in FIFO order.
+ */
+void test_TestCase_5(void)
+{
+  uint32_t input[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  size_t size = sizeof(input) / sizeof(input[0]);
+
+  TEST_MESSAGE("[CONTAINER_TEST]: acquire front");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    for (size_t i = 0; i < size; i++)
+    {
+      container_push_back(containers[t], &input[i]);
+    }
+
+    for (size_t i = 0; i < size; i++)
+    {
+      uint32_t *element = container_acquire_front(containers[t]);
+      TEST_ASSERT_NOT_NULL(element);
+      TEST_ASSERT_EQUAL_UINT32(input[i], *element);
+      TEST_ASSERT_EQUAL_UINT32(size - i - 1, container_size(containers[t]));
+    }
+
+    TEST_ASSERT_NULL(container_acquire_front(containers[t]));
+  }
+}
+
+/**
+ * @brief The test verifies interleaving of acquire front with insertions.
+ */
+void test_TestCase_6(void)
+{
+  TEST_MESSAGE("[CONTAINER_TEST]: acquire front interleaved with push back");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    uint32_t next = 0;
+    uint32_t expected = 0;
+
+    for (size_t round = 0; round < 50; round++)
+    {
+      *(uint32_t *)container_emplace_back(containers[t]) = next++;
+      *(uint32_t *)container_emplace_back(containers[t]) = next++;
+
+      uint32_t *element = container_acquire_front(containers[t]);
+      TEST_ASSERT_NOT_NULL(element);
+      TEST_ASSERT_EQUAL_UINT32(expected++, *element);
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(50, container_size(containers[t]));
+  }
+}
+
+/**
+ * @brief The test verifies that large records can be constructed directly in the container storage.
+ */
+void test_TestCase_7(void)
+{
+  TEST_MESSAGE("[CONTAINER_TEST]: emplace of large records");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    container_t *records = container_create(sizeof(record_t), types[t]);
+    TEST_ASSERT_NOT_NULL(records);
+
+    for (uint32_t i = 0; i < 20; i++)
+    {
+      record_t *record = container_emplace_back(records);
+      TEST_ASSERT_NOT_NULL(record);
+      record->id = i;
+      memset(record->payload, (int)i, sizeof(record->payload));
+    }
+
+    for (uint32_t i = 0; i < 20; i++)
+    {
+      record_t *record = container_acquire_front(records);
+      TEST_ASSERT_NOT_NULL(record);
+      TEST_ASSERT_EQUAL_UINT32(i, record->id);
+      TEST_ASSERT_EQUAL_UINT8(i, record->payload[sizeof(record->payload) - 1]);
+    }
+
+    container_delete(&records);
+  }
+}
+
+/**
+ * @brief The test verifies that the vector removes the front elements without the memory allocation
+ *        and reuses their memory for the next insertions.
+ */
+void test_TestCase_8(void)
+{
+  container_t *vector = containers[1];
+  uint32_t value = 0;
+
+  TEST_MESSAGE("[CONTAINER_TEST]: acquire front of vector without allocation");
+
+  /* The pool of the vector is full after the default capacity is reached */
+  for (uint32_t i = 0; i < 10; i++)
+  {
+    TEST_ASSERT_TRUE(container_push_back(vector, &i));
+  }
+
+  allocation_cb_register(failing_allocate);
+
+  for (uint32_t i = 0; i < 4; i++)
+  {
+    uint32_t *element = container_acquire_front(vector);
+    TEST_ASSERT_NOT_NULL(element);
+    TEST_ASSERT_EQUAL_UINT32(i, *element);
+  }
+  TEST_ASSERT_TRUE(container_pop_front(vector, &value));
+  TEST_ASSERT_EQUAL_UINT32(4, value);
+
+  /* The memory of the removed elements is enough for the same number of the new ones */
+  for (uint32_t i = 10; i < 15; i++)
+  {
+    TEST_ASSERT_TRUE(container_push_back(vector, &i));
+  }
+  TEST_ASSERT_FALSE(container_push_back(vector, &value));
+
+  allocation_cb_register(malloc);
+
+  for (uint32_t i = 0; i < 10; i++)
+  {
+    TEST_ASSERT_TRUE(container_at(vector, &value, i));
+    TEST_ASSERT_EQUAL_UINT32(i + 5, value);
+  }
+
+  /* The cleared vector reuses the whole memory */
+  TEST_ASSERT_TRUE(container_acquire_front(vector) != NULL);
+  container_clear(vector);
+  allocation_cb_register(failing_allocate);
+  for (uint32_t i = 0; i < 10; i++)
+  {
+    TEST_ASSERT_TRUE(container_push_back(vector, &i));
+  }
+  allocation_cb_register(malloc);
+}
@@ -0,0 +1,218 @@
+/**
+ * @file    test_container_TestSuite4.c
+ * @author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Set of tests for the batch pop/extract API of the Container. Each test is executed
+ *          for the Linked List, Vector, Unrolled List and Tiered Vector based containers.
+ * @date    2023-01-14
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "unity.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "container.h"
+#include "interface/allocator_if.h"
+#include "linked_list.h"
+#include "vector.h"
+
+//_____ C O N F I G S  ________________________________________________________
+#define INPUT_SIZE 25
+//_____ D E F I N I T I O N S _________________________________________________
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+static container_t *containers[4] = {NULL, NULL, NULL, NULL};
+static const container_type_e types[4] = {
+  CONTAINER_LINKED_LIST_BASED, CONTAINER_VECTOR_BASED, CONTAINER_UNROLLED_LIST_BASED, CONTAINER_TIERED_VECTOR_BASED};
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+static void fill(container_t *container)
+{
+  for (uint32_t i = 0; i < INPUT_SIZE; i++)
+  {
+    TEST_ASSERT_TRUE(container_push_back(container, &i));
+  }
+}
+
+static void check_content(container_t *container, const uint32_t *expected, size_t size)
+{
+  TEST_ASSERT_EQUAL_UINT32(size, container_size(container));
+
+  for (size_t i = 0; i < size; i++)
+  {
+    uint32_t output = 0;
+    TEST_ASSERT_TRUE(container_at(container, &output, i));
+    TEST_ASSERT_EQUAL_UINT32(expected[i], output);
+  }
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+void setUp(void)
+{
+  for (size_t i = 0; i < 4; i++)
+  {
+    containers[i] = container_create(sizeof(uint32_t), types[i]);
+  }
+}
+
+void tearDown(void)
+{
+  for (size_t i = 0; i < 4; i++)
+  {
+    container_delete(&containers[i]);
+  }
+}
+
+void test_init(void)
+{
+  TEST_MESSAGE("Container Batch Pop/Extract Tests");
+}
+
+/**
+ * @brief The test verifies batch pop from the front of container.
+ */
+void test_TestCase_1(void)
+{
+  uint32_t expected_output[] = {0, 1, 2, 3, 4, 5, 6};
+  uint32_t output[7] = {0};
+
+  TEST_MESSAGE("[CONTAINER_TEST]: pop front n");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    fill(containers[t]);
+
+    TEST_ASSERT_TRUE(container_pop_front_n(containers[t], output, 7));
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(expected_output, output, 7);
+
+    uint32_t front = 0;
+    TEST_ASSERT_EQUAL_UINT32(INPUT_SIZE - 7, container_size(containers[t]));
+    TEST_ASSERT_TRUE(container_pop_front(containers[t], &front));
+    TEST_ASSERT_EQUAL_UINT32(7, front);
+  }
+}
+
+/**
+ * @brief The test verifies batch pop from the back of container.
+ */
+void test_TestCase_2(void)
+{
+  uint32_t expected_output[] = {20, 21, 22, 23, 24};
+  uint32_t output[5] = {0};
+
+  TEST_MESSAGE("[CONTAINER_TEST]: pop back n");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    fill(containers[t]);
+
+    TEST_ASSERT_TRUE(container_pop_back_n(containers[t], output, 5));
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(expected_output, output, 5);
+
+    uint32_t back = 0;
+    TEST_ASSERT_EQUAL_UINT32(INPUT_SIZE - 5, container_size(containers[t]));
+    TEST_ASSERT_TRUE(container_pop_back(containers[t], &back));
+    TEST_ASSERT_EQUAL_UINT32(19, back);
+  }
+}
+
+/**
+ * @brief The test verifies extraction of a range from the middle of container.
+ */
+void test_TestCase_3(void)
+{
+  uint32_t expected_output[] = {10, 11, 12, 13};
+  uint32_t expected[INPUT_SIZE - 4] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24};
+  uint32_t output[4] = {0};
+
+  TEST_MESSAGE("[CONTAINER_TEST]: extract range");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    fill(containers[t]);
+
+    TEST_ASSERT_TRUE(container_extract_range(containers[t], output, 10, 4));
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(expected_output, output, 4);
+
+    check_content(containers[t], expected, INPUT_SIZE - 4);
+  }
+}
+
+/**
+ * @brief The test verifies that the whole container can be drained by single call.
+ */
+void test_TestCase_4(void)
+{
+  uint32_t output[INPUT_SIZE] = {0};
+
+  TEST_MESSAGE("[CONTAINER_TEST]: drain whole container");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    fill(containers[t]);
+
+    TEST_ASSERT_TRUE(container_pop_front_n(containers[t], output, INPUT_SIZE));
+    TEST_ASSERT_EQUAL_UINT32(0, container_size(containers[t]));
+
+    for (uint32_t i = 0; i < INPUT_SIZE; i++)
+    {
+      TEST_ASSERT_EQUAL_UINT32(i, output[i]);
+    }
+
+    /* Container must stay usable after draining */
+    uint32_t input = 0x55;
+    uint32_t back = 0;
+    TEST_ASSERT_TRUE(container_push_back(containers[t], &input));
+    TEST_ASSERT_TRUE(container_push_front(containers[t], &input));
+    TEST_ASSERT_TRUE(container_pop_back(containers[t], &back));
+    TEST_ASSERT_EQUAL_UINT32(input, back);
+  }
+}
+
+/**
+ * @brief The test verifies that out of range requests fail and leave container untouched.
+ */
+void test_TestCase_5(void)
+{
+  uint32_t expected[INPUT_SIZE] = {0};
+  uint32_t output[INPUT_SIZE + 1] = {0};
+
+  TEST_MESSAGE("[CONTAINER_TEST]: batch pop out of range");
+
+  for (uint32_t i = 0; i < INPUT_SIZE; i++)
+  {
+    expected[i] = i;
+  }
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    fill(containers[t]);
+
+    TEST_ASSERT_FALSE(container_pop_front_n(containers[t], output, INPUT_SIZE + 1));
+    TEST_ASSERT_FALSE(container_pop_back_n(containers[t], output, INPUT_SIZE + 1));
+    TEST_ASSERT_FALSE(container_extract_range(containers[t], output, 20, 6));
+    TEST_ASSERT_FALSE(container_extract_range(containers[t], output, INPUT_SIZE + 1, 0));
+
+    check_content(containers[t], expected, INPUT_SIZE);
+  }
+}
+
+/**
+ * @brief The test verifies that empty range is accepted and does nothing.
+ */
+void test_TestCase_6(void)
+{
+  uint32_t output[1] = {0};
+
+  TEST_MESSAGE("[CONTAINER_TEST]: batch pop of zero elements");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    TEST_ASSERT_TRUE(container_pop_front_n(containers[t], output, 0));
+    TEST_ASSERT_TRUE(container_pop_back_n(containers[t], output, 0));
+
+    fill(containers[t]);
+
+    TEST_ASSERT_TRUE(container_extract_range(containers[t], output, INPUT_SIZE, 0));
+    TEST_ASSERT_EQUAL_UINT32(INPUT_SIZE, container_size(containers[t]));
+  }
+}
@@ -0,0 +1,237 @@
+/**
+ * @file    test_container_TestSuite5.c
+ * @author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Set of tests for the range insert/erase API of the Container. Each test is executed
+ *          for the Linked List, Vector, Unrolled List and Tiered Vector based containers.
+ * @date    2023-01-14
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "unity.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "container.h"
+#include "interface/allocator_if.h"
+#include "linked_list.h"
+#include "vector.h"
+
+//_____ C O N F I G S  ________________________________________________________
+#define INPUT_SIZE 20
+//_____ D E F I N I T I O N S _________________________________________________
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+static container_t *containers[4] = {NULL, NULL, NULL, NULL};
+static const container_type_e types[4] = {
+  CONTAINER_LINKED_LIST_BASED, CONTAINER_VECTOR_BASED, CONTAINER_UNROLLED_LIST_BASED, CONTAINER_TIERED_VECTOR_BASED};
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+static void fill(container_t *container)
+{
+  for (uint32_t i = 0; i < INPUT_SIZE; i++)
+  {
+    TEST_ASSERT_TRUE(container_push_back(container, &i));
+  }
+}
+
+static void check_content(container_t *container, const uint32_t *expected, size_t size)
+{
+  TEST_ASSERT_EQUAL_UINT32(size, container_size(container));
+
+  for (size_t i = 0; i < size; i++)
+  {
+    uint32_t output = 0;
+    TEST_ASSERT_TRUE(container_at(container, &output, i));
+    TEST_ASSERT_EQUAL_UINT32(expected[i], output);
+  }
+
+  /* Check that links from the back are consistent with links from the front */
+  if (size > 0)
+  {
+    uint32_t back = 0;
+    TEST_ASSERT_TRUE(container_pop_back(container, &back));
+    TEST_ASSERT_EQUAL_UINT32(expected[size - 1], back);
+    TEST_ASSERT_TRUE(container_push_back(container, &back));
+  }
+}
+
+static bool is_odd(const void *data, size_t esize)
+{
+  return (*(const uint32_t *)data % 2) != 0;
+}
+
+static bool is_any(const void *data, size_t esize)
+{
+  return true;
+}
+
+static bool is_none(const void *data, size_t esize)
+{
+  return false;
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+void setUp(void)
+{
+  for (size_t i = 0; i < 4; i++)
+  {
+    containers[i] = container_create(sizeof(uint32_t), types[i]);
+  }
+}
+
+void tearDown(void)
+{
+  for (size_t i = 0; i < 4; i++)
+  {
+    container_delete(&containers[i]);
+  }
+}
+
+void test_init(void)
+{
+  TEST_MESSAGE("Container Range Insert/Erase Tests");
+}
+
+/**
+ * @brief The test verifies range insertion into empty container.
+ */
+void test_TestCase_1(void)
+{
+  uint32_t input[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+  size_t size = sizeof(input) / sizeof(input[0]);
+
+  TEST_MESSAGE("[CONTAINER_TEST]: insert range into empty container");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    TEST_ASSERT_TRUE(container_insert_range(containers[t], input, 0, size));
+    check_content(containers[t], input, size);
+  }
+}
+
+/**
+ * @brief The test verifies range insertion at the beginning, in the middle and at the end.
+ */
+void test_TestCase_2(void)
+{
+  uint32_t input[] = {100, 101, 102};
+  uint32_t expected[] = {100, 101, 102, 0, 1, 2, 100, 101, 102, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+                         12,  13,  14,  15, 16, 17, 18, 19, 100, 101, 102};
+  size_t size = sizeof(expected) / sizeof(expected[0]);
+
+  TEST_MESSAGE("[CONTAINER_TEST]: insert range");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    fill(containers[t]);
+
+    TEST_ASSERT_TRUE(container_insert_range(containers[t], input, 3, 3));
+    TEST_ASSERT_TRUE(container_insert_range(containers[t], input, 0, 3));
+    TEST_ASSERT_TRUE(container_insert_range(containers[t], input, container_size(containers[t]), 3));
+
+    check_content(containers[t], expected, size);
+  }
+}
+
+/**
+ * @brief The test verifies that range insertion out of range fails.
+ */
+void test_TestCase_3(void)
+{
+  uint32_t input[] = {100, 101, 102};
+
+  TEST_MESSAGE("[CONTAINER_TEST]: insert range out of range");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    fill(containers[t]);
+
+    TEST_ASSERT_FALSE(container_insert_range(containers[t], input, INPUT_SIZE + 1, 3));
+    TEST_ASSERT_EQUAL_UINT32(INPUT_SIZE, container_size(containers[t]));
+  }
+}
+
+/**
+ * @brief The test verifies range erase in the middle, at the beginning and at the end.
+ */
+void test_TestCase_4(void)
+{
+  uint32_t expected[] = {2, 3, 4, 9, 10, 11, 12, 13, 14, 15, 16};
+  size_t size = sizeof(expected) / sizeof(expected[0]);
+
+  TEST_MESSAGE("[CONTAINER_TEST]: erase range");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    fill(containers[t]);
+
+    TEST_ASSERT_TRUE(container_erase_range(containers[t], 5, 4));
+    TEST_ASSERT_TRUE(container_erase_range(containers[t], 0, 2));
+    TEST_ASSERT_TRUE(container_erase_range(containers[t], container_size(containers[t]) - 3, 3));
+
+    check_content(containers[t], expected, size);
+  }
+}
+
+/**
+ * @brief The test verifies that range erase out of range fails and keeps the content.
+ */
+void test_TestCase_5(void)
+{
+  TEST_MESSAGE("[CONTAINER_TEST]: erase range out of range");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    fill(containers[t]);
+
+    TEST_ASSERT_FALSE(container_erase_range(containers[t], 15, 6));
+    TEST_ASSERT_EQUAL_UINT32(INPUT_SIZE, container_size(containers[t]));
+
+    TEST_ASSERT_TRUE(container_erase_range(containers[t], 0, INPUT_SIZE));
+    TEST_ASSERT_EQUAL_UINT32(0, container_size(containers[t]));
+  }
+}
+
+/**
+ * @brief The test verifies erase by predicate keeps the order of the remaining elements.
+ */
+void test_TestCase_6(void)
+{
+  uint32_t expected[] = {0, 2, 4, 6, 8, 10, 12, 14, 16, 18};
+  size_t size = sizeof(expected) / sizeof(expected[0]);
+
+  TEST_MESSAGE("[CONTAINER_TEST]: erase if");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    fill(containers[t]);
+
+    TEST_ASSERT_EQUAL_UINT32(INPUT_SIZE - size, container_erase_if(containers[t], is_odd));
+    check_content(containers[t], expected, size);
+  }
+}
+
+/**
+ * @brief The test verifies erase by predicate which selects all or nothing.
+ */
+void test_TestCase_7(void)
+{
+  TEST_MESSAGE("[CONTAINER_TEST]: erase if all/none");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    TEST_ASSERT_EQUAL_UINT32(0, container_erase_if(containers[t], is_any));
+
+    fill(containers[t]);
+
+    TEST_ASSERT_EQUAL_UINT32(0, container_erase_if(containers[t], is_none));
+    TEST_ASSERT_EQUAL_UINT32(INPUT_SIZE, container_size(containers[t]));
+
+    TEST_ASSERT_EQUAL_UINT32(INPUT_SIZE, container_erase_if(containers[t], is_any));
+    TEST_ASSERT_EQUAL_UINT32(0, container_size(containers[t]));
+
+    /* Container must stay usable after erasing all elements */
+    uint32_t input = 0x55;
+    TEST_ASSERT_TRUE(container_push_front(containers[t], &input));
+    TEST_ASSERT_EQUAL_UINT32(1, container_size(containers[t]));
+  }
+}
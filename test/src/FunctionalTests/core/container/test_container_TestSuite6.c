@@ -0,0 +1,232 @@
+/**
+ * @file    test_container_TestSuite6.c
+ * @author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Set of tests for the cursor and unordered erase API of the Container. Each test is executed
+ *          for the Linked List, Vector, Unrolled List and Tiered Vector based containers.
+ * @date    2023-01-14
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "unity.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "container.h"
+#include "interface/allocator_if.h"
+#include "linked_list.h"
+#include "vector.h"
+
+//_____ C O N F I G S  ________________________________________________________
+#define INPUT_SIZE 20
+//_____ D E F I N I T I O N S _________________________________________________
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+static container_t *containers[4] = {NULL, NULL, NULL, NULL};
+static const container_type_e types[4] = {
+  CONTAINER_LINKED_LIST_BASED, CONTAINER_VECTOR_BASED, CONTAINER_UNROLLED_LIST_BASED, CONTAINER_TIERED_VECTOR_BASED};
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+static void fill(container_t *container)
+{
+  for (uint32_t i = 0; i < INPUT_SIZE; i++)
+  {
+    TEST_ASSERT_TRUE(container_push_back(container, &i));
+  }
+}
+
+static uint32_t sum(container_t *container)
+{
+  uint32_t result = 0;
+
+  for (container_cursor_t cursor = container_cursor(container, 0); container_cursor_valid(&cursor);
+       container_cursor_next(&cursor))
+  {
+    result += *(uint32_t *)container_cursor_data(&cursor);
+  }
+
+  return result;
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+void setUp(void)
+{
+  for (size_t i = 0; i < 4; i++)
+  {
+    containers[i] = container_create(sizeof(uint32_t), types[i]);
+  }
+}
+
+void tearDown(void)
+{
+  for (size_t i = 0; i < 4; i++)
+  {
+    container_delete(&containers[i]);
+  }
+}
+
+void test_init(void)
+{
+  TEST_MESSAGE("Container Cursor/Unordered Erase Tests");
+}
+
+/**
+ * @brief The test verifies that cursor walks through all elements in order.
+ */
+void test_TestCase_1(void)
+{
+  TEST_MESSAGE("[CONTAINER_TEST]: cursor walk");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    fill(containers[t]);
+
+    uint32_t expected = 5;
+    container_cursor_t cursor = container_cursor(containers[t], 5);
+    while (container_cursor_valid(&cursor))
+    {
+      TEST_ASSERT_EQUAL_UINT32(expected++, *(uint32_t *)container_cursor_data(&cursor));
+      container_cursor_next(&cursor);
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(INPUT_SIZE, expected);
+    TEST_ASSERT_FALSE(container_cursor_next(&cursor));
+    TEST_ASSERT_NULL(container_cursor_data(&cursor));
+  }
+}
+
+/**
+ * @brief The test verifies that cursor of empty container or out of range index is invalid.
+ */
+void test_TestCase_2(void)
+{
+  TEST_MESSAGE("[CONTAINER_TEST]: invalid cursor");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    container_cursor_t cursor = container_cursor(containers[t], 0);
+    TEST_ASSERT_FALSE(container_cursor_valid(&cursor));
+    TEST_ASSERT_FALSE(container_cursor_erase(&cursor));
+
+    fill(containers[t]);
+
+    cursor = container_cursor(containers[t], INPUT_SIZE);
+    TEST_ASSERT_FALSE(container_cursor_valid(&cursor));
+  }
+}
+
+/**
+ * @brief The test verifies unordered erase keeps all the other elements.
+ */
+void test_TestCase_3(void)
+{
+  uint32_t expected_sum = (INPUT_SIZE * (INPUT_SIZE - 1)) / 2;
+
+  TEST_MESSAGE("[CONTAINER_TEST]: erase unordered");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    uint32_t expected = expected_sum;
+    uint32_t output = 0;
+    size_t indexes[] = {3, 0, INPUT_SIZE - 3};
+
+    fill(containers[t]);
+
+    for (size_t i = 0; i < sizeof(indexes) / sizeof(indexes[0]); i++)
+    {
+      TEST_ASSERT_TRUE(container_at(containers[t], &output, indexes[i]));
+      TEST_ASSERT_TRUE(container_erase_unordered(containers[t], indexes[i]));
+      expected -= output;
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(INPUT_SIZE - 3, container_size(containers[t]));
+    TEST_ASSERT_EQUAL_UINT32(expected, sum(containers[t]));
+
+    /* The last element was moved to the erased place of the vector, the linked list keeps the order */
+    TEST_ASSERT_TRUE(container_at(containers[t], &output, 0));
+    TEST_ASSERT_EQUAL_UINT32((CONTAINER_VECTOR_BASED == types[t]) ? 18 : 1, output);
+  }
+}
+
+/**
+ * @brief The test verifies unordered erase out of range.
+ */
+void test_TestCase_4(void)
+{
+  TEST_MESSAGE("[CONTAINER_TEST]: erase unordered out of range");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    TEST_ASSERT_FALSE(container_erase_unordered(containers[t], 0));
+
+    fill(containers[t]);
+
+    TEST_ASSERT_FALSE(container_erase_unordered(containers[t], INPUT_SIZE));
+    TEST_ASSERT_EQUAL_UINT32(INPUT_SIZE, container_size(containers[t]));
+  }
+}
+
+/**
+ * @brief The test verifies erase through cursor during walking through the container.
+ */
+void test_TestCase_5(void)
+{
+  TEST_MESSAGE("[CONTAINER_TEST]: cursor erase");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    size_t visited = 0;
+
+    fill(containers[t]);
+
+    container_cursor_t cursor = container_cursor(containers[t], 0);
+    while (container_cursor_valid(&cursor))
+    {
+      uint32_t value = *(uint32_t *)container_cursor_data(&cursor);
+      visited++;
+
+      if (value % 2)
+      {
+        TEST_ASSERT_TRUE(container_cursor_erase(&cursor));
+      }
+      else
+      {
+        container_cursor_next(&cursor);
+      }
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(INPUT_SIZE, visited);
+    TEST_ASSERT_EQUAL_UINT32(INPUT_SIZE / 2, container_size(containers[t]));
+
+    for (container_cursor_t it = container_cursor(containers[t], 0); container_cursor_valid(&it); container_cursor_next(&it))
+    {
+      TEST_ASSERT_EQUAL_UINT32(0, *(uint32_t *)container_cursor_data(&it) % 2);
+    }
+  }
+}
+
+/**
+ * @brief The test verifies erase through cursor of all elements.
+ */
+void test_TestCase_6(void)
+{
+  TEST_MESSAGE("[CONTAINER_TEST]: cursor erase all");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    fill(containers[t]);
+
+    container_cursor_t cursor = container_cursor(containers[t], 0);
+    while (container_cursor_valid(&cursor))
+    {
+      TEST_ASSERT_TRUE(container_cursor_erase(&cursor));
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(0, container_size(containers[t]));
+
+    /* Container must stay usable after erasing all elements */
+    uint32_t input = 0x55;
+    uint32_t output = 0;
+    TEST_ASSERT_TRUE(container_push_back(containers[t], &input));
+    TEST_ASSERT_TRUE(container_pop_front(containers[t], &output));
+    TEST_ASSERT_EQUAL_UINT32(input, output);
+  }
+}
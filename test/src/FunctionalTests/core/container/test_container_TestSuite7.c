@@ -0,0 +1,236 @@
+/**
+ * @file    test_container_TestSuite7.c
+ * @author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Set of tests for the splice/append API of the Container. Each test is executed
+ *          for all combinations of the Linked List, Vector, Unrolled List and Tiered Vector based containers.
+ * @date    2023-01-14
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "unity.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "container.h"
+#include "interface/allocator_if.h"
+#include "linked_list.h"
+#include "vector.h"
+
+//_____ C O N F I G S  ________________________________________________________
+#define INPUT_SIZE 5
+//_____ D E F I N I T I O N S _________________________________________________
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+static container_t *dst = NULL;
+static container_t *src = NULL;
+static const container_type_e types[4] = {
+  CONTAINER_LINKED_LIST_BASED, CONTAINER_VECTOR_BASED, CONTAINER_UNROLLED_LIST_BASED, CONTAINER_TIERED_VECTOR_BASED};
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+static void create(size_t dst_type, size_t src_type)
+{
+  dst = container_create(sizeof(uint32_t), types[dst_type]);
+  src = container_create(sizeof(uint32_t), types[src_type]);
+  TEST_ASSERT_NOT_NULL(dst);
+  TEST_ASSERT_NOT_NULL(src);
+}
+
+static void delete(void)
+{
+  container_delete(&dst);
+  container_delete(&src);
+}
+
+static void fill(container_t *container, uint32_t first)
+{
+  for (uint32_t i = 0; i < INPUT_SIZE; i++)
+  {
+    uint32_t value = first + i;
+    TEST_ASSERT_TRUE(container_push_back(container, &value));
+  }
+}
+
+static void check_content(container_t *container, const uint32_t *expected, size_t size)
+{
+  TEST_ASSERT_EQUAL_UINT32(size, container_size(container));
+
+  for (size_t i = 0; i < size; i++)
+  {
+    uint32_t output = 0;
+    TEST_ASSERT_TRUE(container_at(container, &output, i));
+    TEST_ASSERT_EQUAL_UINT32(expected[i], output);
+  }
+
+  /* Check that links from the back are consistent with links from the front */
+  if (size > 0)
+  {
+    uint32_t back = 0;
+    TEST_ASSERT_TRUE(container_pop_back(container, &back));
+    TEST_ASSERT_EQUAL_UINT32(expected[size - 1], back);
+    TEST_ASSERT_TRUE(container_push_back(container, &back));
+  }
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_init(void)
+{
+  TEST_MESSAGE("Container Splice/Append Tests");
+}
+
+/**
+ * @brief The test verifies append of one container to another.
+ */
+void test_TestCase_1(void)
+{
+  uint32_t expected[] = {0, 1, 2, 3, 4, 100, 101, 102, 103, 104};
+
+  TEST_MESSAGE("[CONTAINER_TEST]: append");
+
+  for (size_t d = 0; d < 4; d++)
+  {
+    for (size_t s = 0; s < 4; s++)
+    {
+      create(d, s);
+      fill(dst, 0);
+      fill(src, 100);
+
+      TEST_ASSERT_TRUE(container_append(dst, src));
+
+      check_content(dst, expected, 2 * INPUT_SIZE);
+      TEST_ASSERT_EQUAL_UINT32(0, container_size(src));
+
+      delete();
+    }
+  }
+}
+
+/**
+ * @brief The test verifies splice at the beginning and in the middle of container.
+ */
+void test_TestCase_2(void)
+{
+  uint32_t expected_front[] = {100, 101, 102, 103, 104, 0, 1, 2, 3, 4};
+  uint32_t expected_middle[] = {100, 101, 200, 201, 202, 203, 204, 102, 103, 104, 0, 1, 2, 3, 4};
+
+  TEST_MESSAGE("[CONTAINER_TEST]: splice at front and in the middle");
+
+  for (size_t d = 0; d < 4; d++)
+  {
+    for (size_t s = 0; s < 4; s++)
+    {
+      create(d, s);
+      fill(dst, 0);
+      fill(src, 100);
+
+      TEST_ASSERT_TRUE(container_splice(dst, 0, src));
+      check_content(dst, expected_front, 2 * INPUT_SIZE);
+
+      fill(src, 200);
+      TEST_ASSERT_TRUE(container_splice(dst, 2, src));
+      check_content(dst, expected_middle, 3 * INPUT_SIZE);
+      TEST_ASSERT_EQUAL_UINT32(0, container_size(src));
+
+      delete();
+    }
+  }
+}
+
+/**
+ * @brief The test verifies splice into empty container and splice of empty container.
+ */
+void test_TestCase_3(void)
+{
+  uint32_t expected[] = {100, 101, 102, 103, 104};
+
+  TEST_MESSAGE("[CONTAINER_TEST]: splice of empty containers");
+
+  for (size_t d = 0; d < 4; d++)
+  {
+    for (size_t s = 0; s < 4; s++)
+    {
+      create(d, s);
+
+      TEST_ASSERT_TRUE(container_append(dst, src));
+      TEST_ASSERT_EQUAL_UINT32(0, container_size(dst));
+
+      fill(src, 100);
+      TEST_ASSERT_TRUE(container_append(dst, src));
+      check_content(dst, expected, INPUT_SIZE);
+
+      TEST_ASSERT_TRUE(container_append(dst, src));
+      check_content(dst, expected, INPUT_SIZE);
+
+      delete();
+    }
+  }
+}
+
+/**
+ * @brief The test verifies that source container stays usable after splice.
+ */
+void test_TestCase_4(void)
+{
+  uint32_t expected[] = {300, 301, 302, 303, 304};
+
+  TEST_MESSAGE("[CONTAINER_TEST]: source is reusable after splice");
+
+  for (size_t d = 0; d < 4; d++)
+  {
+    for (size_t s = 0; s < 4; s++)
+    {
+      create(d, s);
+      fill(src, 100);
+
+      TEST_ASSERT_TRUE(container_append(dst, src));
+
+      fill(src, 300);
+      check_content(src, expected, INPUT_SIZE);
+      TEST_ASSERT_EQUAL_UINT32(INPUT_SIZE, container_size(dst));
+
+      delete();
+    }
+  }
+}
+
+/**
+ * @brief The test verifies that invalid splice requests fail and leave both containers untouched.
+ */
+void test_TestCase_5(void)
+{
+  uint32_t expected_dst[] = {0, 1, 2, 3, 4};
+  uint32_t expected_src[] = {100, 101, 102, 103, 104};
+
+  TEST_MESSAGE("[CONTAINER_TEST]: invalid splice");
+
+  for (size_t d = 0; d < 4; d++)
+  {
+    for (size_t s = 0; s < 4; s++)
+    {
+      create(d, s);
+      fill(dst, 0);
+      fill(src, 100);
+
+      container_t *other = container_create(sizeof(uint16_t), types[s]);
+      uint16_t value = 0x55;
+      TEST_ASSERT_TRUE(container_push_back(other, &value));
+
+      TEST_ASSERT_FALSE(container_splice(dst, INPUT_SIZE + 1, src));
+      TEST_ASSERT_FALSE(container_splice(dst, 0, dst));
+      TEST_ASSERT_FALSE(container_append(dst, other));
+
+      check_content(dst, expected_dst, INPUT_SIZE);
+      check_content(src, expected_src, INPUT_SIZE);
+      TEST_ASSERT_EQUAL_UINT32(1, container_size(other));
+
+      container_delete(&other);
+      delete();
+    }
+  }
+}
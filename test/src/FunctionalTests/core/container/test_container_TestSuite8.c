@@ -0,0 +1,182 @@
+/**
+ * @file    test_container_TestSuite8.c
+ * @author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Set of tests for the swap/move API of the Container. Each test is executed
+ *          for all combinations of the Linked List, Vector, Unrolled List and Tiered Vector based containers.
+ * @date    2023-01-14
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "unity.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "container.h"
+#include "interface/allocator_if.h"
+#include "linked_list.h"
+#include "vector.h"
+
+//_____ C O N F I G S  ________________________________________________________
+#define INPUT_SIZE 15
+//_____ D E F I N I T I O N S _________________________________________________
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+static container_t *first = NULL;
+static container_t *second = NULL;
+static const container_type_e types[4] = {
+  CONTAINER_LINKED_LIST_BASED, CONTAINER_VECTOR_BASED, CONTAINER_UNROLLED_LIST_BASED, CONTAINER_TIERED_VECTOR_BASED};
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+static void fill(container_t *container, uint32_t start, size_t size)
+{
+  for (uint32_t i = 0; i < size; i++)
+  {
+    uint32_t value = start + i;
+    TEST_ASSERT_TRUE(container_push_back(container, &value));
+  }
+}
+
+static void check_content(container_t *container, uint32_t start, size_t size)
+{
+  TEST_ASSERT_EQUAL_UINT32(size, container_size(container));
+
+  for (size_t i = 0; i < size; i++)
+  {
+    uint32_t output = 0;
+    TEST_ASSERT_TRUE(container_at(container, &output, i));
+    TEST_ASSERT_EQUAL_UINT32(start + i, output);
+  }
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+  if (first)
+  {
+    container_delete(&first);
+  }
+
+  if (second)
+  {
+    container_delete(&second);
+  }
+}
+
+void test_init(void)
+{
+  TEST_MESSAGE("Container Swap/Move Tests");
+}
+
+/**
+ * @brief The test verifies that swap exchanges the contents of the containers.
+ */
+void test_TestCase_1(void)
+{
+  TEST_MESSAGE("[CONTAINER_TEST]: swap");
+
+  for (size_t a = 0; a < 4; a++)
+  {
+    for (size_t b = 0; b < 4; b++)
+    {
+      first = container_create(sizeof(uint32_t), types[a]);
+      second = container_create(sizeof(uint32_t), types[b]);
+
+      fill(first, 0, INPUT_SIZE);
+      fill(second, 100, 3);
+
+      container_swap(first, second);
+      check_content(first, 100, 3);
+      check_content(second, 0, INPUT_SIZE);
+
+      container_swap(first, second);
+      check_content(first, 0, INPUT_SIZE);
+      check_content(second, 100, 3);
+
+      tearDown();
+    }
+  }
+}
+
+/**
+ * @brief The test verifies that swap exchanges element sizes as well.
+ */
+void test_TestCase_2(void)
+{
+  uint8_t input = 0x55;
+  uint8_t output = 0;
+
+  TEST_MESSAGE("[CONTAINER_TEST]: swap of containers with different element size");
+
+  first = container_create(sizeof(uint32_t), CONTAINER_VECTOR_BASED);
+  second = container_create(sizeof(uint8_t), CONTAINER_LINKED_LIST_BASED);
+
+  fill(first, 0, INPUT_SIZE);
+  TEST_ASSERT_TRUE(container_push_back(second, &input));
+
+  container_swap(first, second);
+
+  TEST_ASSERT_EQUAL_UINT32(sizeof(uint8_t), container_esize(first));
+  TEST_ASSERT_EQUAL_UINT32(sizeof(uint32_t), container_esize(second));
+  TEST_ASSERT_TRUE(container_pop_back(first, &output));
+  TEST_ASSERT_EQUAL_UINT8(input, output);
+  check_content(second, 0, INPUT_SIZE);
+}
+
+/**
+ * @brief The test verifies that move transfers the contents and leaves the source empty but usable.
+ */
+void test_TestCase_3(void)
+{
+  TEST_MESSAGE("[CONTAINER_TEST]: move");
+
+  for (size_t a = 0; a < 4; a++)
+  {
+    for (size_t b = 0; b < 4; b++)
+    {
+      first = container_create(sizeof(uint32_t), types[a]);
+      second = container_create(sizeof(uint32_t), types[b]);
+
+      fill(first, 0, 3);
+      fill(second, 100, INPUT_SIZE);
+
+      TEST_ASSERT_TRUE(container_move(first, second));
+
+      check_content(first, 100, INPUT_SIZE);
+      TEST_ASSERT_EQUAL_UINT32(0, container_size(second));
+      TEST_ASSERT_EQUAL_UINT32(sizeof(uint32_t), container_esize(second));
+
+      fill(second, 200, INPUT_SIZE);
+      check_content(second, 200, INPUT_SIZE);
+
+      tearDown();
+    }
+  }
+}
+
+/**
+ * @brief The test verifies move of container into itself and move of empty container.
+ */
+void test_TestCase_4(void)
+{
+  TEST_MESSAGE("[CONTAINER_TEST]: move corner cases");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    first = container_create(sizeof(uint32_t), types[t]);
+    second = container_create(sizeof(uint32_t), types[t]);
+
+    fill(first, 0, INPUT_SIZE);
+
+    TEST_ASSERT_TRUE(container_move(first, first));
+    check_content(first, 0, INPUT_SIZE);
+
+    TEST_ASSERT_TRUE(container_move(first, second));
+    TEST_ASSERT_EQUAL_UINT32(0, container_size(first));
+    TEST_ASSERT_EQUAL_UINT32(0, container_size(second));
+
+    tearDown();
+  }
+}
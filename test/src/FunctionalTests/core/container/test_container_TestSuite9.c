@@ -0,0 +1,249 @@
+/**
+ * @file    test_container_TestSuite9.c
+ * @author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Set of tests for the clone API of the Container. Each test is executed
+ *          for the Linked List, Vector, Unrolled List and Tiered Vector based containers.
+ * @date    2023-01-14
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "unity.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "container.h"
+#include "interface/allocator_if.h"
+#include "linked_list.h"
+#include "vector.h"
+
+//_____ C O N F I G S  ________________________________________________________
+#define INPUT_SIZE 25
+//_____ D E F I N I T I O N S _________________________________________________
+typedef struct
+{
+  uint32_t id;
+  char *name;
+} record_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+static container_t *containers[4] = {NULL, NULL, NULL, NULL};
+static const container_type_e types[4] = {
+  CONTAINER_LINKED_LIST_BASED, CONTAINER_VECTOR_BASED, CONTAINER_UNROLLED_LIST_BASED, CONTAINER_TIERED_VECTOR_BASED};
+static size_t copies = 0;
+static size_t allocations = 0;
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+static void fill(container_t *container, size_t size)
+{
+  for (uint32_t i = 0; i < size; i++)
+  {
+    TEST_ASSERT_TRUE(container_push_back(container, &i));
+  }
+}
+
+static void check_content(container_t *container, size_t size)
+{
+  TEST_ASSERT_EQUAL_UINT32(size, container_size(container));
+
+  for (uint32_t i = 0; i < size; i++)
+  {
+    uint32_t output = 0;
+    TEST_ASSERT_TRUE(container_at(container, &output, i));
+    TEST_ASSERT_EQUAL_UINT32(i, output);
+  }
+}
+
+static void record_copy(void *dst, const void *src, size_t esize)
+{
+  const record_t *from = (const record_t *)src;
+  record_t *to = (record_t *)dst;
+
+  to->id = from->id;
+  to->name = strdup(from->name);
+  copies++;
+}
+
+static void *counting_allocate(size_t size)
+{
+  allocations++;
+  return malloc(size);
+}
+
+static void records_free(container_t *container)
+{
+  for (container_cursor_t cursor = container_cursor(container, 0); container_cursor_valid(&cursor);
+       container_cursor_next(&cursor))
+  {
+    free(((record_t *)container_cursor_data(&cursor))->name);
+  }
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+void setUp(void)
+{
+  copies = 0;
+
+  for (size_t i = 0; i < 4; i++)
+  {
+    containers[i] = container_create(sizeof(uint32_t), types[i]);
+  }
+}
+
+void tearDown(void)
+{
+  for (size_t i = 0; i < 4; i++)
+  {
+    container_delete(&containers[i]);
+  }
+}
+
+void test_init(void)
+{
+  TEST_MESSAGE("Container Clone Tests");
+}
+
+/**
+ * @brief The test verifies shallow clone of the container.
+ */
+void test_TestCase_1(void)
+{
+  TEST_MESSAGE("[CONTAINER_TEST]: shallow clone");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    fill(containers[t], INPUT_SIZE);
+
+    container_t *clone = container_clone(containers[t], CONTAINER_COPY_SHALLOW, NULL);
+    TEST_ASSERT_NOT_NULL(clone);
+    check_content(clone, INPUT_SIZE);
+
+    /* The clone must be independent from the source */
+    uint32_t input = 0x55;
+    TEST_ASSERT_TRUE(container_replace(containers[t], &input, 0));
+    TEST_ASSERT_TRUE(container_push_back(clone, &input));
+    TEST_ASSERT_EQUAL_UINT32(INPUT_SIZE, container_size(containers[t]));
+    TEST_ASSERT_EQUAL_UINT32(INPUT_SIZE + 1, container_size(clone));
+
+    uint32_t output = 0xFF;
+    TEST_ASSERT_TRUE(container_at(clone, &output, 0));
+    TEST_ASSERT_EQUAL_UINT32(0, output);
+
+    container_delete(&clone);
+  }
+}
+
+/**
+ * @brief The test verifies clone of empty and small containers.
+ */
+void test_TestCase_2(void)
+{
+  TEST_MESSAGE("[CONTAINER_TEST]: clone of empty and small container");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    container_t *clone = container_clone(containers[t], CONTAINER_COPY_SHALLOW, NULL);
+    TEST_ASSERT_NOT_NULL(clone);
+    TEST_ASSERT_EQUAL_UINT32(0, container_size(clone));
+    TEST_ASSERT_EQUAL_UINT32(sizeof(uint32_t), container_esize(clone));
+    container_delete(&clone);
+
+    fill(containers[t], 3);
+    clone = container_clone(containers[t], CONTAINER_COPY_SHALLOW, NULL);
+    TEST_ASSERT_NOT_NULL(clone);
+    check_content(clone, 3);
+
+    /* The clone must be usable for further insertions */
+    fill(clone, INPUT_SIZE);
+    TEST_ASSERT_EQUAL_UINT32(INPUT_SIZE + 3, container_size(clone));
+    container_delete(&clone);
+  }
+}
+
+/**
+ * @brief The test verifies deep clone of elements which own memory.
+ */
+void test_TestCase_3(void)
+{
+  const char *names[] = {"alpha", "beta", "gamma", "delta", "epsilon"};
+  size_t size = sizeof(names) / sizeof(names[0]);
+
+  TEST_MESSAGE("[CONTAINER_TEST]: deep clone");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    copies = 0;
+
+    container_t *records = container_create(sizeof(record_t), types[t]);
+    TEST_ASSERT_NOT_NULL(records);
+
+    for (uint32_t i = 0; i < size; i++)
+    {
+      record_t *record = container_emplace_back(records);
+      record->id = i;
+      record->name = strdup(names[i]);
+    }
+
+    container_t *clone = container_clone(records, CONTAINER_COPY_DEEP, record_copy);
+    TEST_ASSERT_NOT_NULL(clone);
+    TEST_ASSERT_EQUAL_UINT32(size, copies);
+    TEST_ASSERT_EQUAL_UINT32(size, container_size(clone));
+
+    /* Resources of the source may be released without affecting the clone */
+    records_free(records);
+    container_delete(&records);
+
+    for (uint32_t i = 0; i < size; i++)
+    {
+      record_t *record = container_peek(clone, i);
+      TEST_ASSERT_EQUAL_UINT32(i, record->id);
+      TEST_ASSERT_EQUAL_STRING(names[i], record->name);
+    }
+
+    records_free(clone);
+    container_delete(&clone);
+  }
+}
+
+/**
+ * @brief The test verifies that the copy callback is ignored in shallow mode.
+ */
+void test_TestCase_4(void)
+{
+  TEST_MESSAGE("[CONTAINER_TEST]: shallow clone ignores copy callback");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    copies = 0;
+    fill(containers[t], INPUT_SIZE);
+
+    container_t *clone = container_clone(containers[t], CONTAINER_COPY_SHALLOW, record_copy);
+    TEST_ASSERT_NOT_NULL(clone);
+    TEST_ASSERT_EQUAL_UINT32(0, copies);
+    check_content(clone, INPUT_SIZE);
+
+    container_delete(&clone);
+  }
+}
+
+/**
+ * @brief The test verifies that the pool of the vector clone is allocated once for the source size.
+ */
+void test_TestCase_5(void)
+{
+  TEST_MESSAGE("[CONTAINER_TEST]: vector clone sizes the pool once");
+
+  fill(containers[1], INPUT_SIZE);
+
+  /* The container, the core, its private data and the pool without the reallocation */
+  allocations = 0;
+  allocation_cb_register(counting_allocate);
+  container_t *clone = container_clone(containers[1], CONTAINER_COPY_SHALLOW, NULL);
+  allocation_cb_register(malloc);
+
+  TEST_ASSERT_NOT_NULL(clone);
+  TEST_ASSERT_EQUAL_UINT32(4, allocations);
+  check_content(clone, INPUT_SIZE);
+
+  container_delete(&clone);
+}
@@ -0,0 +1,300 @@
+/**
+ * @file    test_hash_table_TestSuite1.c
+ * @author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Set of tests for the hash table: hash map and hash set.
+ * @date    2023-10-14
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "unity.h"
+
+#include <ctype.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "core/hash/hash_table.h"
+#include "interface/allocator_if.h"
+
+//_____ C O N F I G S  ________________________________________________________
+#define INPUT_SIZE 10000
+#define KEY_RANGE  3000
+#define STEPS      50000
+//_____ D E F I N I T I O N S _________________________________________________
+typedef struct
+{
+  uint32_t id;
+  char name[12];
+} record_key_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+static hash_table_t *table = NULL;
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+static uint64_t constant_hash(const void *key, size_t key_size)
+{
+  return 42;
+}
+
+/* The keys are compared and hashed without the case of the letters */
+static uint64_t nocase_hash(const void *key, size_t key_size)
+{
+  uint64_t hash = 14695981039346656037ull;
+  for (const char *c = (const char *)key; c < (const char *)key + key_size && '\0' != *c; c++)
+  {
+    hash = (hash ^ (uint64_t)tolower((unsigned char)*c)) * 1099511628211ull;
+  }
+
+  return hash;
+}
+
+static bool nocase_equal(const void *key1, const void *key2, size_t key_size)
+{
+  return 0 == strncasecmp((const char *)key1, (const char *)key2, key_size);
+}
+
+static uint32_t next_random(uint32_t *seed)
+{
+  *seed = *seed * 1103515245u + 12345u;
+  return *seed >> 8;
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+  if (NULL != table)
+  {
+    hash_table_delete(&table);
+  }
+}
+
+void test_init(void)
+{
+  TEST_MESSAGE("Hash Table Tests");
+}
+
+/**
+ * @brief The test verifies insertion, lookup and replacement of the values in the hash map.
+ */
+void test_TestCase_1(void)
+{
+  TEST_MESSAGE("[HASH_TABLE_TEST]: insert and find");
+
+  table = hash_table_create(sizeof(uint32_t), sizeof(uint64_t), NULL, NULL);
+  TEST_ASSERT_NOT_NULL(table);
+  TEST_ASSERT_EQUAL_UINT32(0, hash_table_size(table));
+
+  uint32_t key = 7;
+  TEST_ASSERT_NULL(hash_table_find(table, &key));
+  TEST_ASSERT_FALSE(hash_table_erase(table, &key));
+
+  for (uint32_t i = 0; i < INPUT_SIZE; i++)
+  {
+    key = i * 7919u;
+    uint64_t value = (uint64_t)i << 32 | i;
+    TEST_ASSERT_TRUE(hash_table_insert(table, &key, &value));
+  }
+  TEST_ASSERT_EQUAL_UINT32(INPUT_SIZE, hash_table_size(table));
+
+  for (uint32_t i = 0; i < INPUT_SIZE; i++)
+  {
+    key = i * 7919u;
+    uint64_t *value = (uint64_t *)hash_table_find(table, &key);
+    TEST_ASSERT_NOT_NULL(value);
+    TEST_ASSERT_TRUE(((uint64_t)i << 32 | i) == *value);
+
+    key = i * 7919u + 1;
+    TEST_ASSERT_FALSE(hash_table_contains(table, &key));
+  }
+
+  /* The insertion of the existing key replaces the value */
+  key = 7919u;
+  uint64_t value = 5;
+  TEST_ASSERT_TRUE(hash_table_insert(table, &key, &value));
+  TEST_ASSERT_EQUAL_UINT32(INPUT_SIZE, hash_table_size(table));
+  TEST_ASSERT_TRUE(5 == *(uint64_t *)hash_table_find(table, &key));
+}
+
+/**
+ * @brief The test verifies random insertions and erasures against the reference presence array.
+ */
+void test_TestCase_2(void)
+{
+  static bool present[KEY_RANGE];
+  uint32_t seed = 1;
+  size_t size = 0;
+
+  TEST_MESSAGE("[HASH_TABLE_TEST]: insert and erase");
+
+  memset(present, 0, sizeof(present));
+  table = hash_table_create(sizeof(uint32_t), sizeof(uint32_t), NULL, NULL);
+
+  for (size_t step = 0; step < STEPS; step++)
+  {
+    uint32_t key = next_random(&seed) % KEY_RANGE;
+    uint32_t value = key ^ 0xA5A5A5A5u;
+
+    if (next_random(&seed) % 2)
+    {
+      size += present[key] ? 0 : 1;
+      present[key] = true;
+      TEST_ASSERT_TRUE(hash_table_insert(table, &key, &value));
+    }
+    else
+    {
+      TEST_ASSERT_EQUAL(present[key], hash_table_erase(table, &key));
+      size -= present[key] ? 1 : 0;
+      present[key] = false;
+    }
+    TEST_ASSERT_EQUAL_UINT32(size, hash_table_size(table));
+  }
+
+  for (uint32_t key = 0; key < KEY_RANGE; key++)
+  {
+    uint32_t *value = (uint32_t *)hash_table_find(table, &key);
+    TEST_ASSERT_EQUAL(present[key], NULL != value);
+    if (NULL != value)
+    {
+      TEST_ASSERT_EQUAL_UINT32(key ^ 0xA5A5A5A5u, *value);
+    }
+  }
+}
+
+/**
+ * @brief The test verifies the hash set with the custom hash and equality callbacks.
+ */
+void test_TestCase_3(void)
+{
+  char key[16];
+
+  TEST_MESSAGE("[HASH_TABLE_TEST]: hash set with custom callbacks");
+
+  table = hash_table_create(sizeof(key), 0, nocase_hash, nocase_equal);
+
+  memset(key, 0, sizeof(key));
+  strcpy(key, "Container");
+  TEST_ASSERT_TRUE(hash_table_insert(table, key, NULL));
+  strcpy(key, "vector");
+  TEST_ASSERT_TRUE(hash_table_insert(table, key, NULL));
+  strcpy(key, "VECTOR");
+  TEST_ASSERT_TRUE(hash_table_insert(table, key, NULL));
+  TEST_ASSERT_EQUAL_UINT32(2, hash_table_size(table));
+
+  strcpy(key, "CONTAINER");
+  const char *stored = (const char *)hash_table_find(table, key);
+  TEST_ASSERT_NOT_NULL(stored);
+  TEST_ASSERT_EQUAL_STRING("Container", stored);
+
+  strcpy(key, "list");
+  TEST_ASSERT_FALSE(hash_table_contains(table, key));
+  TEST_ASSERT_NULL(hash_table_cursor_value(&(hash_table_cursor_t){.table = table, .slot = 0}));
+}
+
+/**
+ * @brief The test verifies the keys longer than 8 bytes, the in place update and the colliding hashes.
+ */
+void test_TestCase_4(void)
+{
+  TEST_MESSAGE("[HASH_TABLE_TEST]: emplace and collisions");
+
+  for (size_t mode = 0; mode < 2; mode++)
+  {
+    table = hash_table_create(sizeof(record_key_t), sizeof(uint16_t), (0 == mode) ? NULL : constant_hash, NULL);
+
+    /* Every key is counted by the in place update */
+    for (uint32_t i = 0; i < 3 * 200; i++)
+    {
+      record_key_t key;
+      memset(&key, 0, sizeof(key));
+      key.id = i % 200;
+      strcpy(key.name, "record");
+
+      bool inserted = false;
+      uint16_t *count = (uint16_t *)hash_table_emplace(table, &key, &inserted);
+      TEST_ASSERT_NOT_NULL(count);
+      TEST_ASSERT_EQUAL(i < 200, inserted);
+      TEST_ASSERT_EQUAL_UINT32(0, (uintptr_t)count % sizeof(uint16_t));
+      (*count)++;
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(200, hash_table_size(table));
+    for (uint32_t i = 0; i < 200; i += 2)
+    {
+      record_key_t key;
+      memset(&key, 0, sizeof(key));
+      key.id = i;
+      strcpy(key.name, "record");
+      TEST_ASSERT_EQUAL_UINT16(3, *(uint16_t *)hash_table_find(table, &key));
+      TEST_ASSERT_TRUE(hash_table_erase(table, &key));
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(100, hash_table_size(table));
+    for (uint32_t i = 0; i < 200; i++)
+    {
+      record_key_t key;
+      memset(&key, 0, sizeof(key));
+      key.id = i;
+      strcpy(key.name, "record");
+      TEST_ASSERT_EQUAL(i % 2, hash_table_contains(table, &key));
+    }
+
+    hash_table_delete(&table);
+  }
+}
+
+/**
+ * @brief The test verifies the walk by the cursor, reserve and clear.
+ */
+void test_TestCase_5(void)
+{
+  TEST_MESSAGE("[HASH_TABLE_TEST]: cursor, reserve and clear");
+
+  table = hash_table_create(sizeof(uint64_t), sizeof(uint32_t), NULL, NULL);
+
+  hash_table_cursor_t cursor = hash_table_cursor(table);
+  TEST_ASSERT_FALSE(hash_table_cursor_valid(&cursor));
+  TEST_ASSERT_NULL(hash_table_cursor_key(&cursor));
+
+  TEST_ASSERT_TRUE(hash_table_reserve(table, INPUT_SIZE));
+  uint64_t expected = 0;
+  for (uint64_t key = 1; key <= INPUT_SIZE; key++)
+  {
+    uint32_t value = (uint32_t)key * 3u;
+    TEST_ASSERT_TRUE(hash_table_insert(table, &key, &value));
+    expected += key;
+  }
+
+  /* Every element is visited once, the odd keys are erased during the walk */
+  uint64_t sum = 0;
+  size_t visited = 0;
+  for (cursor = hash_table_cursor(table); hash_table_cursor_valid(&cursor); hash_table_cursor_next(&cursor))
+  {
+    uint64_t key = *(const uint64_t *)hash_table_cursor_key(&cursor);
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)key * 3u, *(uint32_t *)hash_table_cursor_value(&cursor));
+    sum += key;
+    visited++;
+
+    if (key % 2)
+    {
+      TEST_ASSERT_TRUE(hash_table_erase(table, &key));
+    }
+  }
+
+  TEST_ASSERT_EQUAL_UINT32(INPUT_SIZE, visited);
+  TEST_ASSERT_TRUE(expected == sum);
+  TEST_ASSERT_EQUAL_UINT32(INPUT_SIZE / 2, hash_table_size(table));
+
+  hash_table_clear(table);
+  TEST_ASSERT_EQUAL_UINT32(0, hash_table_size(table));
+  cursor = hash_table_cursor(table);
+  TEST_ASSERT_FALSE(hash_table_cursor_valid(&cursor));
+
+  uint64_t key = 2;
+  TEST_ASSERT_FALSE(hash_table_contains(table, &key));
+  uint32_t value = 1;
+  TEST_ASSERT_TRUE(hash_table_insert(table, &key, &value));
+  TEST_ASSERT_TRUE(hash_table_contains(table, &key));
+}
@@ -0,0 +1,382 @@
+/**
+ * @file    test_priority_queue_TestSuite1.c
+ * @author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Set of tests for the priority queue.
+ *
+ * Every test is executed for the binary and the d-ary heaps and for both orders.
+ *
+ * @date    2023-10-15
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "unity.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "algorithms/transformation/uc_transformation.h"
+#include "core/container.h"
+#include "core/heap/priority_queue.h"
+#include "interface/allocator_if.h"
+
+//_____ C O N F I G S  ________________________________________________________
+#define INPUT_SIZE 1000
+#define STEPS      20000
+//_____ D E F I N I T I O N S _________________________________________________
+typedef struct
+{
+  uint32_t id;
+  double priority;
+} task_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+static const container_type_e types[4] = {
+  CONTAINER_LINKED_LIST_BASED, CONTAINER_VECTOR_BASED, CONTAINER_UNROLLED_LIST_BASED, CONTAINER_TIERED_VECTOR_BASED};
+static const ContainerSortOrder_e orders[2] = {SORT_ASCENDING, SORT_DESCENDING};
+static const size_t arities[4] = {0, 3, 4, 8};
+static int32_t input[INPUT_SIZE];
+static int32_t sorted[INPUT_SIZE];
+static priority_queue_t *queue = NULL;
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+static cmp_t compare(const void *data1, const void *data2, size_t esize)
+{
+  int32_t value1 = *(const int32_t *)data1;
+  int32_t value2 = *(const int32_t *)data2;
+
+  return (value1 > value2) ? GT : ((value1 < value2) ? LE : EQ);
+}
+
+static cmp_t compare_task(const void *data1, const void *data2, size_t esize)
+{
+  double priority1 = ((const task_t *)data1)->priority;
+  double priority2 = ((const task_t *)data2)->priority;
+
+  return (priority1 > priority2) ? GT : ((priority1 < priority2) ? LE : EQ);
+}
+
+static int ascending(const void *data1, const void *data2)
+{
+  return (int)compare(data1, data2, sizeof(int32_t));
+}
+
+static int descending(const void *data1, const void *data2)
+{
+  return -(int)compare(data1, data2, sizeof(int32_t));
+}
+
+static uint32_t next_random(uint32_t *seed)
+{
+  *seed = *seed * 1103515245u + 12345u;
+  return *seed >> 8;
+}
+
+static void prepare(size_t pattern, ContainerSortOrder_e order)
+{
+  for (size_t i = 0; i < INPUT_SIZE; i++)
+  {
+    switch (pattern)
+    {
+      case 0: input[i] = (int32_t)((i * 7919u) % 1009u) - 500; break;
+      case 1: input[i] = (int32_t)(i % 3); break;
+      case 2: input[i] = (int32_t)i; break;
+      default: input[i] = (int32_t)(INPUT_SIZE - i); break;
+    }
+    sorted[i] = input[i];
+  }
+
+  qsort(sorted, INPUT_SIZE, sizeof(int32_t), (SORT_ASCENDING == order) ? ascending : descending);
+}
+
+static void check_pop_all(size_t count)
+{
+  int32_t value = 0;
+
+  for (size_t i = 0; i < count; i++)
+  {
+    TEST_ASSERT_EQUAL_INT32(sorted[i], *(const int32_t *)priority_queue_peek_top(queue));
+    TEST_ASSERT_TRUE(priority_queue_pop_top(queue, &value));
+    TEST_ASSERT_EQUAL_INT32(sorted[i], value);
+    TEST_ASSERT_EQUAL_UINT32(count - i - 1, priority_queue_size(queue));
+  }
+
+  TEST_ASSERT_NULL(priority_queue_peek_top(queue));
+  TEST_ASSERT_FALSE(priority_queue_pop_top(queue, &value));
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+  if (NULL != queue)
+  {
+    priority_queue_delete(&queue);
+  }
+}
+
+void test_init(void)
+{
+  TEST_MESSAGE("Priority Queue Tests");
+}
+
+/**
+ * @brief Push of the elements and pop of them in the sorted order.
+ */
+void test_TestCase_1(void)
+{
+  TEST_MESSAGE("[PRIORITY_QUEUE]: Push and pop");
+
+  for (size_t a = 0; a < 4; a++)
+  {
+    for (size_t o = 0; o < 2; o++)
+    {
+      for (size_t pattern = 0; pattern < 4; pattern++)
+      {
+        prepare(pattern, orders[o]);
+        queue = priority_queue_create(sizeof(int32_t), compare, orders[o], arities[a]);
+        TEST_ASSERT_NOT_NULL(queue);
+        TEST_ASSERT_NULL(priority_queue_peek_top(queue));
+
+        for (size_t i = 0; i < INPUT_SIZE; i++)
+        {
+          TEST_ASSERT_TRUE(priority_queue_push(queue, &input[i], NULL));
+        }
+        TEST_ASSERT_EQUAL_UINT32(INPUT_SIZE, priority_queue_size(queue));
+        check_pop_all(INPUT_SIZE);
+
+        /* The emptied queue is filled again */
+        for (size_t i = 0; i < INPUT_SIZE / 2; i++)
+        {
+          TEST_ASSERT_TRUE(priority_queue_push(queue, &input[i], NULL));
+        }
+        priority_queue_clear(queue);
+        TEST_ASSERT_EQUAL_UINT32(0, priority_queue_size(queue));
+        TEST_ASSERT_NULL(priority_queue_peek_top(queue));
+
+        priority_queue_delete(&queue);
+      }
+    }
+  }
+}
+
+/**
+ * @brief Building of the queue from the container.
+ */
+void test_TestCase_2(void)
+{
+  TEST_MESSAGE("[PRIORITY_QUEUE]: Heapify from container");
+
+  for (size_t t = 0; t < 4; t++)
+  {
+    for (size_t a = 0; a < 4; a++)
+    {
+      for (size_t o = 0; o < 2; o++)
+      {
+        for (size_t pattern = 0; pattern < 4; pattern++)
+        {
+          prepare(pattern, orders[o]);
+          container_t *container = container_create(sizeof(int32_t), types[t]);
+          TEST_ASSERT_TRUE(uc_from_array(container, input, INPUT_SIZE));
+
+          queue = priority_queue_create(sizeof(int32_t), compare, orders[o], arities[a]);
+          TEST_ASSERT_TRUE(priority_queue_heapify(queue, container));
+          TEST_ASSERT_EQUAL_UINT32(INPUT_SIZE, priority_queue_size(queue));
+
+          /* The handle of the element is its index in the container */
+          for (size_t i = 0; i < INPUT_SIZE; i++)
+          {
+            TEST_ASSERT_EQUAL_INT32(input[i], *(const int32_t *)priority_queue_peek(queue, i));
+          }
+          TEST_ASSERT_NULL(priority_queue_peek(queue, INPUT_SIZE));
+          check_pop_all(INPUT_SIZE);
+
+          /* The queue built from the empty container is empty */
+          container_clear(container);
+          TEST_ASSERT_TRUE(priority_queue_heapify(queue, container));
+          TEST_ASSERT_EQUAL_UINT32(0, priority_queue_size(queue));
+
+          container_delete(&container);
+          priority_queue_delete(&queue);
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Change and erase of the elements by the handles compared with the simple model.
+ */
+void test_TestCase_3(void)
+{
+  static pq_handle_t handles[INPUT_SIZE];
+  static bool present[INPUT_SIZE];
+  static int32_t values[INPUT_SIZE];
+
+  TEST_MESSAGE("[PRIORITY_QUEUE]: Update and erase by handle");
+
+  for (size_t a = 0; a < 4; a++)
+  {
+    for (size_t o = 0; o < 2; o++)
+    {
+      uint32_t seed = 7 + (uint32_t)(a * 2 + o);
+      size_t size = 0;
+      memset(present, 0, sizeof(present));
+
+      queue = priority_queue_create(sizeof(int32_t), compare, orders[o], arities[a]);
+
+      for (size_t step = 0; step < STEPS; step++)
+      {
+        size_t id = next_random(&seed) % INPUT_SIZE;
+        int32_t value = (int32_t)(next_random(&seed) % 2000) - 1000;
+
+        switch (next_random(&seed) % 4)
+        {
+          case 0:
+            if (!present[id])
+            {
+              TEST_ASSERT_TRUE(priority_queue_push(queue, &value, &handles[id]));
+              present[id] = true;
+              values[id] = value;
+              size++;
+            }
+            break;
+          case 1:
+            if (present[id])
+            {
+              TEST_ASSERT_TRUE(priority_queue_update(queue, handles[id], &value));
+              values[id] = value;
+            }
+            break;
+          case 2:
+            if (present[id])
+            {
+              TEST_ASSERT_TRUE(priority_queue_erase(queue, handles[id]));
+              TEST_ASSERT_FALSE(priority_queue_erase(queue, handles[id]));
+              TEST_ASSERT_FALSE(priority_queue_update(queue, handles[id], &value));
+              present[id] = false;
+              size--;
+            }
+            break;
+          default:
+            if (0 != size)
+            {
+              int32_t top = 0;
+              TEST_ASSERT_TRUE(priority_queue_pop_top(queue, &top));
+
+              /* The popped element is the best one of the model; the element with the same value is removed */
+              size_t found = INPUT_SIZE;
+              for (size_t i = 0; i < INPUT_SIZE; i++)
+              {
+                if (present[i])
+                {
+                  TEST_ASSERT_TRUE((SORT_ASCENDING == orders[o]) ? (top <= values[i]) : (top >= values[i]));
+                  if (top == values[i] && NULL == priority_queue_peek(queue, handles[i]))
+                  {
+                    found = i;
+                  }
+                }
+              }
+              TEST_ASSERT_NOT_EQUAL(INPUT_SIZE, found);
+              present[found] = false;
+              size--;
+            }
+            break;
+        }
+
+        TEST_ASSERT_EQUAL_UINT32(size, priority_queue_size(queue));
+      }
+
+      for (size_t i = 0; i < INPUT_SIZE; i++)
+      {
+        if (present[i])
+        {
+          TEST_ASSERT_EQUAL_INT32(values[i], *(const int32_t *)priority_queue_peek(queue, handles[i]));
+        }
+      }
+
+      priority_queue_delete(&queue);
+    }
+  }
+}
+
+/**
+ * @brief Decrease-key on the structures: the order of the tasks is changed by their priorities.
+ */
+void test_TestCase_4(void)
+{
+  pq_handle_t handles[4];
+  task_t tasks[4] = {{1, 4.0}, {2, 3.0}, {3, 2.0}, {4, 1.0}};
+  task_t task;
+
+  TEST_MESSAGE("[PRIORITY_QUEUE]: Decrease key");
+
+  queue = priority_queue_create(sizeof(task_t), compare_task, SORT_ASCENDING, 4);
+  TEST_ASSERT_NOT_NULL(queue);
+
+  for (size_t i = 0; i < 4; i++)
+  {
+    TEST_ASSERT_TRUE(priority_queue_push(queue, &tasks[i], &handles[i]));
+  }
+  TEST_ASSERT_EQUAL_UINT32(4, ((const task_t *)priority_queue_peek_top(queue))->id);
+
+  task = tasks[0];
+  task.priority = 0.5;
+  TEST_ASSERT_TRUE(priority_queue_update(queue, handles[0], &task));
+  TEST_ASSERT_EQUAL_UINT32(1, ((const task_t *)priority_queue_peek_top(queue))->id);
+
+  task = tasks[3];
+  task.priority = 10.0;
+  TEST_ASSERT_TRUE(priority_queue_update(queue, handles[3], &task));
+
+  const uint32_t expected[4] = {1, 3, 2, 4};
+  for (size_t i = 0; i < 4; i++)
+  {
+    TEST_ASSERT_TRUE(priority_queue_pop_top(queue, &task));
+    TEST_ASSERT_EQUAL_UINT32(expected[i], task.id);
+  }
+
+  /* The released handles are reused by the next pushes */
+  pq_handle_t handle = 0;
+  TEST_ASSERT_TRUE(priority_queue_push(queue, &tasks[0], &handle));
+  TEST_ASSERT_TRUE(handle < 4);
+  TEST_ASSERT_EQUAL_UINT32(1, ((const task_t *)priority_queue_peek(queue, handle))->id);
+}
+
+/**
+ * @brief Building of the queue from the read-only view: the source is only read, so its tracked hash stays valid.
+ */
+void test_TestCase_5(void)
+{
+  TEST_MESSAGE("[PRIORITY_QUEUE]: Heapify from read-only view");
+
+  prepare(0, SORT_ASCENDING);
+  for (size_t t = 0; t < 4; t++)
+  {
+    container_t *container = container_create(sizeof(int32_t), types[t]);
+    TEST_ASSERT_TRUE(uc_from_array(container, input, INPUT_SIZE));
+
+    uint64_t hash = 0;
+    uint64_t cached = 0;
+    TEST_ASSERT_TRUE(container_hash_track(container, true));
+    hash = container_hash(container);
+
+    queue = priority_queue_create(sizeof(int32_t), compare, SORT_ASCENDING, 0);
+    TEST_ASSERT_TRUE(priority_queue_heapify(queue, container));
+    TEST_ASSERT_TRUE(container_hash_cached(container, &cached));
+    TEST_ASSERT_EQUAL_UINT64(hash, cached);
+
+    uc_view_t *view = container_view(container, 0, INPUT_SIZE, CONTAINER_VIEW_READ_ONLY);
+    TEST_ASSERT_NOT_NULL(view);
+    TEST_ASSERT_TRUE(priority_queue_heapify(queue, view));
+    check_pop_all(INPUT_SIZE);
+    TEST_ASSERT_TRUE(container_hash_cached(container, &cached));
+    TEST_ASSERT_EQUAL_UINT64(hash, cached);
+
+    container_delete(&view);
+    container_delete(&container);
+    priority_queue_delete(&queue);
+  }
+}
@@ -0,0 +1,232 @@
+/**
+ * @file    test_typed_TestSuite1.c
+ * @author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Set of tests for the type-specialized containers generated by `UC_DEFINE_VECTOR`/`UC_DEFINE_LIST` macros.
+ * @date    2023-10-05
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "unity.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "algorithms/equal/uc_equal.h"
+#include "core/container.h"
+#include "core/typed/uc_typed.h"
+#include "interface/allocator_if.h"
+
+//_____ C O N F I G S  ________________________________________________________
+#define INPUT_SIZE 100
+//_____ D E F I N I T I O N S _________________________________________________
+typedef struct
+{
+  uint32_t id;
+  double weight;
+} record_t;
+//_____ M A C R O S ___________________________________________________________
+#define RECORD_LESS(a, b)  ((a).weight < (b).weight)
+#define RECORD_EQUAL(a, b) ((a).id == (b).id)
+
+UC_DEFINE_VECTOR(i32vec, int32_t)
+UC_DEFINE_LIST(i32list, int32_t)
+UC_DEFINE_VECTOR_EX(recvec, record_t, RECORD_LESS, RECORD_EQUAL)
+UC_DEFINE_LIST_EX(reclist, record_t, RECORD_LESS, RECORD_EQUAL)
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+static int32_t pseudo_random(size_t i)
+{
+  return (int32_t)((i * 7919u) % 1013u) - 500;
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_init(void)
+{
+  TEST_MESSAGE("Typed Container Tests");
+}
+
+/**
+ * @brief The test verifies typed push/pop/at of the vector.
+ */
+void test_TestCase_1(void)
+{
+  TEST_MESSAGE("[TYPED_TEST]: vector push/pop/at");
+
+  i32vec_t *vec = i32vec_create();
+  TEST_ASSERT_NOT_NULL(vec);
+
+  for (int32_t i = 0; i < INPUT_SIZE; i++)
+  {
+    TEST_ASSERT_TRUE(i32vec_push_back(vec, i));
+  }
+  TEST_ASSERT_TRUE(i32vec_push_front(vec, -1));
+
+  TEST_ASSERT_EQUAL_UINT32(INPUT_SIZE + 1, i32vec_size(vec));
+  TEST_ASSERT_EQUAL_INT32(-1, *i32vec_at(vec, 0));
+  TEST_ASSERT_EQUAL_INT32(49, *i32vec_at(vec, 50));
+  TEST_ASSERT_NULL(i32vec_at(vec, INPUT_SIZE + 1));
+
+  int32_t value = 0;
+  TEST_ASSERT_TRUE(i32vec_pop_back(vec, &value));
+  TEST_ASSERT_EQUAL_INT32(INPUT_SIZE - 1, value);
+  TEST_ASSERT_TRUE(i32vec_pop_front(vec, &value));
+  TEST_ASSERT_EQUAL_INT32(-1, value);
+  TEST_ASSERT_EQUAL_UINT32(INPUT_SIZE - 1, i32vec_size(vec));
+
+  i32vec_delete(&vec);
+  TEST_ASSERT_NULL(vec);
+}
+
+/**
+ * @brief The test verifies typed push/pop/at of the linked list.
+ */
+void test_TestCase_2(void)
+{
+  TEST_MESSAGE("[TYPED_TEST]: list push/pop/at");
+
+  i32list_t *list = i32list_create();
+  TEST_ASSERT_NOT_NULL(list);
+
+  for (int32_t i = 0; i < INPUT_SIZE; i++)
+  {
+    TEST_ASSERT_TRUE(i32list_push_back(list, i));
+  }
+  TEST_ASSERT_TRUE(i32list_push_front(list, -1));
+
+  TEST_ASSERT_EQUAL_UINT32(INPUT_SIZE + 1, i32list_size(list));
+  TEST_ASSERT_EQUAL_INT32(-1, *i32list_at(list, 0));
+  TEST_ASSERT_EQUAL_INT32(49, *i32list_at(list, 50));
+  TEST_ASSERT_NULL(i32list_at(list, INPUT_SIZE + 1));
+
+  int32_t value = 0;
+  TEST_ASSERT_TRUE(i32list_pop_back(list, &value));
+  TEST_ASSERT_EQUAL_INT32(INPUT_SIZE - 1, value);
+  TEST_ASSERT_TRUE(i32list_pop_front(list, &value));
+  TEST_ASSERT_EQUAL_INT32(-1, value);
+
+  i32list_delete(&list);
+}
+
+/**
+ * @brief The test verifies typed sort and find for both container types.
+ */
+void test_TestCase_3(void)
+{
+  TEST_MESSAGE("[TYPED_TEST]: typed sort and find");
+
+  i32vec_t *vec = i32vec_create();
+  i32list_t *list = i32list_create();
+
+  for (size_t i = 0; i < INPUT_SIZE; i++)
+  {
+    TEST_ASSERT_TRUE(i32vec_push_back(vec, pseudo_random(i)));
+    TEST_ASSERT_TRUE(i32list_push_back(list, pseudo_random(i)));
+  }
+
+  TEST_ASSERT_TRUE(i32vec_sort(vec));
+  TEST_ASSERT_TRUE(i32list_sort(list));
+
+  for (size_t i = 1; i < INPUT_SIZE; i++)
+  {
+    TEST_ASSERT_TRUE(*i32vec_at(vec, i - 1) <= *i32vec_at(vec, i));
+    TEST_ASSERT_TRUE(*i32list_at(list, i - 1) <= *i32list_at(list, i));
+  }
+
+  TEST_ASSERT_EQUAL_INT32(pseudo_random(10), *i32vec_find(vec, pseudo_random(10)));
+  TEST_ASSERT_EQUAL_INT32(pseudo_random(10), *i32list_find(list, pseudo_random(10)));
+  TEST_ASSERT_NULL(i32vec_find(vec, 10000));
+  TEST_ASSERT_NULL(i32list_find(list, 10000));
+
+  /* Typed containers are interoperable with the generic algorithms */
+  TEST_ASSERT_TRUE(uc_equal(.container1 = i32vec_container(vec), .container2 = i32list_container(list)));
+
+  i32vec_delete(&vec);
+  i32list_delete(&list);
+}
+
+/**
+ * @brief The test verifies typed containers of structures with user comparison macros.
+ */
+void test_TestCase_4(void)
+{
+  record_t input[] = {{1, 4.5}, {2, -1.0}, {3, 10.25}, {4, 0.0}, {5, 3.0}};
+  uint32_t expected[] = {2, 4, 5, 1, 3};
+  size_t size = sizeof(input) / sizeof(input[0]);
+
+  TEST_MESSAGE("[TYPED_TEST]: typed containers of structures");
+
+  recvec_t *vec = recvec_create();
+  reclist_t *list = reclist_create();
+
+  for (size_t i = 0; i < size; i++)
+  {
+    TEST_ASSERT_TRUE(recvec_push_back(vec, input[i]));
+    TEST_ASSERT_TRUE(reclist_push_back(list, input[i]));
+  }
+
+  TEST_ASSERT_TRUE(recvec_sort(vec));
+  TEST_ASSERT_TRUE(reclist_sort(list));
+
+  for (size_t i = 0; i < size; i++)
+  {
+    TEST_ASSERT_EQUAL_UINT32(expected[i], recvec_at(vec, i)->id);
+    TEST_ASSERT_EQUAL_UINT32(expected[i], reclist_at(list, i)->id);
+  }
+
+  record_t key = {.id = 3, .weight = 0.0};
+  TEST_ASSERT_TRUE(10.25 == recvec_find(vec, key)->weight);
+  TEST_ASSERT_TRUE(10.25 == reclist_find(list, key)->weight);
+
+  recvec_delete(&vec);
+  reclist_delete(&list);
+}
+
+/**
+ * @brief The test verifies wrapping of the generic container into the typed one.
+ */
+void test_TestCase_5(void)
+{
+  TEST_MESSAGE("[TYPED_TEST]: wrapping of generic container");
+
+  container_t *vector = container_create(sizeof(int32_t), CONTAINER_VECTOR_BASED);
+  container_t *list = container_create(sizeof(int32_t), CONTAINER_LINKED_LIST_BASED);
+  container_t *bytes = container_create(sizeof(uint8_t), CONTAINER_VECTOR_BASED);
+
+  int32_t input = 7;
+  TEST_ASSERT_TRUE(container_push_back(vector, &input));
+
+  /* The wrapping doesn`t change the container, so its tracked hash stays valid */
+  uint64_t hash = 0;
+  TEST_ASSERT_TRUE(container_hash_track(vector, true));
+  container_hash(vector);
+  i32vec_t *vec = i32vec_from_container(vector);
+  TEST_ASSERT_NOT_NULL(vec);
+  TEST_ASSERT_TRUE(container_hash_cached(vector, &hash));
+  TEST_ASSERT_EQUAL_INT32(7, *i32vec_at(vec, 0));
+
+  TEST_ASSERT_NULL(i32vec_from_container(list));
+  TEST_ASSERT_NULL(i32vec_from_container(bytes));
+  TEST_ASSERT_NOT_NULL(i32list_from_container(list));
+  TEST_ASSERT_NULL(i32list_from_container(bytes));
+
+  uc_view_t *view = container_view(vector, 0, 1, CONTAINER_VIEW_READ_ONLY);
+  TEST_ASSERT_NULL(i32vec_from_container(view));
+  container_delete(&view);
+  view = container_view(vector, 0, 1, CONTAINER_VIEW_MUTABLE);
+  TEST_ASSERT_NOT_NULL(i32vec_from_container(view));
+  container_delete(&view);
+
+  TEST_ASSERT_NULL(container_data(list));
+  TEST_ASSERT_EQUAL_PTR(container_peek(vector, 0), container_data(vector));
+
+  container_delete(&vector);
+  container_delete(&list);
+  container_delete(&bytes);
+}
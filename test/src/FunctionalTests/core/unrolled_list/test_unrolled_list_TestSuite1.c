@@ -0,0 +1,427 @@
+/**
+ * @file    test_unrolled_list_TestSuite1.c
+ * @author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Set of tests for the unrolled list based container.
+ *
+ * Every test is executed for the small elements (many elements in the chunk) and for the large ones
+ * (a few elements in the chunk), the content is compared with the model kept in the plain array.
+ *
+ * @date    2023-10-17
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "unity.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "algorithms/equal/uc_equal.h"
+#include "core/container.h"
+#include "interface/allocator_if.h"
+
+//_____ C O N F I G S  ________________________________________________________
+#define MODEL_SIZE 4000
+#define STEPS      6000
+#define MAX_ESIZE  100
+//_____ D E F I N I T I O N S _________________________________________________
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+static const size_t esizes[3] = {sizeof(uint32_t), 24, MAX_ESIZE};
+static uint32_t model[MODEL_SIZE];
+static size_t model_size = 0;
+static container_t *container = NULL;
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+static uint32_t next_random(uint32_t *seed)
+{
+  *seed = *seed * 1103515245u + 12345u;
+  return *seed >> 8;
+}
+
+/* The element is the value followed by the bytes derived from it, so any misplaced byte is found */
+static void make(void *element, uint32_t value, size_t esize)
+{
+  uint8_t *bytes = (uint8_t *)element;
+
+  memcpy(bytes, &value, sizeof(value));
+  for (size_t i = sizeof(value); i < esize; i++)
+  {
+    bytes[i] = (uint8_t)(value + i);
+  }
+}
+
+static void check_element(const void *element, uint32_t value, size_t esize)
+{
+  uint8_t expected[MAX_ESIZE];
+  make(expected, value, esize);
+
+  TEST_ASSERT_EQUAL_MEMORY(expected, element, esize);
+}
+
+static void check_model(size_t esize)
+{
+  uint8_t element[MAX_ESIZE];
+
+  TEST_ASSERT_EQUAL_UINT32(model_size, container_size(container));
+  TEST_ASSERT_NULL(container_data(container));
+
+  size_t index = 0;
+  container_cursor_t cursor = container_cursor(container, 0);
+  for (; container_cursor_valid(&cursor); container_cursor_next(&cursor), index++)
+  {
+    check_element(container_cursor_data(&cursor), model[index], esize);
+  }
+  TEST_ASSERT_EQUAL_UINT32(model_size, index);
+
+  for (size_t i = 0; i < model_size; i += 1 + model_size / 64)
+  {
+    TEST_ASSERT_TRUE(container_at(container, element, i));
+    check_element(element, model[i], esize);
+    check_element(container_peek(container, i), model[i], esize);
+  }
+  TEST_ASSERT_FALSE(container_at(container, element, model_size));
+}
+
+static void model_insert(size_t index, const uint32_t *values, size_t count)
+{
+  memmove(&model[index + count], &model[index], (model_size - index) * sizeof(uint32_t));
+  memcpy(&model[index], values, count * sizeof(uint32_t));
+  model_size += count;
+}
+
+static void model_erase(size_t index, size_t count)
+{
+  memmove(&model[index], &model[index + count], (model_size - index - count) * sizeof(uint32_t));
+  model_size -= count;
+}
+
+static container_t *create_filled(size_t esize, uint32_t first, size_t count)
+{
+  uint8_t element[MAX_ESIZE];
+  container_t *tmp = container_create(esize, CONTAINER_UNROLLED_LIST_BASED);
+  TEST_ASSERT_NOT_NULL(tmp);
+
+  for (size_t i = 0; i < count; i++)
+  {
+    make(element, first + (uint32_t)i, esize);
+    TEST_ASSERT_TRUE(container_push_back(tmp, element));
+  }
+
+  return tmp;
+}
+
+static void fill_model(size_t esize, size_t count)
+{
+  container = create_filled(esize, 0, count);
+
+  for (size_t i = 0; i < count; i++)
+  {
+    model[i] = (uint32_t)i;
+  }
+  model_size = count;
+}
+
+static bool is_odd(const void *data, size_t esize)
+{
+  return (0 != (*(const uint32_t *)data & 1u));
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+void setUp(void)
+{
+  model_size = 0;
+}
+
+void tearDown(void)
+{
+  if (NULL != container)
+  {
+    container_delete(&container);
+  }
+}
+
+void test_init(void)
+{
+  TEST_MESSAGE("Unrolled List Tests");
+}
+
+/**
+ * @brief Random single element operations at the ends and in the middle of the list.
+ */
+void test_TestCase_1(void)
+{
+  TEST_MESSAGE("[UNROLLED_LIST]: Random single element operations");
+
+  uint8_t element[MAX_ESIZE];
+
+  for (size_t e = 0; e < 3; e++)
+  {
+    size_t esize = esizes[e];
+    uint32_t seed = 7u + (uint32_t)e;
+    container = container_create(esize, CONTAINER_UNROLLED_LIST_BASED);
+    TEST_ASSERT_NOT_NULL(container);
+    TEST_ASSERT_EQUAL_UINT32(esize, container_esize(container));
+
+    for (uint32_t step = 0; step < STEPS; step++)
+    {
+      uint32_t operation = next_random(&seed) % 8;
+      /* The list grows in the first half of the steps and shrinks in the second one */
+      bool grow = (step < STEPS / 2) ? (operation < 5) : (operation < 3);
+
+      if ((grow || 0 == model_size) && model_size < MODEL_SIZE)
+      {
+        size_t index = (0 == operation % 3) ? 0 : ((1 == operation % 3) ? model_size : next_random(&seed) % (model_size + 1));
+        make(element, step, esize);
+        TEST_ASSERT_TRUE(container_insert(container, element, index));
+        model_insert(index, &step, 1);
+      }
+      else if (0 == operation % 2)
+      {
+        size_t index = next_random(&seed) % model_size;
+        TEST_ASSERT_TRUE(container_extract(container, element, index));
+        check_element(element, model[index], esize);
+        model_erase(index, 1);
+      }
+      else if (1 == operation % 4)
+      {
+        TEST_ASSERT_TRUE(container_pop_front(container, element));
+        check_element(element, model[0], esize);
+        model_erase(0, 1);
+      }
+      else
+      {
+        TEST_ASSERT_TRUE(container_pop_back(container, element));
+        check_element(element, model[model_size - 1], esize);
+        model_erase(model_size - 1, 1);
+      }
+
+      if (0 == step % 500)
+      {
+        check_model(esize);
+      }
+    }
+    check_model(esize);
+
+    /* Out of range access doesn`t change the list */
+    make(element, 0, esize);
+    TEST_ASSERT_FALSE(container_insert(container, element, model_size + 1));
+    TEST_ASSERT_FALSE(container_erase(container, model_size));
+    TEST_ASSERT_FALSE(container_replace(container, element, model_size));
+    TEST_ASSERT_NULL(container_peek(container, model_size));
+
+    TEST_ASSERT_TRUE(container_clear(container));
+    model_size = 0;
+    check_model(esize);
+    TEST_ASSERT_FALSE(container_pop_front(container, element));
+    TEST_ASSERT_FALSE(container_pop_back(container, element));
+
+    container_delete(&container);
+  }
+}
+
+/**
+ * @brief Random insertion and extraction of the ranges which span several chunks.
+ */
+void test_TestCase_2(void)
+{
+  TEST_MESSAGE("[UNROLLED_LIST]: Random range operations");
+
+  static uint8_t buffer[MODEL_SIZE * MAX_ESIZE];
+  static uint32_t values[MODEL_SIZE];
+
+  for (size_t e = 0; e < 3; e++)
+  {
+    size_t esize = esizes[e];
+    uint32_t seed = 11u + (uint32_t)e;
+    container = container_create(esize, CONTAINER_UNROLLED_LIST_BASED);
+
+    for (uint32_t step = 0; step < STEPS / 10; step++)
+    {
+      size_t count = 1 + next_random(&seed) % ((0 == step % 2) ? 5 : 300);
+
+      if (0 == next_random(&seed) % 2 && model_size + count <= MODEL_SIZE)
+      {
+        size_t index = next_random(&seed) % (model_size + 1);
+        for (size_t i = 0; i < count; i++)
+        {
+          values[i] = step * 1000u + (uint32_t)i;
+          make(&buffer[i * esize], values[i], esize);
+        }
+        TEST_ASSERT_TRUE(container_insert_range(container, buffer, index, count));
+        model_insert(index, values, count);
+      }
+      else if (count <= model_size)
+      {
+        size_t index = next_random(&seed) % (model_size - count + 1);
+        TEST_ASSERT_TRUE(container_extract_range(container, buffer, index, count));
+        for (size_t i = 0; i < count; i++)
+        {
+          check_element(&buffer[i * esize], model[index + i], esize);
+        }
+        model_erase(index, count);
+      }
+      else
+      {
+        TEST_ASSERT_FALSE(container_extract_range(container, buffer, 0, count));
+      }
+
+      check_model(esize);
+    }
+
+    TEST_ASSERT_TRUE(container_erase_range(container, 0, model_size));
+    model_size = 0;
+    check_model(esize);
+
+    container_delete(&container);
+  }
+}
+
+/**
+ * @brief Whole list operations: splice, rotate, reverse, fill, erase by predicate and clone.
+ */
+void test_TestCase_3(void)
+{
+  TEST_MESSAGE("[UNROLLED_LIST]: Splice, rotate, reverse, fill, erase if, clone");
+
+  uint8_t element[MAX_ESIZE];
+  const size_t sizes[4] = {1, 7, 150, 1000};
+
+  for (size_t e = 0; e < 3; e++)
+  {
+    size_t esize = esizes[e];
+
+    for (size_t s = 0; s < 4; s++)
+    {
+      size_t size = sizes[s];
+      size_t index = (size * 2) / 3;
+
+      /* Splice in the middle of the chunk moves the chunks of other list */
+      fill_model(esize, size);
+      container_t *other = create_filled(esize, 100000, size / 2 + 1);
+      uint32_t values[MODEL_SIZE];
+      for (size_t i = 0; i < size / 2 + 1; i++)
+      {
+        values[i] = 100000u + (uint32_t)i;
+      }
+      TEST_ASSERT_TRUE(container_splice(container, index, other));
+      model_insert(index, values, size / 2 + 1);
+      TEST_ASSERT_EQUAL_UINT32(0, container_size(other));
+      check_model(esize);
+
+      /* The emptied list is reusable */
+      make(element, 7, esize);
+      TEST_ASSERT_TRUE(container_push_back(other, element));
+      TEST_ASSERT_EQUAL_UINT32(1, container_size(other));
+      container_delete(&other);
+
+      /* Rotate to the left by a count which isn`t a multiple of the chunk capacity */
+      size_t shift = (model_size * 3) / 7 + 1;
+      TEST_ASSERT_TRUE(container_rotate(container, shift));
+      shift %= model_size;
+      memcpy(values, model, shift * sizeof(uint32_t));
+      model_erase(0, shift);
+      model_insert(model_size, values, shift);
+      check_model(esize);
+
+      TEST_ASSERT_TRUE(container_reverse(container));
+      for (size_t i = 0; i < model_size / 2; i++)
+      {
+        uint32_t tmp = model[i];
+        model[i] = model[model_size - 1 - i];
+        model[model_size - 1 - i] = tmp;
+      }
+      check_model(esize);
+
+      make(element, 424242, esize);
+      TEST_ASSERT_TRUE(container_fill(container, model_size / 4, model_size / 2, element));
+      for (size_t i = model_size / 4; i < model_size / 4 + model_size / 2; i++)
+      {
+        model[i] = 424242;
+      }
+      TEST_ASSERT_FALSE(container_fill(container, model_size, 1, element));
+      check_model(esize);
+
+      container_t *copy = container_clone(container, CONTAINER_COPY_SHALLOW, NULL);
+      TEST_ASSERT_NOT_NULL(copy);
+      TEST_ASSERT_TRUE(uc_equal(.container1 = container, .container2 = copy));
+
+      size_t erased = 0;
+      for (size_t i = 0; i < model_size;)
+      {
+        if (0 != (model[i] & 1u))
+        {
+          model_erase(i, 1);
+          erased++;
+          continue;
+        }
+        i++;
+      }
+      TEST_ASSERT_EQUAL_UINT32(erased, container_erase_if(container, is_odd));
+      check_model(esize);
+
+      /* The clone isn`t changed by the changes of the original list */
+      TEST_ASSERT_EQUAL_UINT32(model_size + erased, container_size(copy));
+      container_delete(&copy);
+      container_delete(&container);
+    }
+  }
+}
+
+/**
+ * @brief Erasure through the cursor and the views of the unrolled list.
+ */
+void test_TestCase_4(void)
+{
+  TEST_MESSAGE("[UNROLLED_LIST]: Cursor erase and views");
+
+  for (size_t e = 0; e < 3; e++)
+  {
+    size_t esize = esizes[e];
+    fill_model(esize, 1000);
+
+    /* Every third element is erased, the pointer to the previous kept element stays valid */
+    const void *previous = NULL;
+    size_t index = 0;
+    container_cursor_t cursor = container_cursor(container, 0);
+    while (container_cursor_valid(&cursor))
+    {
+      if (0 == index++ % 3)
+      {
+        TEST_ASSERT_TRUE(container_cursor_erase(&cursor));
+        continue;
+      }
+
+      if (NULL != previous)
+      {
+        check_element(previous, *(const uint32_t *)previous, esize);
+      }
+      previous = container_cursor_data(&cursor);
+      container_cursor_next(&cursor);
+    }
+
+    for (size_t i = 0, read = 0; read < 1000; read++)
+    {
+      if (0 != read % 3)
+      {
+        model[i++] = (uint32_t)read;
+      }
+    }
+    model_size = 1000 - 334;
+    check_model(esize);
+
+    /* The view shows a window of the list, the elements are replaced through the mutable view */
+    uc_view_t *view = container_view(container, 100, 200, CONTAINER_VIEW_MUTABLE);
+    TEST_ASSERT_NOT_NULL(view);
+    TEST_ASSERT_EQUAL_UINT32(200, container_size(view));
+    check_element(container_peek(view, 0), model[100], esize);
+    check_element(container_peek(view, 199), model[299], esize);
+
+    uint8_t element[MAX_ESIZE];
+    make(element, 777, esize);
+    TEST_ASSERT_TRUE(container_replace(view, element, 10));
+    model[110] = 777;
+    container_delete(&view);
+    check_model(esize);
+
+    container_delete(&container);
+  }
+}
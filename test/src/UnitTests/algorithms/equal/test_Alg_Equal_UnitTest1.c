@@ -10,7 +10,8 @@
  *   - Size mismatches between containers.
  *   - Element size mismatches.
  *   - Handling of empty containers.
- *   - Failure scenarios related to memory allocation and array transformation.
+ *   - Direct comparison of the contiguous storages.
+ *   - Lockstep walk by the cursors and exit on the first mismatch.
  *   - Behavior when using different compare functions.
  *
  * These tests are written using the Ceedling test framework and are intended to
@@ -31,12 +32,9 @@
 
 // stubs
 #include "compare_stub.h"
-#include "mem_alloc_stub.h"
 
 // mock
-#include "mock_allocator_if.h"
 #include "mock_container.h"
-#include "mock_uc_transformation.h"
 //_____ C O N F I G S  ________________________________________________________
 //_____ D E F I N I T I O N S _________________________________________________
 //_____ M A C R O S ___________________________________________________________
@@ -44,6 +42,11 @@
 container_t container1 = 10;
 container_t container2 = 10;
 //_____ P R I V A T E  F U N C T I O N S_______________________________________
+static bool hash_cached_stub(const container_t *container, uint64_t *hash, int cmock_num_calls)
+{
+  *hash = (uint64_t)cmock_num_calls;
+  return true;
+}
 //_____ P U B L I C  F U N C T I O N S_________________________________________
 /**
  * @brief Tests if the `equal` function can correctly identify containers with different sizes.
@@ -103,14 +106,14 @@ void test_UnitTest_3(void)
 }
 
 /**
- * @brief Tests the `equal` function's behavior when there's an internal memory allocation failure.
+ * @brief Tests the `equal` function's behavior when both containers store the elements contiguously.
  */
 void test_UnitTest_4(void)
 {
-  uint32_t output[2] = {};
-  size_t arr_size = sizeof(output) / sizeof(uint32_t);
+  uint16_t data1[2] = {1, 2};
+  uint16_t data2[2] = {1, 2};
 
-  TEST_MESSAGE("Testing `uc_equal_base`: inner array fault allocation");
+  TEST_MESSAGE("Testing `uc_equal_base`: Contiguous storages are equal");
 
   container_size_ExpectAnyArgsAndReturn(2);
   container_size_ExpectAnyArgsAndReturn(2);
@@ -118,20 +121,23 @@ void test_UnitTest_4(void)
   container_esize_ExpectAnyArgsAndReturn(2);
   container_esize_ExpectAnyArgsAndReturn(2);
 
-  get_allocator_ExpectAndReturn(mem_allocate_fault);
+  container_hash_cached_ExpectAnyArgsAndReturn(false);
 
-  TEST_ASSERT_FALSE(uc_equal(.container1 = container1, .container2 = container2));
+  container_cdata_ExpectAnyArgsAndReturn(data1);
+  container_cdata_ExpectAnyArgsAndReturn(data2);
+
+  TEST_ASSERT_TRUE(uc_equal(.container1 = container1, .container2 = container2));
 }
 
 /**
- * @brief Tests the `equal` function's behavior when the first `uc_to_array` function fails.
+ * @brief Tests the `equal` function's behavior when the contiguous storages differ.
  */
 void test_UnitTest_5(void)
 {
-  uint32_t output[2] = {};
-  size_t arr_size = sizeof(output) / sizeof(uint32_t);
+  uint16_t data1[2] = {1, 2};
+  uint16_t data2[2] = {1, 3};
 
-  TEST_MESSAGE("Testing `uc_equal_base`: First `uc_to_array` function fault");
+  TEST_MESSAGE("Testing `uc_equal_base`: Contiguous storages are not equal");
 
   container_size_ExpectAnyArgsAndReturn(2);
   container_size_ExpectAnyArgsAndReturn(2);
@@ -139,24 +145,23 @@ void test_UnitTest_5(void)
   container_esize_ExpectAnyArgsAndReturn(2);
   container_esize_ExpectAnyArgsAndReturn(2);
 
-  get_allocator_ExpectAndReturn(mem_allocate);
-  get_free_ExpectAndReturn(mem_free);
+  container_hash_cached_ExpectAnyArgsAndReturn(false);
 
-  uc_to_array_ExpectAnyArgsAndReturn(false);
-  uc_to_array_ExpectAnyArgsAndReturn(true);
+  container_cdata_ExpectAnyArgsAndReturn(data1);
+  container_cdata_ExpectAnyArgsAndReturn(data2);
 
   TEST_ASSERT_FALSE(uc_equal(.container1 = container1, .container2 = container2));
 }
 
 /**
- * @brief Tests the `equal` function's behavior when the second `uc_to_array` function fails.
+ * @brief Tests the `equal` function's behavior when provided a compare function that always returns `false`.
  */
 void test_UnitTest_6(void)
 {
-  uint32_t output[2] = {};
-  size_t arr_size = sizeof(output) / sizeof(uint32_t);
+  uint16_t data1[2] = {1, 2};
+  uint16_t data2[2] = {1, 2};
 
-  TEST_MESSAGE("Testing `uc_equal_base`: Second `uc_to_array` function fault");
+  TEST_MESSAGE("Testing `uc_equal_base`: Inner compare function return `false`");
 
   container_size_ExpectAnyArgsAndReturn(2);
   container_size_ExpectAnyArgsAndReturn(2);
@@ -164,24 +169,21 @@ void test_UnitTest_6(void)
   container_esize_ExpectAnyArgsAndReturn(2);
   container_esize_ExpectAnyArgsAndReturn(2);
 
-  get_allocator_ExpectAndReturn(mem_allocate);
-  get_free_ExpectAndReturn(mem_free);
-
-  uc_to_array_ExpectAnyArgsAndReturn(true);
-  uc_to_array_ExpectAnyArgsAndReturn(false);
+  container_cdata_ExpectAnyArgsAndReturn(data1);
+  container_cdata_ExpectAnyArgsAndReturn(data2);
 
-  TEST_ASSERT_FALSE(uc_equal(.container1 = container1, .container2 = container2));
+  TEST_ASSERT_FALSE(uc_equal(.container1 = container1, .container2 = container2, .cmp = compare_false));
 }
 
 /**
- * @brief Tests the `equal` function's behavior when provided a compare function that always returns `false`.
+ * @brief Tests the `equal` function's behavior when the containers are walked by the cursors.
  */
 void test_UnitTest_7(void)
 {
-  uint32_t output[2] = {};
-  size_t arr_size = sizeof(output) / sizeof(uint32_t);
+  uint16_t data[2] = {1, 2};
+  container_cursor_t cursor = {.container = &container1, .position = data};
 
-  TEST_MESSAGE("Testing `uc_equal_base`: Inner compare function return `false`");
+  TEST_MESSAGE("Testing `uc_equal_base`: Lockstep walk, all goes fine");
 
   container_size_ExpectAnyArgsAndReturn(2);
   container_size_ExpectAnyArgsAndReturn(2);
@@ -189,24 +191,27 @@ void test_UnitTest_7(void)
   container_esize_ExpectAnyArgsAndReturn(2);
   container_esize_ExpectAnyArgsAndReturn(2);
 
-  get_allocator_ExpectAndReturn(mem_allocate);
-  get_free_ExpectAndReturn(mem_free);
+  container_cdata_ExpectAnyArgsAndReturn(NULL);
+  container_cdata_ExpectAnyArgsAndReturn(data);
 
-  uc_to_array_ExpectAnyArgsAndReturn(true);
-  uc_to_array_ExpectAnyArgsAndReturn(true);
+  container_cursor_ExpectAnyArgsAndReturn(cursor);
+  container_cursor_ExpectAnyArgsAndReturn(cursor);
 
-  TEST_ASSERT_FALSE(uc_equal(.container1 = container1, .container2 = container2, .cmp = compare_false));
+  container_cursor_cdata_IgnoreAndReturn(data);
+  container_cursor_next_IgnoreAndReturn(true);
+
+  TEST_ASSERT_TRUE(uc_equal(.container1 = container1, .container2 = container2, .cmp = compare_true));
 }
 
 /**
- * @brief Tests the `equal` function's behavior under normal conditions where everything is expected to succeed.
+ * @brief Tests that the walk by the cursors stops on the first mismatch.
  */
 void test_UnitTest_8(void)
 {
-  uint32_t output[2] = {};
-  size_t arr_size = sizeof(output) / sizeof(uint32_t);
+  uint16_t data[2] = {1, 2};
+  container_cursor_t cursor = {.container = &container1, .position = data};
 
-  TEST_MESSAGE("Testing `uc_equal_base`: All goes fine");
+  TEST_MESSAGE("Testing `uc_equal_base`: Lockstep walk stops on first mismatch");
 
   container_size_ExpectAnyArgsAndReturn(2);
   container_size_ExpectAnyArgsAndReturn(2);
@@ -214,11 +219,35 @@ void test_UnitTest_8(void)
   container_esize_ExpectAnyArgsAndReturn(2);
   container_esize_ExpectAnyArgsAndReturn(2);
 
-  get_allocator_ExpectAndReturn(mem_allocate);
-  get_free_ExpectAndReturn(mem_free);
+  container_hash_cached_ExpectAnyArgsAndReturn(false);
 
-  uc_to_array_ExpectAnyArgsAndReturn(true);
-  uc_to_array_ExpectAnyArgsAndReturn(true);
+  container_cdata_ExpectAnyArgsAndReturn(data);
+  container_cdata_ExpectAnyArgsAndReturn(NULL);
 
-  TEST_ASSERT_TRUE(uc_equal(.container1 = container1, .container2 = container2, .cmp = compare_true));
+  container_cursor_ExpectAnyArgsAndReturn(cursor);
+  container_cursor_ExpectAnyArgsAndReturn(cursor);
+
+  /* The cursors aren`t moved after the mismatch */
+  container_cursor_cdata_ExpectAnyArgsAndReturn(&data[0]);
+  container_cursor_cdata_ExpectAnyArgsAndReturn(&data[1]);
+
+  TEST_ASSERT_FALSE(uc_equal(.container1 = container1, .container2 = container2));
+}
+
+/**
+ * @brief Tests that the different tracked hashes reject the containers without reading the elements.
+ */
+void test_UnitTest_9(void)
+{
+  TEST_MESSAGE("Testing `uc_equal_base`: Tracked hashes are not equal");
+
+  container_size_ExpectAnyArgsAndReturn(2);
+  container_size_ExpectAnyArgsAndReturn(2);
+
+  container_esize_ExpectAnyArgsAndReturn(2);
+  container_esize_ExpectAnyArgsAndReturn(2);
+
+  container_hash_cached_StubWithCallback(hash_cached_stub);
+
+  TEST_ASSERT_FALSE(uc_equal(.container1 = container1, .container2 = container2));
 }
@@ -21,9 +21,20 @@ typedef uint32_t container_t;
  */
 typedef enum ContainerType_tag
 {
-  CONTAINER_LINKED_LIST_BASED = 0, /**< Specifies a container based on a linked list. */
-  CONTAINER_VECTOR_BASED = 1,      /**< Specifies a container based on a vector (dynamic array). */
+  CONTAINER_LINKED_LIST_BASED = 0,   /**< Specifies a container based on a linked list. */
+  CONTAINER_VECTOR_BASED = 1,        /**< Specifies a container based on a vector (dynamic array). */
+  CONTAINER_UNROLLED_LIST_BASED = 2, /**< Specifies a container based on an unrolled list (linked chunks of elements). */
+  CONTAINER_TIERED_VECTOR_BASED = 3, /**< Specifies a container based on a tiered vector (sqrt(N) wide circular tiers). */
 } container_type_e;
+
+/**
+ * \brief Position of the element in the container.
+ */
+typedef struct
+{
+  container_t *container; /**< The container which the cursor walks through. */
+  void *position;         /**< Core specific position of the element or NULL if the cursor is out of the container. */
+} container_cursor_t;
 //_____ M A C R O S ___________________________________________________________
 //_____ V A R I A B L E S _____________________________________________________
 //_____ P U B L I C  F U N C T I O N S_________________________________________
@@ -154,6 +165,15 @@ bool container_erase(container_t *container, size_t index);
  */
 void *container_peek(const container_t *container, size_t index);
 
+/**
+ * \brief Returns a read-only pointer to an element at a specified index in the container.
+ *
+ * \param container Pointer to the container.
+ * \param index The index of the element.
+ * \return Pointer to the element or NULL if the index is out of the container.
+ */
+const void *container_cpeek(const container_t *container, size_t index);
+
 /**
  * \brief Clears all the elements from the container.
  *
@@ -177,3 +197,77 @@ size_t container_size(const container_t *container);
  * \return Size of single element.
  */
 size_t container_esize(const container_t *container);
+
+/**
+ * \brief Returns a pointer to the contiguous storage of the elements.
+ *
+ * \param container Pointer to the container.
+ * \return Pointer to the first element or NULL if the container doesn`t store the elements contiguously (linked list based).
+ */
+void *container_data(const container_t *container);
+
+/**
+ * \brief Returns a read-only pointer to the contiguous storage of the elements.
+ *
+ * \param container Pointer to the container.
+ * \return Pointer to the first element or NULL if the container doesn`t store the elements contiguously.
+ */
+const void *container_cdata(const container_t *container);
+
+/**
+ * \brief Creates a cursor which points to the element at a specified index.
+ *
+ * \param container Pointer to the container.
+ * \param index The index of the element.
+ * \return The cursor. The cursor is invalid if the index is out of the container.
+ */
+container_cursor_t container_cursor(const container_t *container, size_t index);
+
+/**
+ * \brief Moves the cursor to the next element of the container.
+ *
+ * \param cursor Pointer to the cursor.
+ * \return true if the cursor points to an element after the move, false if the end of the container is reached.
+ */
+bool container_cursor_next(container_cursor_t *cursor);
+
+/**
+ * \brief Returns a pointer to the element which the cursor points to.
+ *
+ * \param cursor Pointer to the cursor.
+ * \return Pointer to the element or NULL if the cursor is invalid.
+ */
+void *container_cursor_data(const container_cursor_t *cursor);
+
+/**
+ * \brief Returns a read-only pointer to the element which the cursor points to.
+ *
+ * \param cursor Pointer to the cursor.
+ * \return Pointer to the element or NULL if the cursor is invalid.
+ */
+const void *container_cursor_cdata(const container_cursor_t *cursor);
+
+/**
+ * \brief Checks if the container is a view of other container.
+ *
+ * \param container Pointer to the container.
+ * \return true if the container is a view, false otherwise.
+ */
+bool container_is_view(const container_t *container);
+
+/**
+ * \brief Checks if the elements of the container are accessed by the index in O(1).
+ *
+ * \param container Pointer to the container.
+ * \return true if `container_peek` and `container_at` take O(1), false otherwise.
+ */
+bool container_random_access(const container_t *container);
+
+/**
+ * \brief Returns the tracked hash without computing it.
+ *
+ * \param container Pointer to the container.
+ * \param hash Pointer to the variable which receives the hash.
+ * \return true if the hash is tracked and valid, false otherwise (the variable isn`t changed).
+ */
+bool container_hash_cached(const container_t *container, uint64_t *hash);